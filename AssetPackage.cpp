@@ -0,0 +1,137 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#include "AssetPackage.hpp"
+#include <SDL3/SDL_log.h>
+#include <cstring>
+
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+bool AssetPackage::Open(const char* path) {
+    Close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        SDL_Log("Could not open asset package %s", path);
+        return false;
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        SDL_Log("Could not read the size of asset package %s", path);
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    const void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (view == nullptr) {
+        SDL_Log("Could not map asset package %s", path);
+        if (mapping) { CloseHandle(mapping); }
+        CloseHandle(file);
+        return false;
+    }
+    fileHandle = file;
+    mappingHandle = mapping;
+    fileSize = static_cast<size_t>(size.QuadPart);
+#else
+    const int file = open(path, O_RDONLY);
+    if (file < 0) {
+        SDL_Log("Could not open asset package %s", path);
+        return false;
+    }
+    struct stat fileStat {};
+    if (fstat(file, &fileStat) != 0 || fileStat.st_size <= 0) {
+        SDL_Log("Could not read the size of asset package %s", path);
+        close(file);
+        return false;
+    }
+    void* view = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+    if (view == MAP_FAILED) {
+        SDL_Log("Could not map asset package %s", path);
+        close(file);
+        return false;
+    }
+    fileDescriptor = file;
+    fileSize = static_cast<size_t>(fileStat.st_size);
+#endif
+    fileData = static_cast<const Uint8*>(view);
+
+    // Entries are used in place, so every range they hand out is checked once here
+    const auto* header = reinterpret_cast<const AssetPackageHeader*>(fileData);
+    if (fileSize < sizeof(AssetPackageHeader) || header->magic != ASSET_PACKAGE_MAGIC
+        || header->version != ASSET_PACKAGE_VERSION
+        || (fileSize - sizeof(AssetPackageHeader)) / sizeof(AssetEntry) < header->entryCount) {
+        SDL_Log("Asset package %s is invalid or has an outdated version, cook it again", path);
+        Close();
+        return false;
+    }
+    const auto* packageEntries = reinterpret_cast<const AssetEntry*>(fileData + sizeof(AssetPackageHeader));
+    for (Uint32 i = 0; i < header->entryCount; ++i) {
+        if (!IsEntryValid(packageEntries[i])) {
+            SDL_Log("Asset package %s is truncated or corrupt, cook it again", path);
+            Close();
+            return false;
+        }
+    }
+    entryCount = header->entryCount;
+    entries = packageEntries;
+    return true;
+}
+
+bool AssetPackage::IsEntryValid(const AssetEntry& entry) const {
+    // Subtractions only, offset + size could overflow
+    if (entry.offset > fileSize || entry.size > fileSize - entry.offset) { return false; }
+    if (entry.type != AssetType::Texture) { return true; }
+    if (entry.levelCount == 0 || entry.levelCount > ASSET_MAX_LEVELS) { return false; }
+    for (Uint32 level = 0; level < entry.levelCount; ++level) {
+        if (entry.levelOffsets[level] > entry.size
+            || entry.levelSizes[level] > entry.size - entry.levelOffsets[level]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void AssetPackage::Close() {
+    if (fileData == nullptr) { return; }
+#ifdef _WIN32
+    UnmapViewOfFile(fileData);
+    CloseHandle(static_cast<HANDLE>(mappingHandle));
+    CloseHandle(static_cast<HANDLE>(fileHandle));
+    fileHandle = nullptr;
+    mappingHandle = nullptr;
+#else
+    munmap(const_cast<Uint8*>(fileData), fileSize);
+    close(fileDescriptor);
+    fileDescriptor = -1;
+#endif
+    fileData = nullptr;
+    fileSize = 0;
+    entries = nullptr;
+    entryCount = 0;
+}
+
+const AssetEntry* AssetPackage::Find(const char* name, Uint32 format) const {
+    // Entries are sorted by name, then format: binary search the first entry with this name
+    Uint32 low = 0;
+    Uint32 high = entryCount;
+    while (low < high) {
+        const Uint32 middle = (low + high) / 2;
+        if (std::strncmp(entries[middle].name, name, ASSET_NAME_SIZE) < 0) { low = middle + 1; }
+        else { high = middle; }
+    }
+    for (Uint32 i = low; i < entryCount && std::strncmp(entries[i].name, name, ASSET_NAME_SIZE) == 0; ++i) {
+        if (format == 0 || entries[i].format == format) { return &entries[i]; }
+    }
+    return nullptr;
+}
@@ -0,0 +1,85 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef ASSETPACKAGE_HPP
+#define ASSETPACKAGE_HPP
+
+#include <SDL3/SDL_stdinc.h>
+
+/*
+ * Binary package produced by the asset-cooker tool (Tools/AssetCooker.cpp).
+ * Layout: header, entry table sorted by name then format, then the 16 bytes aligned payloads.
+ * Every structure is stored as is, so the runtime maps the file and reads it without parsing.
+ */
+constexpr Uint32 ASSET_PACKAGE_MAGIC = 0x50415347; // "GSAP"
+constexpr Uint32 ASSET_PACKAGE_VERSION = 1;
+constexpr Uint32 ASSET_PACKAGE_ALIGNMENT = 16;
+constexpr Uint32 ASSET_NAME_SIZE = 64;
+constexpr Uint32 ASSET_MAX_LEVELS = 16;
+
+enum class AssetType : Uint32 {
+    Texture = 0,
+    Shader = 1
+};
+
+struct AssetPackageHeader {
+    Uint32 magic;
+    Uint32 version;
+    Uint32 entryCount;
+    Uint32 padding;
+};
+
+struct AssetEntry {
+    char name[ASSET_NAME_SIZE];   // Path relative to Content/Images for textures, shader file name for shaders
+    AssetType type;
+    Uint32 format;                // SDL_GPUTextureFormat for textures, SDL_GPUShaderFormat for shaders
+    Uint32 width;
+    Uint32 height;
+    Uint32 levelCount;
+    Uint32 padding;
+    Uint64 offset;                // From the start of the package
+    Uint64 size;
+    Uint64 contentHash;           // Hash of the source file the entry was cooked from
+    Uint32 levelOffsets[ASSET_MAX_LEVELS]; // From the start of the entry data
+    Uint32 levelSizes[ASSET_MAX_LEVELS];
+};
+
+/*
+ * Read-only view on a cooked package, memory mapped in a single call.
+ */
+class AssetPackage {
+public:
+    bool Open(const char* path);
+
+    void Close();
+
+    bool IsOpen() const { return fileData != nullptr; }
+
+    // Find an entry by name. If format is not 0, the entry must also match this format.
+    const AssetEntry* Find(const char* name, Uint32 format = 0) const;
+
+    const Uint8* GetData(const AssetEntry& entry) const { return fileData + entry.offset; }
+
+    Uint32 GetEntryCount() const { return entryCount; }
+
+    const AssetEntry* GetEntries() const { return entries; }
+
+private:
+    // Data and texture levels of the entry inside the file
+    bool IsEntryValid(const AssetEntry& entry) const;
+
+    const Uint8* fileData { nullptr };
+    size_t fileSize { 0 };
+    const AssetEntry* entries { nullptr };
+    Uint32 entryCount { 0 };
+#ifdef _WIN32
+    void* fileHandle { nullptr };
+    void* mappingHandle { nullptr };
+#else
+    int fileDescriptor { -1 };
+#endif
+};
+
+
+#endif //ASSETPACKAGE_HPP
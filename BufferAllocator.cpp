@@ -0,0 +1,183 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#include "BufferAllocator.hpp"
+#include <SDL3/SDL_assert.h>
+#include <SDL3/SDL_log.h>
+
+void BufferAllocator::Init(SDL_GPUDevice* device_, SDL_GPUBufferUsageFlags usage_, const string& name_,
+                           Uint32 poolSize) {
+    device = device_;
+    usage = usage_;
+    name = name_;
+    poolOrder = OrderForSize(poolSize);
+}
+
+BufferAllocation BufferAllocator::Allocate(Uint32 size) {
+    if (size == 0) { return BufferAllocation {}; }
+    const Uint32 order = OrderForSize(size);
+    if ((static_cast<Uint64>(MIN_BLOCK_SIZE) << order) > 0x80000000u) {
+        SDL_Log("%s: allocation of %u bytes is too large", name.c_str(), size);
+        return BufferAllocation {};
+    }
+
+    Uint32 blockIndex = NONE;
+    Uint32 poolIndex = 0;
+    for (; poolIndex < pools.size(); ++poolIndex) {
+        if (AllocateFromPool(pools[poolIndex], order, blockIndex)) { break; }
+    }
+    if (poolIndex == pools.size()) {
+        if (!CreatePool(order, poolIndex) || !AllocateFromPool(pools[poolIndex], order, blockIndex)) {
+            return BufferAllocation {};
+        }
+    }
+
+    ++liveAllocationCount;
+    return BufferAllocation {
+        .buffer = pools[poolIndex].buffer,
+        .offset = blockIndex * MIN_BLOCK_SIZE,
+        .size = size,
+        .owner = this,
+        .poolIndex = poolIndex,
+        .order = order
+    };
+}
+
+void BufferAllocator::Free(BufferAllocation& allocation, Uint64 frame) {
+    if (!allocation.IsValid()) { return; }
+    SDL_assert(allocation.owner == this);
+    pendingFrees.push_back(PendingFree {
+        allocation.poolIndex, allocation.offset / MIN_BLOCK_SIZE, allocation.order, frame
+    });
+    --liveAllocationCount;
+    allocation = BufferAllocation {};
+}
+
+void BufferAllocator::Retire(Uint64 completedFrameCount, DeferredReleaseQueue& releaseQueue, Uint64 frame) {
+    while (!pendingFrees.empty() && pendingFrees.front().frame < completedFrameCount) {
+        const PendingFree& pendingFree = pendingFrees.front();
+        Pool& pool = pools[pendingFree.poolIndex];
+        FreeToPool(pool, pendingFree.blockIndex, pendingFree.order);
+        pendingFrees.pop_front();
+
+        // Empty: a single free block of the pool size. No pending free can be left for it.
+        if (pool.maxOrder > poolOrder && pool.freeOrder[0] == pool.maxOrder) {
+            releaseQueue.Push(GPUResourceType::Buffer, pool.buffer, frame);
+            pool = Pool {};
+        }
+    }
+}
+
+void BufferAllocator::Close() {
+    if (liveAllocationCount > 0) {
+        SDL_Log("Leaked %u allocations in %s", liveAllocationCount, name.c_str());
+    }
+    for (Pool& pool : pools) {
+        if (pool.buffer != nullptr) { SDL_ReleaseGPUBuffer(device, pool.buffer); }
+    }
+    pools.clear();
+    pendingFrees.clear();
+    liveAllocationCount = 0;
+}
+
+Uint32 BufferAllocator::GetPoolCount() const {
+    Uint32 count = 0;
+    for (const Pool& pool : pools) {
+        if (pool.buffer != nullptr) { ++count; }
+    }
+    return count;
+}
+
+Uint64 BufferAllocator::GetPoolBytes() const {
+    Uint64 bytes = 0;
+    for (const Pool& pool : pools) {
+        if (pool.buffer != nullptr) { bytes += static_cast<Uint64>(MIN_BLOCK_SIZE) << pool.maxOrder; }
+    }
+    return bytes;
+}
+
+Uint32 BufferAllocator::OrderForSize(Uint32 size) {
+    Uint32 order = 0;
+    while ((static_cast<Uint64>(MIN_BLOCK_SIZE) << order) < size) { ++order; }
+    return order;
+}
+
+bool BufferAllocator::CreatePool(Uint32 minimumOrder, Uint32& outPoolIndex) {
+    // Allocations bigger than the pool size get a dedicated pool
+    const Uint32 maxOrder = SDL_max(poolOrder, minimumOrder);
+    const Uint32 blockCount = 1u << maxOrder;
+
+    SDL_GPUBufferCreateInfo createInfo {
+        .usage = usage,
+        .size = blockCount * MIN_BLOCK_SIZE
+    };
+    SDL_GPUBuffer* buffer = SDL_CreateGPUBuffer(device, &createInfo);
+    if (buffer == nullptr) {
+        SDL_Log("%s: CreateGPUBuffer failed: %s", name.c_str(), SDL_GetError());
+        return false;
+    }
+    SDL_SetGPUBufferName(device, buffer, name.c_str());
+
+    Uint32 poolIndex = 0;
+    while (poolIndex < pools.size() && pools[poolIndex].buffer != nullptr) { ++poolIndex; }
+    if (poolIndex == pools.size()) { pools.emplace_back(); }
+    Pool& pool = pools[poolIndex];
+    pool.buffer = buffer;
+    pool.maxOrder = maxOrder;
+    pool.freeOrder.assign(blockCount, NOT_FREE);
+    pool.nextFree.assign(blockCount, NONE);
+    pool.previousFree.assign(blockCount, NONE);
+    pool.freeHeads.assign(maxOrder + 1, NONE);
+    PushFree(pool, 0, maxOrder);
+    outPoolIndex = poolIndex;
+    return true;
+}
+
+bool BufferAllocator::AllocateFromPool(Pool& pool, Uint32 order, Uint32& outBlockIndex) {
+    if (pool.buffer == nullptr) { return false; }
+    // Smallest free block that fits
+    Uint32 freeOrder = order;
+    while (freeOrder <= pool.maxOrder && pool.freeHeads[freeOrder] == NONE) { ++freeOrder; }
+    if (freeOrder > pool.maxOrder) { return false; }
+
+    const Uint32 blockIndex = pool.freeHeads[freeOrder];
+    RemoveFree(pool, blockIndex, freeOrder);
+
+    // Split it, keeping the first half and freeing the second one
+    while (freeOrder > order) {
+        --freeOrder;
+        PushFree(pool, blockIndex + (1u << freeOrder), freeOrder);
+    }
+    outBlockIndex = blockIndex;
+    return true;
+}
+
+void BufferAllocator::FreeToPool(Pool& pool, Uint32 blockIndex, Uint32 order) {
+    // Merge with the buddy as long as it is free at the same order
+    while (order < pool.maxOrder) {
+        const Uint32 buddyIndex = blockIndex ^ (1u << order);
+        if (pool.freeOrder[buddyIndex] != order) { break; }
+        RemoveFree(pool, buddyIndex, order);
+        blockIndex = SDL_min(blockIndex, buddyIndex);
+        ++order;
+    }
+    PushFree(pool, blockIndex, order);
+}
+
+void BufferAllocator::PushFree(Pool& pool, Uint32 blockIndex, Uint32 order) {
+    pool.freeOrder[blockIndex] = static_cast<Uint8>(order);
+    pool.previousFree[blockIndex] = NONE;
+    pool.nextFree[blockIndex] = pool.freeHeads[order];
+    if (pool.freeHeads[order] != NONE) { pool.previousFree[pool.freeHeads[order]] = blockIndex; }
+    pool.freeHeads[order] = blockIndex;
+}
+
+void BufferAllocator::RemoveFree(Pool& pool, Uint32 blockIndex, Uint32 order) {
+    const Uint32 next = pool.nextFree[blockIndex];
+    const Uint32 previous = pool.previousFree[blockIndex];
+    if (previous != NONE) { pool.nextFree[previous] = next; }
+    else { pool.freeHeads[order] = next; }
+    if (next != NONE) { pool.previousFree[next] = previous; }
+    pool.freeOrder[blockIndex] = NOT_FREE;
+}
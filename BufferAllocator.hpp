@@ -0,0 +1,113 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef BUFFERALLOCATOR_HPP
+#define BUFFERALLOCATOR_HPP
+
+#include <SDL3/SDL_gpu.h>
+#include <deque>
+#include <string>
+#include <vector>
+#include "DeferredReleaseQueue.hpp"
+
+using std::deque;
+using std::string;
+using std::vector;
+
+class BufferAllocator;
+
+enum class BufferUsageClass {
+    Vertex,
+    Index,
+    Storage // Storage buffers are bound whole: shaders must be given the allocation offset
+};
+
+/*
+ * A range of a large shared GPU buffer.
+ * Bind it with its offset, and never upload to it with cycle = true: cycling would discard the other allocations.
+ */
+struct BufferAllocation {
+    SDL_GPUBuffer* buffer { nullptr };
+    Uint32 offset { 0 };
+    Uint32 size { 0 };
+
+    BufferAllocator* owner { nullptr };
+    Uint32 poolIndex { 0 };
+    Uint32 order { 0 };
+
+    bool IsValid() const { return buffer != nullptr; }
+};
+
+/*
+ * Buddy sub-allocator over a few large GPU buffers of one usage class.
+ * Blocks are powers of two from MIN_BLOCK_SIZE to the pool size, so offsets are always aligned on the block size.
+ * A new pool is created when no existing one has room. Allocations bigger than the pool size get a dedicated pool,
+ * which is released once it is empty again, so that a large temporary allocation does not keep its memory.
+ * Frees are deferred until the frame they were requested in has retired on the GPU.
+ */
+class BufferAllocator {
+public:
+    static constexpr Uint32 MIN_BLOCK_SIZE = 256;
+    static constexpr Uint32 DEFAULT_POOL_SIZE = 4 * 1024 * 1024;
+
+    void Init(SDL_GPUDevice* device, SDL_GPUBufferUsageFlags usage, const string& name,
+              Uint32 poolSize = DEFAULT_POOL_SIZE);
+
+    BufferAllocation Allocate(Uint32 size);
+
+    // The range is given back once frame has retired
+    void Free(BufferAllocation& allocation, Uint64 frame);
+
+    // Give back the ranges freed in frames before completedFrameCount. Dedicated pools left empty are pushed to
+    // releaseQueue at frame.
+    void Retire(Uint64 completedFrameCount, DeferredReleaseQueue& releaseQueue, Uint64 frame);
+
+    // Release the GPU buffers. The GPU must be idle.
+    void Close();
+
+    Uint32 GetLiveAllocationCount() const { return liveAllocationCount; }
+    Uint32 GetPoolCount() const;
+    Uint64 GetPoolBytes() const;
+
+private:
+    static constexpr Uint32 NONE = 0xFFFFFFFF;
+    static constexpr Uint8 NOT_FREE = 0xFF;
+
+    // Block indices are in MIN_BLOCK_SIZE units. A block of order k is MIN_BLOCK_SIZE << k bytes.
+    // A released pool has no buffer, its slot is reused by the next pool so that pool indices stay valid.
+    struct Pool {
+        SDL_GPUBuffer* buffer { nullptr };
+        Uint32 maxOrder { 0 };
+        vector<Uint8> freeOrder;     // Order of the free block starting at this index, or NOT_FREE
+        vector<Uint32> nextFree;     // Free lists are intrusive doubly linked lists, one per order
+        vector<Uint32> previousFree;
+        vector<Uint32> freeHeads;
+    };
+
+    struct PendingFree {
+        Uint32 poolIndex;
+        Uint32 blockIndex;
+        Uint32 order;
+        Uint64 frame;
+    };
+
+    static Uint32 OrderForSize(Uint32 size);
+
+    bool CreatePool(Uint32 minimumOrder, Uint32& outPoolIndex);
+    bool AllocateFromPool(Pool& pool, Uint32 order, Uint32& outBlockIndex);
+    void FreeToPool(Pool& pool, Uint32 blockIndex, Uint32 order);
+    void PushFree(Pool& pool, Uint32 blockIndex, Uint32 order);
+    void RemoveFree(Pool& pool, Uint32 blockIndex, Uint32 order);
+
+    SDL_GPUDevice* device { nullptr };
+    SDL_GPUBufferUsageFlags usage { 0 };
+    string name;
+    Uint32 poolOrder { 0 };
+    vector<Pool> pools;
+    deque<PendingFree> pendingFrees;
+    Uint32 liveAllocationCount { 0 };
+};
+
+
+#endif //BUFFERALLOCATOR_HPP
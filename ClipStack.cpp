@@ -0,0 +1,208 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#include "ClipStack.hpp"
+#include "Renderer.hpp"
+#include <SDL3/SDL.h>
+
+void ClipStack::Load(Renderer& renderer, const char* basePath, SDL_GPUTextureFormat colorFormat) {
+    SDL_GPUShader* vertexShader = renderer.LoadShader(basePath, "RoundedRect.vert", 0, 1, 0, 0);
+    SDL_GPUShader* fragmentShader = renderer.LoadShader(basePath, "RoundedRect.frag", 0, 1, 0, 0);
+
+    // Masks only write the stencil
+    SDL_GPUColorTargetDescription colorTarget {
+        .format = colorFormat,
+        .blend_state = SDL_GPUColorTargetBlendState {
+            .color_write_mask = 0,
+            .enable_color_write_mask = true,
+        }
+    };
+    // Only where the current clip passes, so that nested masks are intersected
+    SDL_GPUStencilOpState pushStencilState {
+        .fail_op = SDL_GPU_STENCILOP_KEEP,
+        .pass_op = SDL_GPU_STENCILOP_INCREMENT_AND_CLAMP,
+        .depth_fail_op = SDL_GPU_STENCILOP_KEEP,
+        .compare_op = SDL_GPU_COMPAREOP_EQUAL
+    };
+    SDL_GPUGraphicsPipelineCreateInfo pipelineCreateInfo = {
+        .vertex_shader = vertexShader,
+        .fragment_shader = fragmentShader,
+        .primitive_type = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST,
+        .depth_stencil_state = SDL_GPUDepthStencilState {
+            .back_stencil_state = pushStencilState,
+            .front_stencil_state = pushStencilState,
+            .compare_mask = 0xFF,
+            .write_mask = 0xFF,
+            .enable_stencil_test = true,
+        },
+        .target_info = {
+            .color_target_descriptions = &colorTarget,
+            .num_color_targets = 1,
+            .depth_stencil_format = renderer.GetDepthStencilFormat(),
+            .has_depth_stencil_target = true,
+        },
+    };
+    pushPipeline = renderer.CreateGPUGraphicsPipeline(pipelineCreateInfo);
+
+    // Inside the mask being popped, back to the enclosing level
+    SDL_GPUStencilOpState popStencilState = pushStencilState;
+    popStencilState.pass_op = SDL_GPU_STENCILOP_DECREMENT_AND_CLAMP;
+    pipelineCreateInfo.depth_stencil_state.back_stencil_state = popStencilState;
+    pipelineCreateInfo.depth_stencil_state.front_stencil_state = popStencilState;
+    popPipeline = renderer.CreateGPUGraphicsPipeline(pipelineCreateInfo);
+
+    renderer.ReleaseShader(vertexShader);
+    renderer.ReleaseShader(fragmentShader);
+}
+
+void ClipStack::Unload(Renderer& renderer) {
+    renderer.ReleaseGraphicsPipeline(pushPipeline);
+    renderer.ReleaseGraphicsPipeline(popPipeline);
+}
+
+void ClipStack::Begin(Renderer& renderer, const Mat4& viewProjection_) {
+    viewProjection = viewProjection_;
+    entries.clear();
+    targetWidth = renderer.swapchainWidth;
+    targetHeight = renderer.swapchainHeight;
+    scissor = SDL_Rect { 0, 0, static_cast<int>(targetWidth), static_cast<int>(targetHeight) };
+    stencilReference = 0;
+    renderer.SetStencilReference(stencilReference);
+}
+
+bool ClipStack::Push(Renderer& renderer, const ClipShape& shape) {
+    Entry entry { ClipType::Scissor, shape, scissor };
+
+    SDL_Rect shapeRect;
+    if (ComputeScissorRect(shape, viewProjection, targetWidth, targetHeight, shapeRect)) {
+        // Cheap path, no draw
+        SDL_Rect intersection;
+        if (!SDL_GetRectIntersection(&scissor, &shapeRect, &intersection)) {
+            intersection = SDL_Rect { scissor.x, scissor.y, 0, 0 };
+        }
+        scissor = intersection;
+        renderer.SetScissorRect(scissor);
+    } else if (stencilReference < MAX_STENCIL_REFERENCE) {
+        entry.type = ClipType::Stencil;
+        renderer.BindGraphicsPipeline(pushPipeline);
+        DrawShape(renderer, viewProjection, shape, SDL_FColor {});
+        ++stencilReference;
+        renderer.SetStencilReference(stencilReference);
+    } else {
+        SDL_Log("ClipStack: more than %u nested masks, the mask is ignored", MAX_STENCIL_REFERENCE);
+        entry.type = ClipType::None;
+    }
+    entries.push_back(entry);
+    return entry.type == ClipType::Stencil;
+}
+
+bool ClipStack::Pop(Renderer& renderer) {
+    if (entries.empty()) {
+        SDL_Log("ClipStack: Pop without Push");
+        return false;
+    }
+    const Entry entry = entries.back();
+    entries.pop_back();
+
+    switch (entry.type) {
+        case ClipType::Scissor:
+            scissor = entry.previousScissor;
+            renderer.SetScissorRect(scissor);
+            break;
+        case ClipType::Stencil:
+            // Same shape and scissor as the push, the stencil goes back to what it was
+            renderer.BindGraphicsPipeline(popPipeline);
+            DrawShape(renderer, viewProjection, entry.shape, SDL_FColor {});
+            --stencilReference;
+            renderer.SetStencilReference(stencilReference);
+            break;
+        case ClipType::None:
+            break;
+    }
+    return entry.type == ClipType::Stencil;
+}
+
+SDL_GPUDepthStencilState ClipStack::GetContentStencilState() {
+    const SDL_GPUStencilOpState stencilState {
+        .fail_op = SDL_GPU_STENCILOP_KEEP,
+        .pass_op = SDL_GPU_STENCILOP_KEEP,
+        .depth_fail_op = SDL_GPU_STENCILOP_KEEP,
+        .compare_op = SDL_GPU_COMPAREOP_EQUAL
+    };
+    return SDL_GPUDepthStencilState {
+        .back_stencil_state = stencilState,
+        .front_stencil_state = stencilState,
+        .compare_mask = 0xFF,
+        .write_mask = 0,
+        .enable_stencil_test = true,
+    };
+}
+
+void ClipStack::DrawShape(Renderer& renderer, const Mat4& viewProjection, const ClipShape& shape,
+                          const SDL_FColor& color) {
+    const RoundedRectVertexUniforms vertexUniforms {
+        .viewProjection = viewProjection,
+        .centerX = shape.centerX,
+        .centerY = shape.centerY,
+        .halfWidth = shape.halfWidth,
+        .halfHeight = shape.halfHeight,
+        .rotation = shape.rotation,
+    };
+    const RoundedRectFragmentUniforms fragmentUniforms {
+        .color = color,
+        .halfWidth = shape.halfWidth,
+        .halfHeight = shape.halfHeight,
+        .cornerRadius = SDL_min(shape.cornerRadius, SDL_min(shape.halfWidth, shape.halfHeight)),
+    };
+    renderer.PushVertexUniformData(0, &vertexUniforms, sizeof(vertexUniforms));
+    renderer.PushFragmentUniformData(0, &fragmentUniforms, sizeof(fragmentUniforms));
+    renderer.DrawPrimitives(6, 1, 0, 0);
+}
+
+bool ClipStack::ComputeScissorRect(const ClipShape& shape, const Mat4& viewProjection, Uint32 targetWidth,
+                                   Uint32 targetHeight, SDL_Rect& outRect) {
+    if (shape.cornerRadius > 0) { return false; }
+
+    // Corners in target pixels, y down
+    const float c = SDL_cosf(shape.rotation);
+    const float s = SDL_sinf(shape.rotation);
+    const float width = static_cast<float>(targetWidth);
+    const float height = static_cast<float>(targetHeight);
+    float xs[4];
+    float ys[4];
+    for (int i = 0; i < 4; ++i) {
+        const float localX = (i & 1) ? shape.halfWidth : -shape.halfWidth;
+        const float localY = (i & 2) ? shape.halfHeight : -shape.halfHeight;
+        const float x = shape.centerX + localX * c - localY * s;
+        const float y = shape.centerY + localX * s + localY * c;
+        // Row vectors: translation is in the fourth row
+        const float clipX = x * viewProjection.m0 + y * viewProjection.m1 + viewProjection.m3;
+        const float clipY = x * viewProjection.m4 + y * viewProjection.m5 + viewProjection.m7;
+        const float clipW = x * viewProjection.m12 + y * viewProjection.m13 + viewProjection.m15;
+        if (clipW <= 0) { return false; }
+        xs[i] = (clipX / clipW + 1.0f) * 0.5f * width;
+        ys[i] = (1.0f - clipY / clipW) * 0.5f * height;
+    }
+
+    const float minX = SDL_min(SDL_min(xs[0], xs[1]), SDL_min(xs[2], xs[3]));
+    const float maxX = SDL_max(SDL_max(xs[0], xs[1]), SDL_max(xs[2], xs[3]));
+    const float minY = SDL_min(SDL_min(ys[0], ys[1]), SDL_min(ys[2], ys[3]));
+    const float maxY = SDL_max(SDL_max(ys[0], ys[1]), SDL_max(ys[2], ys[3]));
+    // Axis aligned: every corner is on a side of the bounds on both axes
+    constexpr float tolerance = 0.01f; // Pixels
+    for (int i = 0; i < 4; ++i) {
+        const bool isOnVerticalSide = SDL_fabsf(xs[i] - minX) <= tolerance || SDL_fabsf(xs[i] - maxX) <= tolerance;
+        const bool isOnHorizontalSide = SDL_fabsf(ys[i] - minY) <= tolerance
+                                        || SDL_fabsf(ys[i] - maxY) <= tolerance;
+        if (!isOnVerticalSide || !isOnHorizontalSide) { return false; }
+    }
+
+    // Rounded like the rasterizer: pixels whose center is inside
+    const int left = static_cast<int>(SDL_roundf(minX));
+    const int top = static_cast<int>(SDL_roundf(minY));
+    const int right = static_cast<int>(SDL_roundf(maxX));
+    const int bottom = static_cast<int>(SDL_roundf(maxY));
+    outRect = SDL_Rect { left, top, right - left, bottom - top };
+    return true;
+}
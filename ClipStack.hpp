@@ -0,0 +1,108 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef CLIPSTACK_HPP
+#define CLIPSTACK_HPP
+
+#include <SDL3/SDL_gpu.h>
+#include <SDL3/SDL_rect.h>
+#include <vector>
+#include "Mat4.hpp"
+
+using std::vector;
+
+class Renderer;
+
+// Rotated rectangle with rounded corners, in the space of the view projection
+struct ClipShape {
+    float centerX { 0 };
+    float centerY { 0 };
+    float halfWidth { 0 };
+    float halfHeight { 0 };
+    float rotation { 0 }; // Radians
+    float cornerRadius { 0 };
+};
+
+// Uniforms of RoundedRect.vert and RoundedRect.frag
+struct RoundedRectVertexUniforms {
+    Mat4 viewProjection;
+    float centerX, centerY;
+    float halfWidth, halfHeight;
+    float rotation;
+    float padding[3];
+};
+
+struct RoundedRectFragmentUniforms {
+    SDL_FColor color;
+    float halfWidth, halfHeight;
+    float cornerRadius;
+    float padding;
+};
+
+/*
+ * Nested clipping for UI panels and sprite regions, in a render pass begun with Renderer::BeginWithDepthStencil.
+ *
+ * Axis aligned rectangles only narrow the scissor rect. Other shapes are masks drawn in the stencil: a push
+ * increments the stencil where the shape covers the current clip, a pop decrements it back, and the stencil
+ * reference is the nesting depth of the masks. Content drawn with GetContentStencilState passes where the stencil
+ * equals the reference, that is inside every pushed mask.
+ */
+class ClipStack {
+public:
+    void Load(Renderer& renderer, const char* basePath, SDL_GPUTextureFormat colorFormat);
+
+    void Unload(Renderer& renderer);
+
+    // Start of a render pass: nothing is clipped. Shapes are in the space of viewProjection.
+    void Begin(Renderer& renderer, const Mat4& viewProjection);
+
+    // Clip to the shape, inside the current clip. Returns true if a mask was drawn: its pipeline is bound, the
+    // content pipeline must be bound again.
+    bool Push(Renderer& renderer, const ClipShape& shape);
+
+    // Same return value as Push
+    bool Pop(Renderer& renderer);
+
+    Uint32 GetDepth() const { return static_cast<Uint32>(entries.size()); }
+
+    Uint8 GetStencilReference() const { return stencilReference; }
+
+    // Stencil test of the pipelines drawing clipped content
+    static SDL_GPUDepthStencilState GetContentStencilState();
+
+    // Draw the shape with the RoundedRect shaders, with a pipeline bound by the caller
+    static void DrawShape(Renderer& renderer, const Mat4& viewProjection, const ClipShape& shape,
+                          const SDL_FColor& color);
+
+    // Scissor rect of the shape in a target of the given size, if the shape projects to an axis aligned rectangle
+    static bool ComputeScissorRect(const ClipShape& shape, const Mat4& viewProjection, Uint32 targetWidth,
+                                   Uint32 targetHeight, SDL_Rect& outRect);
+
+    static constexpr Uint8 MAX_STENCIL_REFERENCE = 255;
+
+private:
+    enum class ClipType {
+        Scissor,
+        Stencil,
+        None // Stencil full, the shape is ignored
+    };
+
+    struct Entry {
+        ClipType type;
+        ClipShape shape;
+        SDL_Rect previousScissor;
+    };
+
+    SDL_GPUGraphicsPipeline* pushPipeline { nullptr };
+    SDL_GPUGraphicsPipeline* popPipeline { nullptr };
+    vector<Entry> entries;
+    Mat4 viewProjection;
+    SDL_Rect scissor {};
+    Uint32 targetWidth { 0 };
+    Uint32 targetHeight { 0 };
+    Uint8 stencilReference { 0 };
+};
+
+
+#endif //CLIPSTACK_HPP
@@ -0,0 +1,51 @@
+// Frustum cull instances against their bounding sphere, compact the visible instance indices and count them
+// in the instance count of an indexed indirect draw command. Must match FrustumCulling::CullInstances.
+struct InstanceData
+{
+    float4x4 Transform;
+    float4 Color;
+};
+
+cbuffer CullUniforms : register(b0, space2)
+{
+    float4 Planes[6] : packoffset(c0);
+    uint InstanceCount : packoffset(c6.x);
+    float LocalRadius : packoffset(c6.y);
+};
+
+StructuredBuffer<InstanceData> Instances : register(t0, space0);
+RWStructuredBuffer<uint> VisibleInstances : register(u0, space1);
+// num_indices, num_instances, first_index, vertex_offset, first_instance
+RWStructuredBuffer<uint> DrawCommand : register(u1, space1);
+
+[numthreads(64, 1, 1)]
+void main(uint3 GlobalInvocationID : SV_DispatchThreadID)
+{
+    uint n = GlobalInvocationID.x;
+    if (n >= InstanceCount)
+    {
+        return;
+    }
+
+    float4x4 transform = Instances[n].Transform;
+    float3 center = float3(transform[0][3], transform[1][3], transform[2][3]);
+    float scaleX = dot(float3(transform[0][0], transform[1][0], transform[2][0]),
+                       float3(transform[0][0], transform[1][0], transform[2][0]));
+    float scaleY = dot(float3(transform[0][1], transform[1][1], transform[2][1]),
+                       float3(transform[0][1], transform[1][1], transform[2][1]));
+    float scaleZ = dot(float3(transform[0][2], transform[1][2], transform[2][2]),
+                       float3(transform[0][2], transform[1][2], transform[2][2]));
+    float radius = LocalRadius * sqrt(max(scaleX, max(scaleY, scaleZ)));
+
+    for (uint i = 0; i < 6; ++i)
+    {
+        if (dot(Planes[i].xyz, center) + Planes[i].w < -radius)
+        {
+            return;
+        }
+    }
+
+    uint slot;
+    InterlockedAdd(DrawCommand[1], 1, slot);
+    VisibleInstances[slot] = n;
+}
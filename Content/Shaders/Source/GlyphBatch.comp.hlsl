@@ -0,0 +1,55 @@
+// Same instances as SpriteBatch.comp, padding holds the glyph cell and the font mode (0 bitmap, 1 SDF, 2 solid)
+struct GlyphComputeData
+{
+    float3 position;
+    float rotation;
+    float2 scale;
+    float2 glyph;
+    float4 color;
+};
+
+struct GlyphVertex
+{
+    float4 position;
+    float4 texcoord; // Atlas uv, font mode
+    float4 color;
+};
+
+// Must match GlyphAtlas
+static const uint Columns = 16;
+static const float2 CellUvSize = float2(1.0f / 16.0f, 1.0f / 6.0f);
+
+cbuffer Bounds : register(b0, space2)
+{
+    uint4 DispatchSize : packoffset(c0);
+};
+
+StructuredBuffer<GlyphComputeData> ComputeBuffer : register(t0, space0);
+RWStructuredBuffer<GlyphVertex> vertexBuffer : register(u0, space1);
+
+[numthreads(64, 1, 1)]
+void main(uint3 GlobalInvocationID : SV_DispatchThreadID)
+{
+    uint n = GlobalInvocationID.x;
+    if (n >= DispatchSize.x)
+    {
+        return;
+    }
+
+    GlyphComputeData glyph = ComputeBuffer[n];
+    float c = cos(glyph.rotation);
+    float s = sin(glyph.rotation);
+    uint cell = (uint)glyph.glyph.x;
+    float2 cellUv = float2(cell % Columns, cell / Columns) * CellUvSize;
+
+    // Top left, top right, bottom left, bottom right
+    for (uint i = 0; i < 4; ++i)
+    {
+        float2 corner = float2(i & 1, i >> 1);
+        float2 offset = corner * glyph.scale;
+        float2 position = glyph.position.xy + float2(offset.x * c - offset.y * s, offset.x * s + offset.y * c);
+        vertexBuffer[n * 4u + i].position = float4(position, glyph.position.z, 1.0f);
+        vertexBuffer[n * 4u + i].texcoord = float4(cellUv + corner * CellUvSize, glyph.glyph.y, 0.0f);
+        vertexBuffer[n * 4u + i].color = glyph.color;
+    }
+}
@@ -19,6 +19,10 @@ void main(uint3 GlobalInvocationID : SV_DispatchThreadID)
     float w, h;
     OutImage.GetDimensions(w, h);
     float2 size = float2(w, h);
+    if (GlobalInvocationID.x >= uint(w) || GlobalInvocationID.y >= uint(h))
+    {
+        return;
+    }
     float2 coord = float2(GlobalInvocationID.xy);
     float2 uv = coord / size;
 
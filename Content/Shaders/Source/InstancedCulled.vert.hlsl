@@ -0,0 +1,39 @@
+// Same as InstancedTransform.vert, for instances compacted by FrustumCull.comp:
+// the instance id indexes the visible list, which holds indices into the instance buffer
+struct InstanceData
+{
+    float4x4 Transform;
+    float4 Color;
+};
+
+StructuredBuffer<InstanceData> Instances : register(t0, space0);
+StructuredBuffer<uint> VisibleInstances : register(t1, space0);
+
+cbuffer UniformBlock : register(b0, space1)
+{
+    float4x4 ViewProjection : packoffset(c0);
+};
+
+struct Input
+{
+    float3 Position : TEXCOORD0;
+    float2 TexCoord : TEXCOORD1;
+    uint InstanceIndex : SV_InstanceID;
+};
+
+struct Output
+{
+    float2 TexCoord : TEXCOORD0;
+    float4 Color : TEXCOORD1;
+    float4 Position : SV_Position;
+};
+
+Output main(Input input)
+{
+    InstanceData instance = Instances[VisibleInstances[input.InstanceIndex]];
+    Output output;
+    output.TexCoord = input.TexCoord;
+    output.Color = instance.Color;
+    output.Position = mul(ViewProjection, mul(instance.Transform, float4(input.Position, 1.0f)));
+    return output;
+}
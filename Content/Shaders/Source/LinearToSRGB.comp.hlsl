@@ -9,6 +9,13 @@ float3 LinearToSRGB(float3 color)
 [numthreads(8, 8, 1)]
 void main(uint3 GlobalInvocationID : SV_DispatchThreadID)
 {
+    uint width, height;
+    OutImage.GetDimensions(width, height);
+    if (GlobalInvocationID.x >= width || GlobalInvocationID.y >= height)
+    {
+        return;
+    }
+
     int2 coord = int2(GlobalInvocationID.xy);
     float4 inPixel = InImage[coord];
     float3 param = inPixel.xyz;
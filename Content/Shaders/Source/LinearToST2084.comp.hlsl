@@ -22,6 +22,13 @@ float4 ConvertToHDR10(float4 hdrSceneValue, float paperWhiteNits)
 [numthreads(8, 8, 1)]
 void main(uint3 GlobalInvocationID : SV_DispatchThreadID)
 {
+    uint width, height;
+    OutImage.GetDimensions(width, height);
+    if (GlobalInvocationID.x >= width || GlobalInvocationID.y >= height)
+    {
+        return;
+    }
+
     int2 coord = int2(GlobalInvocationID.xy);
     float4 inPixel = InImage[coord];
     OutImage[coord] = ConvertToHDR10(inPixel, 200.0f);
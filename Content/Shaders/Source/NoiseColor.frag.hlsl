@@ -0,0 +1,46 @@
+// Deliberately expensive: many octaves of value noise per pixel, so that overdraw shows in the frame time
+cbuffer UniformBlock : register(b0, space3)
+{
+    float4 Tint : packoffset(c0);
+    float Time : packoffset(c1.x);
+};
+
+static const int OCTAVE_COUNT = 6;
+static const int LAYER_COUNT = 8;
+
+float Hash(float2 p)
+{
+    return frac(sin(dot(p, float2(127.1f, 311.7f))) * 43758.5453f);
+}
+
+float Noise(float2 p)
+{
+    float2 cell = floor(p);
+    float2 f = frac(p);
+    float2 u = f * f * (3.0f - 2.0f * f);
+    float a = Hash(cell);
+    float b = Hash(cell + float2(1.0f, 0.0f));
+    float c = Hash(cell + float2(0.0f, 1.0f));
+    float d = Hash(cell + float2(1.0f, 1.0f));
+    return lerp(lerp(a, b, u.x), lerp(c, d, u.x), u.y);
+}
+
+float4 main(float4 Color : TEXCOORD0, float4 Position : SV_Position) : SV_Target0
+{
+    float value = 0.0f;
+    [loop]
+    for (int layer = 0; layer < LAYER_COUNT; ++layer)
+    {
+        float2 p = Position.xy / 96.0f + float2(layer * 17.3f + Time, layer * 5.1f);
+        float amplitude = 0.5f;
+        [loop]
+        for (int octave = 0; octave < OCTAVE_COUNT; ++octave)
+        {
+            value += amplitude * Noise(p);
+            p *= 2.0f;
+            amplitude *= 0.5f;
+        }
+    }
+    value /= LAYER_COUNT;
+    return float4(Color.rgb * Tint.rgb * (0.4f + value), 1.0f);
+}
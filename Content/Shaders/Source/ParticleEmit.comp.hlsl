@@ -0,0 +1,84 @@
+// Spawn particles in dead slots popped from the dead list. Must match ParticleSimulation::Emit, except for the
+// random numbers, which come from a hash of the seed and the thread index.
+struct Particle
+{
+    float2 Position;
+    float2 Velocity;
+    float Rotation;
+    float AngularVelocity;
+    float Age;
+    float Lifetime;
+    float4 Color;
+    float Size;
+    float3 Padding;
+};
+
+cbuffer EmitUniforms : register(b0, space2)
+{
+    float2 EmitterPosition : packoffset(c0.x);
+    float Direction : packoffset(c0.z);
+    float Spread : packoffset(c0.w);
+    float2 SpeedRange : packoffset(c1.x);
+    float2 LifetimeRange : packoffset(c1.z);
+    float Size : packoffset(c2.x);
+    float AngularSpeedMax : packoffset(c2.y);
+    uint EmitCount : packoffset(c2.z);
+    uint Seed : packoffset(c2.w);
+    float4 Color : packoffset(c3);
+};
+
+RWStructuredBuffer<Particle> Particles : register(u0, space1);
+RWStructuredBuffer<uint> DeadList : register(u1, space1);
+RWStructuredBuffer<int> DeadCount : register(u2, space1);
+
+// PCG hash
+uint Hash(uint value)
+{
+    uint state = value * 747796405u + 2891336453u;
+    uint word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+    return (word >> 22u) ^ word;
+}
+
+// In [min, max), from the 24 high bits like Random::NextFloat
+float NextFloat(inout uint state, float minimum, float maximum)
+{
+    state = Hash(state);
+    return minimum + float(state >> 8) * ((1.0f / 16777216.0f) * (maximum - minimum));
+}
+
+[numthreads(64, 1, 1)]
+void main(uint3 GlobalInvocationID : SV_DispatchThreadID)
+{
+    uint n = GlobalInvocationID.x;
+    if (n >= EmitCount)
+    {
+        return;
+    }
+
+    // Pop a dead index. Threads that find the list empty give their decrement back: the count only goes
+    // below zero once every index has been handed out, so no index is handed out twice.
+    int previousCount;
+    InterlockedAdd(DeadCount[0], -1, previousCount);
+    if (previousCount <= 0)
+    {
+        InterlockedAdd(DeadCount[0], 1);
+        return;
+    }
+    uint index = DeadList[previousCount - 1];
+
+    uint random = Hash(Seed ^ Hash(n));
+    float angle = Direction + NextFloat(random, -Spread, Spread);
+    float speed = NextFloat(random, SpeedRange.x, SpeedRange.y);
+
+    Particle particle;
+    particle.Position = EmitterPosition;
+    particle.Velocity = float2(cos(angle), sin(angle)) * speed;
+    particle.Rotation = NextFloat(random, 0.0f, 6.28318530718f);
+    particle.AngularVelocity = NextFloat(random, -AngularSpeedMax, AngularSpeedMax);
+    particle.Age = 0.0f;
+    particle.Lifetime = NextFloat(random, LifetimeRange.x, LifetimeRange.y);
+    particle.Color = Color;
+    particle.Size = Size;
+    particle.Padding = float3(0.0f, 0.0f, 0.0f);
+    Particles[index] = particle;
+}
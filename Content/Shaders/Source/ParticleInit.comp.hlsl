@@ -0,0 +1,42 @@
+// Kill every particle and put every index on the dead list. Must match ParticleSimulation.hpp.
+struct Particle
+{
+    float2 Position;
+    float2 Velocity;
+    float Rotation;
+    float AngularVelocity;
+    float Age;
+    float Lifetime;
+    float4 Color;
+    float Size;
+    float3 Padding;
+};
+
+cbuffer Bounds : register(b0, space2)
+{
+    uint4 DispatchSize : packoffset(c0);
+};
+
+RWStructuredBuffer<Particle> Particles : register(u0, space1);
+RWStructuredBuffer<uint> DeadList : register(u1, space1);
+RWStructuredBuffer<int> DeadCount : register(u2, space1);
+
+[numthreads(64, 1, 1)]
+void main(uint3 GlobalInvocationID : SV_DispatchThreadID)
+{
+    uint n = GlobalInvocationID.x;
+    if (n >= DispatchSize.x)
+    {
+        return;
+    }
+
+    // Age >= Lifetime: dead
+    Particles[n].Age = 0.0f;
+    Particles[n].Lifetime = 0.0f;
+    // Reversed, so that the first particles are emitted first
+    DeadList[n] = DispatchSize.x - 1 - n;
+    if (n == 0)
+    {
+        DeadCount[0] = int(DispatchSize.x);
+    }
+}
@@ -0,0 +1,64 @@
+// Integrate the alive particles, push the ones that die on the dead list, and compact the alive indices, counted
+// in the instance count of an indirect draw command. Must match ParticleSimulation::Simulate.
+struct Particle
+{
+    float2 Position;
+    float2 Velocity;
+    float Rotation;
+    float AngularVelocity;
+    float Age;
+    float Lifetime;
+    float4 Color;
+    float Size;
+    float3 Padding;
+};
+
+cbuffer SimulateUniforms : register(b0, space2)
+{
+    float DeltaTime : packoffset(c0.x);
+    float2 Gravity : packoffset(c0.y);
+    float Damping : packoffset(c0.w);
+    uint Capacity : packoffset(c1.x);
+};
+
+RWStructuredBuffer<Particle> Particles : register(u0, space1);
+RWStructuredBuffer<uint> DeadList : register(u1, space1);
+RWStructuredBuffer<int> DeadCount : register(u2, space1);
+RWStructuredBuffer<uint> AliveList : register(u3, space1);
+// num_vertices, num_instances, first_vertex, first_instance
+RWStructuredBuffer<uint> DrawCommand : register(u4, space1);
+
+[numthreads(64, 1, 1)]
+void main(uint3 GlobalInvocationID : SV_DispatchThreadID)
+{
+    uint n = GlobalInvocationID.x;
+    if (n >= Capacity)
+    {
+        return;
+    }
+
+    Particle particle = Particles[n];
+    if (particle.Age >= particle.Lifetime)
+    {
+        return;
+    }
+
+    // Semi-implicit Euler, same operation order as the CPU reference
+    particle.Velocity = (particle.Velocity + Gravity * DeltaTime) * Damping;
+    particle.Position = particle.Position + particle.Velocity * DeltaTime;
+    particle.Rotation = particle.Rotation + particle.AngularVelocity * DeltaTime;
+    particle.Age = particle.Age + DeltaTime;
+    Particles[n] = particle;
+
+    if (particle.Age >= particle.Lifetime)
+    {
+        int slot;
+        InterlockedAdd(DeadCount[0], 1, slot);
+        DeadList[slot] = n;
+        return;
+    }
+
+    uint aliveSlot;
+    InterlockedAdd(DrawCommand[1], 1, aliveSlot);
+    AliveList[aliveSlot] = n;
+}
@@ -0,0 +1,82 @@
+// Expand each alive particle to a sprite quad, like SpriteBatch.comp does for sprites, without a vertex buffer:
+// the instance id indexes the alive list and the vertex id picks the corner. Particles fade out with age.
+struct Particle
+{
+    float2 Position;
+    float2 Velocity;
+    float Rotation;
+    float AngularVelocity;
+    float Age;
+    float Lifetime;
+    float4 Color;
+    float Size;
+    float3 Padding;
+};
+
+StructuredBuffer<Particle> Particles : register(t0, space0);
+StructuredBuffer<uint> AliveParticles : register(t1, space0);
+
+cbuffer UniformBlock : register(b0, space1)
+{
+    float4x4 ViewProjection : packoffset(c0);
+};
+
+struct Input
+{
+    uint VertexIndex : SV_VertexID;
+    uint InstanceIndex : SV_InstanceID;
+};
+
+struct Output
+{
+    float2 TexCoord : TEXCOORD0;
+    float4 Color : TEXCOORD1;
+    float4 Position : SV_Position;
+};
+
+// Two triangles, with the index order of the sprite batch: top left, top right, bottom left, bottom right
+static const uint CornerIndices[6] = { 0, 1, 2, 3, 2, 1 };
+static const float2 Corners[4] = {
+    float2(0.0f, 0.0f),
+    float2(1.0f, 0.0f),
+    float2(0.0f, 1.0f),
+    float2(1.0f, 1.0f)
+};
+
+Output main(Input input)
+{
+    Particle particle = Particles[AliveParticles[input.InstanceIndex]];
+    float2 corner = Corners[CornerIndices[input.VertexIndex]];
+
+    float4x4 Scale = float4x4(
+        float4(particle.Size, 0.0f, 0.0f, 0.0f),
+        float4(0.0f, particle.Size, 0.0f, 0.0f),
+        float4(0.0f, 0.0f, 1.0f, 0.0f),
+        float4(0.0f, 0.0f, 0.0f, 1.0f)
+    );
+
+    float c = cos(particle.Rotation);
+    float s = sin(particle.Rotation);
+
+    float4x4 Rotation = float4x4(
+        float4(   c,    s, 0.0f, 0.0f),
+        float4(  -s,    c, 0.0f, 0.0f),
+        float4(0.0f, 0.0f, 1.0f, 0.0f),
+        float4(0.0f, 0.0f, 0.0f, 1.0f)
+    );
+
+    float4x4 Translation = float4x4(
+        float4(1.0f, 0.0f, 0.0f, 0.0f),
+        float4(0.0f, 1.0f, 0.0f, 0.0f),
+        float4(0.0f, 0.0f, 1.0f, 0.0f),
+        float4(particle.Position.x, particle.Position.y, 0.0f, 1.0f)
+    );
+
+    float4x4 Model = mul(Scale, mul(Rotation, Translation));
+
+    Output output;
+    output.TexCoord = corner;
+    output.Color = float4(particle.Color.rgb, particle.Color.a * (1.0f - particle.Age / particle.Lifetime));
+    output.Position = mul(ViewProjection, mul(float4(corner, 0.0f, 1.0f), Model));
+    return output;
+}
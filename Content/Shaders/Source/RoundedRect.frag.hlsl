@@ -0,0 +1,19 @@
+// Solid rounded rectangle: the fragments outside the rounded corners are discarded, so that stencil masks
+// follow the same shape as the drawn panels
+cbuffer UniformBlock : register(b0, space3)
+{
+    float4 Color : packoffset(c0);
+    float2 HalfSize : packoffset(c1.x);
+    float CornerRadius : packoffset(c1.z);
+};
+
+float4 main(float2 Local : TEXCOORD0) : SV_Target0
+{
+    float2 inner = abs(Local) - (HalfSize - CornerRadius);
+    float distance = length(max(inner, 0.0f)) - CornerRadius;
+    if (distance > 0.0f)
+    {
+        discard;
+    }
+    return Color;
+}
@@ -0,0 +1,38 @@
+// Rotated rectangle expanded from the vertex id, without a vertex buffer. The local position lets the fragment
+// shader round the corners. Used by ClipStack for the stencil masks.
+cbuffer UniformBlock : register(b0, space1)
+{
+    float4x4 ViewProjection : packoffset(c0);
+    float2 Center : packoffset(c4.x);
+    float2 HalfSize : packoffset(c4.z);
+    float Rotation : packoffset(c5.x);
+};
+
+struct Output
+{
+    float2 Local : TEXCOORD0;
+    float4 Position : SV_Position;
+};
+
+// Two triangles: top left, top right, bottom left, then bottom right, bottom left, top right
+static const float2 Corners[6] = {
+    float2(-1.0f, -1.0f),
+    float2( 1.0f, -1.0f),
+    float2(-1.0f,  1.0f),
+    float2( 1.0f,  1.0f),
+    float2(-1.0f,  1.0f),
+    float2( 1.0f, -1.0f)
+};
+
+Output main(uint VertexIndex : SV_VertexID)
+{
+    float2 local = Corners[VertexIndex] * HalfSize;
+    float c = cos(Rotation);
+    float s = sin(Rotation);
+    float2 position = Center + float2(local.x * c - local.y * s, local.x * s + local.y * c);
+
+    Output output;
+    output.Local = local;
+    output.Position = mul(ViewProjection, float4(position, 0.0f, 1.0f));
+    return output;
+}
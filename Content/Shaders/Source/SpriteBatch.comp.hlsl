@@ -13,6 +13,11 @@ struct SpriteVertex
     float4 color;
 };
 
+cbuffer Bounds : register(b0, space2)
+{
+    uint4 DispatchSize : packoffset(c0);
+};
+
 StructuredBuffer<SpriteComputeData> ComputeBuffer : register(t0, space0);
 RWStructuredBuffer<SpriteVertex> vertexBuffer : register(u0, space1);
 
@@ -20,6 +25,10 @@ RWStructuredBuffer<SpriteVertex> vertexBuffer : register(u0, space1);
 void main(uint3 GlobalInvocationID : SV_DispatchThreadID)
 {
     uint n = GlobalInvocationID.x;
+    if (n >= DispatchSize.x)
+    {
+        return;
+    }
 
     SpriteComputeData currentSpriteData = ComputeBuffer[n];
 
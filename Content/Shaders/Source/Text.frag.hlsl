@@ -0,0 +1,24 @@
+// Glyph atlas: coverage in red, signed distance field in green, 0.5 on the edges
+Texture2D<float4> Atlas : register(t0, space2);
+SamplerState Sampler : register(s0, space2);
+
+struct Input
+{
+    float4 TexCoord : TEXCOORD0; // Atlas uv, font mode
+    float4 Color : TEXCOORD1;
+};
+
+float4 main(Input input) : SV_Target0
+{
+    // Both modes are sampled, derivatives stay in uniform control flow
+    float bitmapCoverage = Atlas.Sample(Sampler, input.TexCoord.xy).r;
+    // The distance field is magnified from the full resolution level, whatever the scale
+    float distance = Atlas.SampleLevel(Sampler, input.TexCoord.xy, 0).g;
+    // Antialiased over about one screen pixel
+    float width = max(fwidth(distance) * 0.5f, 0.0001f);
+    float sdfCoverage = smoothstep(0.5f - width, 0.5f + width, distance);
+
+    // Solid rectangles are fully covered
+    float coverage = input.TexCoord.z < 0.5f ? bitmapCoverage : (input.TexCoord.z < 1.5f ? sdfCoverage : 1.0f);
+    return float4(input.Color.rgb, input.Color.a * coverage);
+}
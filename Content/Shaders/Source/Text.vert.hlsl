@@ -0,0 +1,27 @@
+cbuffer UniformBlock : register(b0, space1)
+{
+    float4x4 MatrixTransform : packoffset(c0);
+};
+
+struct Input
+{
+    float4 Position : TEXCOORD0;
+    float4 TexCoord : TEXCOORD1; // Atlas uv, font mode
+    float4 Color : TEXCOORD2;
+};
+
+struct Output
+{
+    float4 TexCoord : TEXCOORD0;
+    float4 Color : TEXCOORD1;
+    float4 Position : SV_Position;
+};
+
+Output main(Input input)
+{
+    Output output;
+    output.TexCoord = input.TexCoord;
+    output.Color = input.Color;
+    output.Position = mul(MatrixTransform, input.Position);
+    return output;
+}
@@ -10,6 +10,13 @@ RWTexture2D<unorm float4> outImage : register(u0, space1);
 [numthreads(8, 8, 1)]
 void main(uint3 GlobalInvocationID : SV_DispatchThreadID)
 {
+    uint width, height;
+    outImage.GetDimensions(width, height);
+    if (GlobalInvocationID.x >= width || GlobalInvocationID.y >= height)
+    {
+        return;
+    }
+
     float w, h;
     inImage.GetDimensions(w, h);
     int2 coord = int2(GlobalInvocationID.xy);
@@ -0,0 +1,33 @@
+// Per draw constants read from a UniformArena storage buffer.
+// The draw id is an instance rate attribute, offset by the first instance of the draw.
+struct DrawConstants
+{
+    float4x4 Transform;
+    float4 MultiplyColor;
+};
+
+StructuredBuffer<DrawConstants> Draws : register(t0, space0);
+
+struct Input
+{
+    float3 Position : TEXCOORD0;
+    float2 TexCoord : TEXCOORD1;
+    uint DrawId : TEXCOORD2;
+};
+
+struct Output
+{
+    float2 TexCoord : TEXCOORD0;
+    float4 Color : TEXCOORD1;
+    float4 Position : SV_Position;
+};
+
+Output main(Input input)
+{
+    DrawConstants constants = Draws[input.DrawId];
+    Output output;
+    output.TexCoord = input.TexCoord;
+    output.Color = constants.MultiplyColor;
+    output.Position = mul(constants.Transform, float4(input.Position, 1.0f));
+    return output;
+}
@@ -18,6 +18,13 @@ float3 aces_fitted(float3 v)
 [numthreads(8, 8, 1)]
 void main(uint3 GlobalInvocationID : SV_DispatchThreadID)
 {
+    uint width, height;
+    outImage.GetDimensions(width, height);
+    if (GlobalInvocationID.x >= width || GlobalInvocationID.y >= height)
+    {
+        return;
+    }
+
     int2 coord = int2(GlobalInvocationID.xy);
     float4 inPixel = inImage[coord];
     float3 outColor = aces_fitted(inPixel.xyz);
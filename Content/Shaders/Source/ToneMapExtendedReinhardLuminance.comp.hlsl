@@ -23,6 +23,13 @@ float3 reinhard_extended_luminance(float3 v, float max_white_l)
 [numthreads(8, 8, 1)]
 void main(uint3 GlobalInvocationID : SV_DispatchThreadID)
 {
+    uint width, height;
+    outImage.GetDimensions(width, height);
+    if (GlobalInvocationID.x >= width || GlobalInvocationID.y >= height)
+    {
+        return;
+    }
+
     int2 coord = int2(GlobalInvocationID.xy);
     float4 inPixel = inImage[coord];
     float3 outColor = reinhard_extended_luminance(inPixel.xyz, 662.0f);
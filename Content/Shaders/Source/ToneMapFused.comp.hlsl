@@ -0,0 +1,115 @@
+Texture2D<float4> InImage : register(t0, space0);
+RWTexture2D<unorm float4> OutImage : register(u0, space1);
+
+cbuffer UBO : register(b0, space2)
+{
+    float Exposure : packoffset(c0.x);
+    uint Operator : packoffset(c0.y);
+    uint Transfer : packoffset(c0.z);
+    float PaperWhiteNits : packoffset(c0.w);
+};
+
+float3 reinhard(float3 v)
+{
+    return v / (1.0f.xxx + v);
+}
+
+float luminance(float3 v)
+{
+    return dot(v, float3(0.2126f, 0.7152f, 0.0722f));
+}
+
+// Same as ToneMapExtendedReinhardLuminance, with l_new / l_old simplified so that black does not divide by 0
+float3 reinhard_extended_luminance(float3 v, float max_white_l)
+{
+    float l_old = luminance(v);
+    float scale = (1.0f + (l_old / (max_white_l * max_white_l))) / (1.0f + l_old);
+    return v * scale;
+}
+
+float3 hable_tonemap_partial(float3 x)
+{
+    float A = 0.15f;
+    float B = 0.50f;
+    float C = 0.10f;
+    float D = 0.20f;
+    float E = 0.02f;
+    float F = 0.30f;
+    return (((x * ((x * A) + (C * B).xxx)) + (D * E).xxx) / ((x * ((x * A) + B.xxx)) + (D * F).xxx)) - (E / F).xxx;
+}
+
+float3 hable_filmic(float3 v)
+{
+    float exposure_bias = 2.0f;
+    float3 curr = hable_tonemap_partial(v * exposure_bias);
+
+    float3 W = 11.2f.xxx;
+    float3 white_scale = 1.0f.xxx / hable_tonemap_partial(W);
+    return curr * white_scale;
+}
+
+float3 rtt_and_odt_fit(float3 v)
+{
+    float3 a = (v * (v + 0.0245786f.xxx)) - 0.000090537f.xxx;
+    float3 b = (v * ((v * 0.983729f) + 0.4329510f.xxx)) + 0.238081f.xxx;
+    return a / b;
+}
+
+float3 aces_fitted(float3 v)
+{
+    v = mul(float3x3(float3(0.59719f, 0.35458f, 0.04823f), float3(0.07600f, 0.90834f, 0.01566f), float3(0.02840f, 0.13383f, 0.83777f)), v);
+    v = rtt_and_odt_fit(v);
+    return mul(float3x3(float3(1.60475f, -0.53108f, -0.07367f), float3(-0.10208f, 1.10813f, -0.00605f), float3(-0.00327f, -0.07276f, 1.07602f)), v);
+}
+
+float3 LinearToSRGB(float3 color)
+{
+    return pow(abs(color), float(1.0f/2.2f).xxx);
+}
+
+float3 LinearToST2084(float3 normalizedLinearValue)
+{
+    return pow((0.8359375f.xxx + (pow(abs(normalizedLinearValue), 0.1593017578125f.xxx) * 18.8515625f)) / (1.0f.xxx + (pow(abs(normalizedLinearValue), 0.1593017578125f.xxx) * 18.6875f)), 78.84375f.xxx);
+}
+
+float3 ConvertToHDR10(float3 hdrSceneValue, float paperWhiteNits)
+{
+    float3 rec2020 = mul(float3x3(float3(0.6274039745330810546875f, 0.329281985759735107421875f, 0.043313600122928619384765625f), float3(0.06909699738025665283203125f, 0.919539988040924072265625f, 0.0113612003624439239501953125f), float3(0.01639159955084323883056640625f, 0.0880132019519805908203125f, 0.895595014095306396484375f)), hdrSceneValue);
+    return LinearToST2084((rec2020 * paperWhiteNits) / 10000.0f.xxx);
+}
+
+// Exposure, tone map and transfer function in one pass: the tone mapped image never goes through memory.
+// Operator and Transfer are uniform for the whole dispatch, so the branches do not diverge.
+[numthreads(16, 16, 1)]
+void main(uint3 GlobalInvocationID : SV_DispatchThreadID)
+{
+    uint width, height;
+    OutImage.GetDimensions(width, height);
+    if (GlobalInvocationID.x >= width || GlobalInvocationID.y >= height)
+    {
+        return;
+    }
+
+    int2 coord = int2(GlobalInvocationID.xy);
+    float3 color = InImage[coord].xyz * Exposure;
+
+    if (Operator == 0u)
+    {
+        color = reinhard(color);
+    }
+    else if (Operator == 1u)
+    {
+        color = reinhard_extended_luminance(color, 662.0f);
+    }
+    else if (Operator == 2u)
+    {
+        color = hable_filmic(color);
+    }
+    else
+    {
+        color = aces_fitted(color);
+    }
+
+    float3 outColor = (Transfer == 0u) ? LinearToSRGB(color) : ConvertToHDR10(color, PaperWhiteNits);
+    OutImage[coord] = float4(outColor, 1.0f);
+}
@@ -25,6 +25,13 @@ float3 hable_filmic(float3 v)
 [numthreads(8, 8, 1)]
 void main(uint3 GlobalInvocationID : SV_DispatchThreadID)
 {
+    uint width, height;
+    outImage.GetDimensions(width, height);
+    if (GlobalInvocationID.x >= width || GlobalInvocationID.y >= height)
+    {
+        return;
+    }
+
     int2 coord = int2(GlobalInvocationID.xy);
     float4 inPixel = inImage[coord];
     float3 outColor = hable_filmic(inPixel.xyz);
@@ -1,4 +1,7 @@
 # Requires shadercross CLI installed from SDL_shadercross
+# Stops at the first failure. On success, records the compiled sources in ../Compiled/Sources.sha256, which CMake
+# checks to warn about shaders whose binaries are missing or out of date.
+set -e
 for filename in *.vert.hlsl; do
     if [ -f "$filename" ]; then
         shadercross "$filename" -o "../Compiled/SPIRV/${filename/.hlsl/.spv}"
@@ -22,3 +25,5 @@ for filename in *.comp.hlsl; do
         shadercross "$filename" -o "../Compiled/DXIL/${filename/.hlsl/.dxil}"
     fi
 done
+
+sha256sum *.hlsl > ../Compiled/Sources.sha256
@@ -0,0 +1,47 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#include "DeferredReleaseQueue.hpp"
+
+void DeferredReleaseQueue::Push(GPUResourceType type, void* resource, Uint64 frame) {
+    if (resource == nullptr) { return; }
+    pending.push_back(PendingRelease { type, resource, frame });
+}
+
+void DeferredReleaseQueue::Retire(SDL_GPUDevice* device, Uint64 completedFrameCount) {
+    while (!pending.empty() && pending.front().frame < completedFrameCount) {
+        Release(device, pending.front());
+        pending.pop_front();
+    }
+}
+
+void DeferredReleaseQueue::Flush(SDL_GPUDevice* device) {
+    for (const PendingRelease& pendingRelease : pending) {
+        Release(device, pendingRelease);
+    }
+    pending.clear();
+}
+
+void DeferredReleaseQueue::Release(SDL_GPUDevice* device, const PendingRelease& pendingRelease) {
+    switch (pendingRelease.type) {
+        case GPUResourceType::Texture:
+            SDL_ReleaseGPUTexture(device, static_cast<SDL_GPUTexture*>(pendingRelease.resource));
+            break;
+        case GPUResourceType::Buffer:
+            SDL_ReleaseGPUBuffer(device, static_cast<SDL_GPUBuffer*>(pendingRelease.resource));
+            break;
+        case GPUResourceType::TransferBuffer:
+            SDL_ReleaseGPUTransferBuffer(device, static_cast<SDL_GPUTransferBuffer*>(pendingRelease.resource));
+            break;
+        case GPUResourceType::Sampler:
+            SDL_ReleaseGPUSampler(device, static_cast<SDL_GPUSampler*>(pendingRelease.resource));
+            break;
+        case GPUResourceType::GraphicsPipeline:
+            SDL_ReleaseGPUGraphicsPipeline(device, static_cast<SDL_GPUGraphicsPipeline*>(pendingRelease.resource));
+            break;
+        case GPUResourceType::ComputePipeline:
+            SDL_ReleaseGPUComputePipeline(device, static_cast<SDL_GPUComputePipeline*>(pendingRelease.resource));
+            break;
+    }
+}
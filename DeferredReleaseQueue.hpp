@@ -0,0 +1,52 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef DEFERREDRELEASEQUEUE_HPP
+#define DEFERREDRELEASEQUEUE_HPP
+
+#include <SDL3/SDL_gpu.h>
+#include <deque>
+
+using std::deque;
+
+enum class GPUResourceType {
+    Texture,
+    Buffer,
+    TransferBuffer,
+    Sampler,
+    GraphicsPipeline,
+    ComputePipeline
+};
+
+/*
+ * GPU resources waiting for the frames that may use them to retire.
+ * A resource pushed while recording frame N is released once frame N is known to be complete on the GPU.
+ */
+class DeferredReleaseQueue {
+public:
+    void Push(GPUResourceType type, void* resource, Uint64 frame);
+
+    // Release the resources of every frame strictly before completedFrameCount
+    void Retire(SDL_GPUDevice* device, Uint64 completedFrameCount);
+
+    // Release everything. The GPU must be idle.
+    void Flush(SDL_GPUDevice* device);
+
+    size_t GetPendingCount() const { return pending.size(); }
+
+private:
+    struct PendingRelease {
+        GPUResourceType type;
+        void* resource;
+        Uint64 frame;
+    };
+
+    static void Release(SDL_GPUDevice* device, const PendingRelease& pendingRelease);
+
+    // Frames only grow, so the queue stays sorted by frame
+    deque<PendingRelease> pending;
+};
+
+
+#endif //DEFERREDRELEASEQUEUE_HPP
@@ -0,0 +1,219 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#include "DrawQueue.hpp"
+#include "Renderer.hpp"
+#include <SDL3/SDL.h>
+
+void DrawQueue::Clear() {
+    packets.clear();
+    entries.clear();
+    uniformBytes.clear();
+}
+
+void DrawQueue::Add(Uint8 pass, float depth, const DrawPacket& packet,
+                    const void* vertexUniform, Uint32 vertexUniformSize,
+                    const void* fragmentUniform, Uint32 fragmentUniformSize) {
+    const Uint8 passIndex = pass % PASS_COUNT;
+    const Uint64 key = MakeSortKey(passIndex, depthOrders[passIndex], GetPipelineId(packet.pipeline),
+                                   GetMaterialId(packet.fragmentSampler), depth);
+    entries.push_back(SortEntry { key, static_cast<Uint32>(packets.size()) });
+    packets.push_back(QueuedPacket {
+        .packet = packet,
+        .depth = depth,
+        .vertexUniformOffset = CopyUniform(vertexUniform, vertexUniformSize),
+        .vertexUniformSize = vertexUniform != nullptr ? vertexUniformSize : 0,
+        .fragmentUniformOffset = CopyUniform(fragmentUniform, fragmentUniformSize),
+        .fragmentUniformSize = fragmentUniform != nullptr ? fragmentUniformSize : 0,
+    });
+}
+
+void DrawQueue::Submit(Renderer& renderer) {
+    RadixSort(entries, scratch);
+
+    const QueuedPacket* previous = nullptr;
+    const SortEntry* passBegin = entries.data();
+    const SortEntry* entriesEnd = entries.data() + entries.size();
+    while (passBegin != entriesEnd) {
+        // Entries are grouped by pass, the most significant bits of their key
+        const Uint8 pass = static_cast<Uint8>(passBegin->key >> 60);
+        const SortEntry* passEnd = passBegin;
+        while (passEnd != entriesEnd && static_cast<Uint8>(passEnd->key >> 60) == pass) { ++passEnd; }
+
+        if (hasDepthPrePass[pass]) {
+            // Strictly front to back: the depth pipelines are few and the draws cheap, occlusion matters more
+            prePassEntries.clear();
+            for (const SortEntry* entry = passBegin; entry != passEnd; ++entry) {
+                const QueuedPacket& queued = packets[entry->index];
+                if (queued.packet.depthPipeline == nullptr) { continue; }
+                prePassEntries.push_back(SortEntry { FloatToSortableBits(queued.depth), entry->index });
+            }
+            RadixSort(prePassEntries, scratch);
+
+            const QueuedPacket* previousDepthOnly = nullptr;
+            Issue(renderer, prePassEntries.data(), prePassEntries.data() + prePassEntries.size(), true,
+                  previousDepthOnly);
+            renderer.RecordDepthPrePassDraws(static_cast<Uint32>(prePassEntries.size()));
+            // The depth pipelines are bound now
+            previous = nullptr;
+        }
+        Issue(renderer, passBegin, passEnd, false, previous);
+        passBegin = passEnd;
+    }
+}
+
+void DrawQueue::Issue(Renderer& renderer, const SortEntry* begin, const SortEntry* end, bool isDepthPrePass,
+                      const QueuedPacket*& previous) {
+    auto getPipeline = [isDepthPrePass](const DrawPacket& packet) {
+        return isDepthPrePass ? packet.depthPipeline : packet.pipeline;
+    };
+
+    Uint32 skippedCount = 0;
+    double coverage = 0;
+    for (const SortEntry* entry = begin; entry != end; ++entry) {
+        const QueuedPacket& queued = packets[entry->index];
+        const DrawPacket& packet = queued.packet;
+
+        if (previous == nullptr || getPipeline(packet) != getPipeline(previous->packet)) {
+            renderer.BindGraphicsPipeline(getPipeline(packet));
+        } else {
+            ++skippedCount;
+        }
+
+        if (previous == nullptr
+            || packet.vertexBuffer.buffer != previous->packet.vertexBuffer.buffer
+            || packet.vertexBuffer.offset != previous->packet.vertexBuffer.offset) {
+            renderer.BindVertexBuffers(0, packet.vertexBuffer, 1);
+        } else {
+            ++skippedCount;
+        }
+
+        if (previous == nullptr
+            || packet.indexBuffer.buffer != previous->packet.indexBuffer.buffer
+            || packet.indexBuffer.offset != previous->packet.indexBuffer.offset
+            || packet.indexElementSize != previous->packet.indexElementSize) {
+            renderer.BindIndexBuffer(packet.indexBuffer, packet.indexElementSize);
+        } else {
+            ++skippedCount;
+        }
+
+        // The depth pipelines do not sample: materials and fragment uniforms wait for the color pass
+        if (packet.fragmentSampler.texture != nullptr && !isDepthPrePass) {
+            if (previous == nullptr
+                || packet.fragmentSampler.texture != previous->packet.fragmentSampler.texture
+                || packet.fragmentSampler.sampler != previous->packet.fragmentSampler.sampler) {
+                renderer.BindFragmentSamplers(0, packet.fragmentSampler, 1);
+            } else {
+                ++skippedCount;
+            }
+        }
+
+        // Uniform data stays with the command buffer, so identical bytes do not need another push
+        if (queued.vertexUniformSize > 0) {
+            if (previous == nullptr || previous->vertexUniformSize != queued.vertexUniformSize
+                || SDL_memcmp(&uniformBytes[previous->vertexUniformOffset], &uniformBytes[queued.vertexUniformOffset],
+                              queued.vertexUniformSize) != 0) {
+                renderer.PushVertexUniformData(0, &uniformBytes[queued.vertexUniformOffset],
+                                               queued.vertexUniformSize);
+            } else {
+                ++skippedCount;
+            }
+        }
+        if (queued.fragmentUniformSize > 0 && !isDepthPrePass) {
+            if (previous == nullptr || previous->fragmentUniformSize != queued.fragmentUniformSize
+                || SDL_memcmp(&uniformBytes[previous->fragmentUniformOffset],
+                              &uniformBytes[queued.fragmentUniformOffset], queued.fragmentUniformSize) != 0) {
+                renderer.PushFragmentUniformData(0, &uniformBytes[queued.fragmentUniformOffset],
+                                                 queued.fragmentUniformSize);
+            } else {
+                ++skippedCount;
+            }
+        }
+
+        renderer.DrawIndexedPrimitives(packet.indexCount, packet.instanceCount, packet.firstIndex,
+                                       packet.vertexOffset, packet.firstInstance);
+        coverage += packet.coverage;
+        previous = &queued;
+    }
+    renderer.RecordSkippedStateChanges(skippedCount);
+    renderer.RecordCoverage(static_cast<Uint64>(coverage), isDepthPrePass);
+}
+
+Uint64 DrawQueue::MakeSortKey(Uint8 pass, DepthOrder order, Uint16 pipelineId, Uint16 materialId, float depth) {
+    const Uint64 passBits = static_cast<Uint64>(pass % PASS_COUNT) << 60;
+    const Uint64 pipelineBits = pipelineId & 0xFFF;
+    const Uint64 depthBits = FloatToSortableBits(depth);
+    if (order == DepthOrder::FrontToBack) {
+        return passBits | (pipelineBits << 48) | (static_cast<Uint64>(materialId) << 32) | depthBits;
+    }
+    return passBits | ((~depthBits & 0xFFFFFFFF) << 28) | (pipelineBits << 16) | materialId;
+}
+
+Uint32 DrawQueue::FloatToSortableBits(float value) {
+    Uint32 bits;
+    SDL_memcpy(&bits, &value, sizeof(bits));
+    // Negative floats have their order reversed: flip all their bits. Positive ones only need the sign bit set.
+    return (bits & 0x80000000) != 0 ? ~bits : bits | 0x80000000;
+}
+
+void DrawQueue::RadixSort(vector<SortEntry>& entries, vector<SortEntry>& scratch) {
+    const size_t count = entries.size();
+    if (count < 2) { return; }
+    scratch.resize(count);
+
+    // All the histograms in one read of the keys
+    Uint32 histograms[8][256] {};
+    for (const SortEntry& entry : entries) {
+        for (Uint32 byte = 0; byte < 8; ++byte) {
+            ++histograms[byte][(entry.key >> (byte * 8)) & 0xFF];
+        }
+    }
+
+    vector<SortEntry>* source = &entries;
+    vector<SortEntry>* destination = &scratch;
+    for (Uint32 byte = 0; byte < 8; ++byte) {
+        Uint32* histogram = histograms[byte];
+        // Every key has the same byte here: this pass would not move anything
+        if (histogram[((*source)[0].key >> (byte * 8)) & 0xFF] == count) { continue; }
+
+        Uint32 offset = 0;
+        for (Uint32 bucket = 0; bucket < 256; ++bucket) {
+            const Uint32 bucketCount = histogram[bucket];
+            histogram[bucket] = offset;
+            offset += bucketCount;
+        }
+        for (const SortEntry& entry : *source) {
+            (*destination)[histogram[(entry.key >> (byte * 8)) & 0xFF]++] = entry;
+        }
+        std::swap(source, destination);
+    }
+    if (source != &entries) {
+        entries.swap(scratch);
+    }
+}
+
+Uint16 DrawQueue::GetPipelineId(SDL_GPUGraphicsPipeline* pipeline) {
+    const auto found = pipelineIds.find(pipeline);
+    if (found != pipelineIds.end()) { return found->second; }
+    const auto id = static_cast<Uint16>(pipelineIds.size());
+    pipelineIds.emplace(pipeline, id);
+    return id;
+}
+
+Uint16 DrawQueue::GetMaterialId(const SDL_GPUTextureSamplerBinding& binding) {
+    const MaterialKey key { binding.texture, binding.sampler };
+    const auto found = materialIds.find(key);
+    if (found != materialIds.end()) { return found->second; }
+    const auto id = static_cast<Uint16>(materialIds.size());
+    materialIds.emplace(key, id);
+    return id;
+}
+
+Uint32 DrawQueue::CopyUniform(const void* data, Uint32 size) {
+    if (data == nullptr || size == 0) { return 0; }
+    const auto offset = static_cast<Uint32>(uniformBytes.size());
+    uniformBytes.resize(offset + size);
+    SDL_memcpy(&uniformBytes[offset], data, size);
+    return offset;
+}
@@ -0,0 +1,138 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef DRAWQUEUE_HPP
+#define DRAWQUEUE_HPP
+
+#include <SDL3/SDL_gpu.h>
+#include <unordered_map>
+#include <vector>
+
+using std::unordered_map;
+using std::vector;
+
+class Renderer;
+
+/*
+ * Everything needed to issue one indexed draw.
+ * The fragment sampler is the material. Uniforms are copied by the queue and pushed at slot 0.
+ */
+struct DrawPacket {
+    SDL_GPUGraphicsPipeline* pipeline { nullptr };
+    SDL_GPUBufferBinding vertexBuffer {};
+    SDL_GPUBufferBinding indexBuffer {};
+    SDL_GPUIndexElementSize indexElementSize { SDL_GPU_INDEXELEMENTSIZE_16BIT };
+    SDL_GPUTextureSamplerBinding fragmentSampler {};
+    Uint32 indexCount { 0 };
+    Uint32 instanceCount { 1 };
+    Uint32 firstIndex { 0 };
+    Sint32 vertexOffset { 0 };
+    Uint32 firstInstance { 0 }; // e.g. a UniformArena draw id
+    // Same vertex input with a depth write and no color write, for the depth pre-pass. Packets without one are
+    // only drawn in the color pass.
+    SDL_GPUGraphicsPipeline* depthPipeline { nullptr };
+    float coverage { 0 }; // Estimated screen area in pixels, summed in the renderer stats
+};
+
+enum class DepthOrder {
+    FrontToBack, // Opaque: closest first, so that hidden fragments fail the depth test
+    BackToFront  // Blended: farthest first, depth sorting beats state sorting
+};
+
+/*
+ * Collects the draws of a render pass, sorts them by a 64 bits key, then issues them without redundant binds.
+ *
+ * Key, from the most significant bits:
+ * - FrontToBack passes: pass (4 bits), pipeline (12 bits), material (16 bits), depth (32 bits)
+ * - BackToFront passes: pass (4 bits), inverted depth (32 bits), pipeline (12 bits), material (16 bits)
+ * Pipeline and material ids are given in order of first use and stay stable across frames.
+ *
+ * Usage per frame: Clear, Add draws in any order, then Submit inside the render pass.
+ *
+ * Passes with a depth pre-pass first draw their packets with the depth pipelines, strictly front to back, then
+ * draw them again in key order. The color pipelines of these passes test with EQUAL or LESS_OR_EQUAL and do not
+ * write depth: the fragment shader then runs at most once per pixel whatever the overdraw.
+ */
+class DrawQueue {
+public:
+    static constexpr Uint32 PASS_COUNT = 16;
+
+    void SetDepthOrder(Uint8 pass, DepthOrder order) { depthOrders[pass % PASS_COUNT] = order; }
+
+    void SetDepthPrePass(Uint8 pass, bool isEnabled) { hasDepthPrePass[pass % PASS_COUNT] = isEnabled; }
+
+    bool HasDepthPrePass(Uint8 pass) const { return hasDepthPrePass[pass % PASS_COUNT]; }
+
+    void Clear();
+
+    // Depth is the view depth of the draw, e.g. its distance to the camera
+    void Add(Uint8 pass, float depth, const DrawPacket& packet,
+             const void* vertexUniform = nullptr, Uint32 vertexUniformSize = 0,
+             const void* fragmentUniform = nullptr, Uint32 fragmentUniformSize = 0);
+
+    // Sort, then issue every draw in the current render pass. Binds equal to the previous ones are skipped and
+    // counted in the renderer stats. The queue does not know what was bound before, so the first draw binds all.
+    void Submit(Renderer& renderer);
+
+    Uint32 GetPacketCount() const { return static_cast<Uint32>(packets.size()); }
+
+    static Uint64 MakeSortKey(Uint8 pass, DepthOrder order, Uint16 pipelineId, Uint16 materialId, float depth);
+
+    // Sortable bits of a float: unsigned order matches float order, negative values included
+    static Uint32 FloatToSortableBits(float value);
+
+    struct SortEntry {
+        Uint64 key;
+        Uint32 index;
+    };
+
+    // Stable LSD radix sort on the key, 8 bits per pass. Passes where every key has the same byte are skipped.
+    // scratch is resized to match.
+    static void RadixSort(vector<SortEntry>& entries, vector<SortEntry>& scratch);
+
+private:
+    struct QueuedPacket {
+        DrawPacket packet;
+        float depth;
+        Uint32 vertexUniformOffset;
+        Uint32 vertexUniformSize;
+        Uint32 fragmentUniformOffset;
+        Uint32 fragmentUniformSize;
+    };
+
+    struct MaterialKey {
+        SDL_GPUTexture* texture;
+        SDL_GPUSampler* sampler;
+        bool operator==(const MaterialKey& other) const = default;
+    };
+
+    struct MaterialKeyHash {
+        size_t operator()(const MaterialKey& key) const {
+            return std::hash<const void*>()(key.texture) ^ (std::hash<const void*>()(key.sampler) << 1);
+        }
+    };
+
+    // Issue the draws of entries, with the depth pipelines for a pre-pass. previous is the last packet issued
+    // with the same kind of pipeline, nullptr to bind everything.
+    void Issue(Renderer& renderer, const SortEntry* begin, const SortEntry* end, bool isDepthPrePass,
+               const QueuedPacket*& previous);
+
+    Uint16 GetPipelineId(SDL_GPUGraphicsPipeline* pipeline);
+    Uint16 GetMaterialId(const SDL_GPUTextureSamplerBinding& binding);
+    Uint32 CopyUniform(const void* data, Uint32 size);
+
+    vector<QueuedPacket> packets;
+    vector<SortEntry> entries;
+    vector<SortEntry> scratch;
+    vector<SortEntry> prePassEntries;
+    vector<Uint8> uniformBytes;
+    DepthOrder depthOrders[PASS_COUNT] {};
+    bool hasDepthPrePass[PASS_COUNT] {};
+
+    unordered_map<SDL_GPUGraphicsPipeline*, Uint16> pipelineIds;
+    unordered_map<MaterialKey, Uint16, MaterialKeyHash> materialIds;
+};
+
+
+#endif //DRAWQUEUE_HPP
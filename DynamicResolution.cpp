@@ -0,0 +1,67 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#include "DynamicResolution.hpp"
+
+void DynamicResolution::SetScaleRange(float newMinScale, float newMaxScale) {
+    minScale = SDL_clamp(newMinScale, 0.1f, 1.0f);
+    maxScale = SDL_clamp(newMaxScale, minScale, 1.0f);
+    ceiling = maxScale;
+    scale = SDL_clamp(scale, minScale, maxScale);
+}
+
+void DynamicResolution::SetEnabled(bool enabled) {
+    isEnabled = enabled;
+    ceiling = maxScale;
+    ceilingFramesLeft = 0;
+    smoothedFrameTime = 0.0f;
+    if (!isEnabled) { SetScale(maxScale); }
+}
+
+bool DynamicResolution::Update(float frameTime) {
+    if (!isEnabled) { return false; }
+
+    // The first sample seeds the average, so that it does not start from zero
+    smoothedFrameTime = smoothedFrameTime == 0.0f
+            ? frameTime
+            : smoothedFrameTime + (frameTime - smoothedFrameTime) * SMOOTHING;
+
+    if (ceilingFramesLeft > 0 && --ceilingFramesLeft == 0) {
+        ceiling = maxScale;
+    }
+    if (++framesSinceChange < SETTLE_FRAME_COUNT) { return false; }
+
+    if (smoothedFrameTime > targetFrameTime * (1.0f + OVER_BUDGET_MARGIN)) {
+        const float ratio = SDL_sqrtf(targetFrameTime / smoothedFrameTime);
+        const float newScale = SDL_max(scale * ratio, scale - MAX_SCALE_DOWN_STEP);
+        ceiling = SDL_max(minScale, scale - SCALE_UP_STEP);
+        ceilingFramesLeft = CEILING_FRAME_COUNT;
+        return SetScale(newScale);
+    }
+    if (smoothedFrameTime < targetFrameTime * (1.0f + UNDER_BUDGET_MARGIN) && scale < ceiling) {
+        return SetScale(SDL_min(scale + SCALE_UP_STEP, ceiling));
+    }
+    return false;
+}
+
+bool DynamicResolution::SetScale(float newScale) {
+    newScale = SDL_clamp(newScale, minScale, maxScale);
+    if (newScale == scale) { return false; }
+    scale = newScale;
+    framesSinceChange = 0;
+    // Frames measured at the old scale say nothing about the new one
+    smoothedFrameTime = 0.0f;
+    return true;
+}
+
+void DynamicResolution::GetRenderSize(Uint32 outputWidth, Uint32 outputHeight,
+                                      Uint32& outWidth, Uint32& outHeight) const {
+    auto scaleSize = [this](Uint32 size) {
+        const Uint32 scaled = static_cast<Uint32>(static_cast<float>(size) * scale + 0.5f);
+        const Uint32 aligned = (scaled + RENDER_SIZE_ALIGNMENT - 1) / RENDER_SIZE_ALIGNMENT * RENDER_SIZE_ALIGNMENT;
+        return SDL_max(1u, SDL_min(aligned, size));
+    };
+    outWidth = scaleSize(outputWidth);
+    outHeight = scaleSize(outputHeight);
+}
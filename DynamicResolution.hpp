@@ -0,0 +1,65 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef DYNAMICRESOLUTION_HPP
+#define DYNAMICRESOLUTION_HPP
+
+#include <SDL3/SDL_stdinc.h>
+
+/*
+ * Drive an internal render resolution scale from measured frame times.
+ * Scenes render at GetRenderSize and upscale to the output size, e.g. with BlitSwapchainTexture.
+ *
+ * The frame cost is assumed proportional to the pixel count, so an over budget frame scales both axes by
+ * sqrt(budget / frameTime). Under budget, the scale grows back by small steps. When frame rate is capped,
+ * a frame on budget cannot tell how much headroom is left, so the scale that went over budget becomes a ceiling
+ * for a while, to avoid oscillating around it.
+ */
+class DynamicResolution {
+public:
+    // Frame time to hold, in seconds
+    void SetTargetFrameTime(float frameTime) { targetFrameTime = frameTime; }
+    float GetTargetFrameTime() const { return targetFrameTime; }
+
+    void SetScaleRange(float newMinScale, float newMaxScale);
+
+    // When disabled, the scale stays at the maximum
+    void SetEnabled(bool enabled);
+    bool IsEnabled() const { return isEnabled; }
+
+    // Feed the duration of the last frame, in seconds. Returns true when the scale changed.
+    bool Update(float frameTime);
+
+    float GetScale() const { return scale; }
+    float GetSmoothedFrameTime() const { return smoothedFrameTime; }
+
+    // Scaled size, rounded up to RENDER_SIZE_ALIGNMENT and never above the output size
+    void GetRenderSize(Uint32 outputWidth, Uint32 outputHeight, Uint32& outWidth, Uint32& outHeight) const;
+
+    static constexpr float DEFAULT_TARGET_FRAME_TIME = 1.0f / 60.0f;
+    static constexpr float SMOOTHING = 0.1f;             // Weight of the newest frame time
+    static constexpr float OVER_BUDGET_MARGIN = 0.1f;    // Above target * (1 + margin), the scale drops
+    static constexpr float UNDER_BUDGET_MARGIN = 0.05f;  // Below target * (1 + margin), the scale grows
+    static constexpr float SCALE_UP_STEP = 0.05f;
+    static constexpr float MAX_SCALE_DOWN_STEP = 0.25f;
+    static constexpr Uint32 SETTLE_FRAME_COUNT = 8;      // Frames in flight still run at the previous scale
+    static constexpr Uint32 CEILING_FRAME_COUNT = 240;
+    static constexpr Uint32 RENDER_SIZE_ALIGNMENT = 8;
+
+private:
+    bool SetScale(float newScale);
+
+    float targetFrameTime { DEFAULT_TARGET_FRAME_TIME };
+    float minScale { 0.5f };
+    float maxScale { 1.0f };
+    float scale { 1.0f };
+    float ceiling { 1.0f };
+    float smoothedFrameTime { 0.0f };
+    Uint32 framesSinceChange { 0 };
+    Uint32 ceilingFramesLeft { 0 };
+    bool isEnabled { true };
+};
+
+
+#endif //DYNAMICRESOLUTION_HPP
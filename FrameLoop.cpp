@@ -0,0 +1,87 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#include "FrameLoop.hpp"
+#include "ThreadedScene.hpp"
+#include "Time.hpp"
+#include <SDL3/SDL.h>
+
+// State handed to the simulation thread. The semaphores order every access, so no field needs to be atomic.
+struct SimulationThreadData {
+    ThreadedScene* scene { nullptr };
+    SDL_Semaphore* frameStart { nullptr };
+    SDL_Semaphore* frameDone { nullptr };
+    InputState input;
+    float dt { 0 };
+    Uint32 packet { 0 };
+    bool isRunning { true };
+};
+
+static int SDLCALL SimulationThread(void* userData) {
+    auto data = static_cast<SimulationThreadData*>(userData);
+    while (true) {
+        SDL_WaitSemaphore(data->frameStart);
+        if (!data->isRunning) { break; }
+        data->scene->Simulate(data->dt, data->input, data->packet);
+        SDL_SignalSemaphore(data->frameDone);
+    }
+    return 0;
+}
+
+void FrameLoop::Run(Scene& scene, Renderer& renderer, Time& time) {
+    bool isRunning { true };
+    while (isRunning) {
+        const float dt = time.ComputeDeltaTime();
+
+        isRunning = scene.Update(dt);
+        scene.Draw(renderer);
+
+        time.DelayTime();
+    }
+}
+
+void FrameLoop::RunThreaded(ThreadedScene& scene, Renderer& renderer, Time& time) {
+    SimulationThreadData data {
+        .scene = &scene,
+        .frameStart = SDL_CreateSemaphore(0),
+        .frameDone = SDL_CreateSemaphore(0),
+    };
+    SDL_Thread* thread = SDL_CreateThread(SimulationThread, "Simulation", &data);
+    if (thread == nullptr) {
+        SDL_Log("Could not create the simulation thread, running serially: %s", SDL_GetError());
+        SDL_DestroySemaphore(data.frameStart);
+        SDL_DestroySemaphore(data.frameDone);
+        Run(scene, renderer, time);
+        return;
+    }
+
+    // The first packet is simulated up front, so that there is always a finished packet to render
+    time.ComputeDeltaTime();
+    bool isRunning = scene.GatherInput();
+    scene.Simulate(0, scene.GetInput(), 0);
+    Uint32 renderPacket = 0;
+
+    while (isRunning) {
+        const float dt = time.ComputeDeltaTime();
+        isRunning = scene.GatherInput();
+
+        data.input = scene.GetInput();
+        data.dt = dt;
+        data.packet = (renderPacket + 1) % ThreadedScene::PACKET_COUNT;
+        SDL_SignalSemaphore(data.frameStart);
+
+        scene.Render(renderer, renderPacket);
+
+        SDL_WaitSemaphore(data.frameDone);
+        renderPacket = data.packet;
+
+        time.DelayTime();
+    }
+
+    data.isRunning = false;
+    SDL_SignalSemaphore(data.frameStart);
+    SDL_WaitThread(thread, nullptr);
+    SDL_DestroySemaphore(data.frameStart);
+    SDL_DestroySemaphore(data.frameDone);
+}
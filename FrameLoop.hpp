@@ -0,0 +1,28 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef FRAMELOOP_HPP
+#define FRAMELOOP_HPP
+
+class Scene;
+class ThreadedScene;
+class Renderer;
+class Time;
+
+/*
+ * Main loops of the application.
+ */
+class FrameLoop {
+public:
+    // Update then draw, one after the other, on the calling thread
+    static void Run(Scene& scene, Renderer& renderer, Time& time);
+
+    // The calling thread keeps the window, the events and the Renderer, and renders frame N while a simulation
+    // thread simulates frame N + 1 into the other render packet. A frame then costs max(simulation, render)
+    // instead of their sum, for one frame of latency.
+    static void RunThreaded(ThreadedScene& scene, Renderer& renderer, Time& time);
+};
+
+
+#endif //FRAMELOOP_HPP
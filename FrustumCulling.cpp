@@ -0,0 +1,68 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#include "FrustumCulling.hpp"
+
+Frustum FrustumCulling::ExtractFrustum(const Mat4& m) {
+    // Gribb-Hartmann: clip = M * p, and a point is inside when -w <= x <= w, -w <= y <= w, 0 <= z <= w.
+    // Mat4 stores rows of the matrix applied to column vectors as (m0, m1, m2, m3), (m4, ...)...
+    const float row0[4] { m.m0, m.m1, m.m2, m.m3 };
+    const float row1[4] { m.m4, m.m5, m.m6, m.m7 };
+    const float row2[4] { m.m8, m.m9, m.m10, m.m11 };
+    const float row3[4] { m.m12, m.m13, m.m14, m.m15 };
+
+    Frustum frustum {};
+    auto setPlane = [&frustum](int index, const float* a, const float* b, float sign) {
+        FrustumPlane& plane = frustum.planes[index];
+        plane.nx = a[0] + sign * b[0];
+        plane.ny = a[1] + sign * b[1];
+        plane.nz = a[2] + sign * b[2];
+        plane.d = a[3] + sign * b[3];
+        const float length = SDL_sqrtf(plane.nx * plane.nx + plane.ny * plane.ny + plane.nz * plane.nz);
+        if (length > 0.0f) {
+            plane.nx /= length;
+            plane.ny /= length;
+            plane.nz /= length;
+            plane.d /= length;
+        }
+    };
+    setPlane(0, row3, row0, 1.0f);  // Left
+    setPlane(1, row3, row0, -1.0f); // Right
+    setPlane(2, row3, row1, 1.0f);  // Bottom
+    setPlane(3, row3, row1, -1.0f); // Top
+    setPlane(4, row2, row2, 0.0f);  // Near
+    setPlane(5, row3, row2, -1.0f); // Far
+    return frustum;
+}
+
+bool FrustumCulling::IsSphereVisible(const Frustum& frustum, float x, float y, float z, float radius) {
+    for (const FrustumPlane& plane : frustum.planes) {
+        if (plane.nx * x + plane.ny * y + plane.nz * z + plane.d < -radius) { return false; }
+    }
+    return true;
+}
+
+void FrustumCulling::GetInstanceSphere(const Mat4& t, float localRadius,
+                                       float& outX, float& outY, float& outZ, float& outRadius) {
+    // Translation is the last column, axis scales are the lengths of the first three columns
+    outX = t.m3;
+    outY = t.m7;
+    outZ = t.m11;
+    const float scaleX = t.m0 * t.m0 + t.m4 * t.m4 + t.m8 * t.m8;
+    const float scaleY = t.m1 * t.m1 + t.m5 * t.m5 + t.m9 * t.m9;
+    const float scaleZ = t.m2 * t.m2 + t.m6 * t.m6 + t.m10 * t.m10;
+    outRadius = localRadius * SDL_sqrtf(SDL_max(scaleX, SDL_max(scaleY, scaleZ)));
+}
+
+void FrustumCulling::CullInstances(const Frustum& frustum, const InstanceData* instances, Uint32 instanceCount,
+                                   float localRadius, vector<Uint32>& outVisibleIndices) {
+    outVisibleIndices.clear();
+    for (Uint32 i = 0; i < instanceCount; ++i) {
+        float x, y, z, radius;
+        GetInstanceSphere(instances[i].transform, localRadius, x, y, z, radius);
+        if (IsSphereVisible(frustum, x, y, z, radius)) {
+            outVisibleIndices.push_back(i);
+        }
+    }
+}
@@ -0,0 +1,47 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef FRUSTUMCULLING_HPP
+#define FRUSTUMCULLING_HPP
+
+#include <SDL3/SDL_stdinc.h>
+#include <vector>
+#include "Mat4.hpp"
+#include "InstancedRenderer.hpp"
+
+using std::vector;
+
+// Plane with a unit normal pointing inside the frustum: nx * x + ny * y + nz * z + d >= 0 inside
+struct FrustumPlane {
+    float nx, ny, nz, d;
+};
+
+struct Frustum {
+    static constexpr int PLANE_COUNT = 6;
+    FrustumPlane planes[PLANE_COUNT]; // Left, right, bottom, top, near, far
+};
+
+/*
+ * CPU frustum culling of instances, with bounding spheres.
+ * This is the reference for FrustumCull.comp: same planes, same sphere test, so results can be checked headless.
+ */
+class FrustumCulling {
+public:
+    // Planes of a view projection matrix, as used by the shaders (clip depth from 0 to 1)
+    static Frustum ExtractFrustum(const Mat4& viewProjection);
+
+    // True if the sphere is at least partially inside the frustum
+    static bool IsSphereVisible(const Frustum& frustum, float x, float y, float z, float radius);
+
+    // World bounding sphere of an instance whose mesh fits in a sphere of localRadius around its origin
+    static void GetInstanceSphere(const Mat4& transform, float localRadius,
+                                  float& outX, float& outY, float& outZ, float& outRadius);
+
+    // Indices of the visible instances, in instance order. The GPU writes them in any order.
+    static void CullInstances(const Frustum& frustum, const InstanceData* instances, Uint32 instanceCount,
+                              float localRadius, vector<Uint32>& outVisibleIndices);
+};
+
+
+#endif //FRUSTUMCULLING_HPP
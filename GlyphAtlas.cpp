@@ -0,0 +1,95 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#include "GlyphAtlas.hpp"
+#include "TaskScheduler.hpp"
+#include <SDL3/SDL.h>
+
+namespace {
+    constexpr float FAR_AWAY = 1e20f;
+    constexpr Uint32 CELL_SIZE = GlyphAtlas::CELL_WIDTH * GlyphAtlas::CELL_HEIGHT;
+    constexpr Uint32 MAX_CELL_SIDE = SDL_max(GlyphAtlas::CELL_WIDTH, GlyphAtlas::CELL_HEIGHT);
+    constexpr Uint8 COVERAGE_THRESHOLD = 128;
+}
+
+void GlyphAtlas::BuildDistanceField(Uint8* pixels, Uint32 pitch) {
+    // Each cell on its own: glyphs do not see their neighbours
+    TaskScheduler::ParallelFor(COLUMNS * ROWS, 1, [pixels, pitch](Uint32 begin, Uint32 end) {
+        float toInk[CELL_SIZE];
+        float toBackground[CELL_SIZE];
+        for (Uint32 cell = begin; cell < end; ++cell) {
+            Uint8* cellPixels = pixels + (cell / COLUMNS) * CELL_HEIGHT * pitch + (cell % COLUMNS) * CELL_WIDTH * 4;
+            for (Uint32 y = 0; y < CELL_HEIGHT; ++y) {
+                const Uint8* row = cellPixels + y * pitch;
+                for (Uint32 x = 0; x < CELL_WIDTH; ++x) {
+                    const bool isInk = row[x * 4] >= COVERAGE_THRESHOLD;
+                    toInk[y * CELL_WIDTH + x] = isInk ? 0.0f : FAR_AWAY;
+                    toBackground[y * CELL_WIDTH + x] = isInk ? FAR_AWAY : 0.0f;
+                }
+            }
+            DistanceTransform(toInk);
+            DistanceTransform(toBackground);
+
+            for (Uint32 y = 0; y < CELL_HEIGHT; ++y) {
+                Uint8* row = cellPixels + y * pitch;
+                for (Uint32 x = 0; x < CELL_WIDTH; ++x) {
+                    // Pixel centers are half a pixel away from the edge between ink and background
+                    const Uint32 i = y * CELL_WIDTH + x;
+                    const float distance = toInk[i] == 0.0f ? SDL_sqrtf(toBackground[i]) - 0.5f
+                                                            : 0.5f - SDL_sqrtf(toInk[i]);
+                    const float value = SDL_clamp(0.5f + 0.5f * distance / SPREAD, 0.0f, 1.0f);
+                    row[x * 4 + 1] = static_cast<Uint8>(value * 255.0f + 0.5f);
+                }
+            }
+        }
+    });
+}
+
+void GlyphAtlas::DistanceTransform(float* distances) {
+    float f[MAX_CELL_SIDE];
+    float d[MAX_CELL_SIDE];
+    Uint32 v[MAX_CELL_SIDE];
+    float z[MAX_CELL_SIDE + 1];
+
+    // Columns then rows: the 2D transform is separable
+    for (Uint32 x = 0; x < CELL_WIDTH; ++x) {
+        for (Uint32 y = 0; y < CELL_HEIGHT; ++y) { f[y] = distances[y * CELL_WIDTH + x]; }
+        DistanceTransform(f, d, CELL_HEIGHT, v, z);
+        for (Uint32 y = 0; y < CELL_HEIGHT; ++y) { distances[y * CELL_WIDTH + x] = d[y]; }
+    }
+    for (Uint32 y = 0; y < CELL_HEIGHT; ++y) {
+        float* row = distances + y * CELL_WIDTH;
+        SDL_memcpy(f, row, CELL_WIDTH * sizeof(float));
+        DistanceTransform(f, row, CELL_WIDTH, v, z);
+    }
+}
+
+void GlyphAtlas::DistanceTransform(const float* f, float* d, Uint32 count, Uint32* v, float* z) {
+    // Lower envelope of the parabolas rooted at each sample
+    Uint32 k = 0;
+    v[0] = 0;
+    z[0] = -FAR_AWAY;
+    z[1] = FAR_AWAY;
+    const auto intersection = [f](Uint32 q, Uint32 p) {
+        return (f[q] + static_cast<float>(q * q) - f[p] - static_cast<float>(p * p)) / static_cast<float>(2 * (q - p));
+    };
+    for (Uint32 q = 1; q < count; ++q) {
+        float s = intersection(q, v[k]);
+        while (k > 0 && s <= z[k]) {
+            --k;
+            s = intersection(q, v[k]);
+        }
+        ++k;
+        v[k] = q;
+        z[k] = s;
+        z[k + 1] = FAR_AWAY;
+    }
+
+    k = 0;
+    for (Uint32 q = 0; q < count; ++q) {
+        while (z[k + 1] < static_cast<float>(q)) { ++k; }
+        const float offset = static_cast<float>(q) - static_cast<float>(v[k]);
+        d[q] = offset * offset + f[v[k]];
+    }
+}
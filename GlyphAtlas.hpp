@@ -0,0 +1,55 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef GLYPHATLAS_HPP
+#define GLYPHATLAS_HPP
+
+#include <SDL3/SDL_stdinc.h>
+
+/*
+ * Layout of the monospaced font atlas, font_mono.bmp: printable ASCII characters, from space to '~', then a box for
+ * the characters out of the atlas, in a grid of COLUMNS x ROWS cells. Glyphs are white on black.
+ * The atlas texture keeps the coverage in its red channel for bitmap text, and gets a signed distance field in its
+ * green channel for text drawn at any scale.
+ */
+class GlyphAtlas {
+public:
+    // Must match GlyphBatch.comp
+    static constexpr Uint32 COLUMNS = 16;
+    static constexpr Uint32 ROWS = 6;
+    static constexpr Uint32 CELL_WIDTH = 32;
+    static constexpr Uint32 CELL_HEIGHT = 64;
+    static constexpr Uint32 WIDTH = COLUMNS * CELL_WIDTH;
+    static constexpr Uint32 HEIGHT = ROWS * CELL_HEIGHT;
+
+    static constexpr char FIRST_CHARACTER = ' ';
+    static constexpr char LAST_CHARACTER = '~';
+    static constexpr Uint32 MISSING_GLYPH = LAST_CHARACTER - FIRST_CHARACTER + 1;
+
+    // In atlas pixels, at scale 1
+    static constexpr float ADVANCE = 24.0f;
+    static constexpr float LINE_HEIGHT = 52.0f;
+    // Distances from -SPREAD to SPREAD pixels are mapped to [0, 1], 0.5 on the glyph edges
+    static constexpr float SPREAD = 6.0f;
+
+    // Cell of a character, MISSING_GLYPH for the characters out of the atlas
+    static Uint32 GetGlyph(char character) {
+        return character >= FIRST_CHARACTER && character <= LAST_CHARACTER
+               ? static_cast<Uint32>(character - FIRST_CHARACTER) : MISSING_GLYPH;
+    }
+
+    // Write the signed distance field of the coverage (red channel) into the green channel of a WIDTH x HEIGHT
+    // R8G8B8A8 atlas. Exact euclidean distances, cells are computed in parallel on the task scheduler.
+    static void BuildDistanceField(Uint8* pixels, Uint32 pitch);
+
+private:
+    // Squared distance transform of a sampled function, see Felzenszwalb and Huttenlocher, "Distance Transforms of
+    // Sampled Functions". v and z are scratch arrays of count and count + 1 elements.
+    static void DistanceTransform(const float* f, float* d, Uint32 count, Uint32* v, float* z);
+
+    // Squared distances to the nearest zero of a cell, in place
+    static void DistanceTransform(float* distances);
+};
+
+#endif //GLYPHATLAS_HPP
@@ -0,0 +1,179 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#include "HDRImage.hpp"
+#include <SDL3/SDL_iostream.h>
+#include <SDL3/SDL_log.h>
+#include <cmath>
+#include <cstring>
+
+namespace {
+    // Read a header line, without its line feed. Returns false at the end of the data.
+    bool ReadLine(const Uint8* data, size_t size, size_t& cursor, char* outLine, size_t lineSize) {
+        if (cursor >= size) { return false; }
+        size_t length = 0;
+        while (cursor < size && data[cursor] != '\n') {
+            if (length + 1 < lineSize) { outLine[length++] = static_cast<char>(data[cursor]); }
+            ++cursor;
+        }
+        outLine[length] = '\0';
+        ++cursor;
+        return true;
+    }
+
+    void RGBEToFloat(const Uint8* rgbe, float* outRGBA) {
+        if (rgbe[3] == 0) {
+            outRGBA[0] = outRGBA[1] = outRGBA[2] = 0.0f;
+        } else {
+            const float scale = std::ldexp(1.0f, static_cast<int>(rgbe[3]) - (128 + 8));
+            outRGBA[0] = (rgbe[0] + 0.5f) * scale;
+            outRGBA[1] = (rgbe[1] + 0.5f) * scale;
+            outRGBA[2] = (rgbe[2] + 0.5f) * scale;
+        }
+        outRGBA[3] = 1.0f;
+    }
+
+    // New RLE: the scanline starts with 2, 2, width high byte, width low byte,
+    // then each of the four channels is run-length encoded separately
+    bool ReadRLEScanline(const Uint8* data, size_t size, size_t& cursor, Uint32 width, Uint8* outRGBE) {
+        cursor += 4;
+        for (Uint32 channel = 0; channel < 4; ++channel) {
+            Uint32 x = 0;
+            while (x < width) {
+                if (cursor >= size) { return false; }
+                Uint32 count = data[cursor++];
+                if (count > 128) {
+                    count -= 128;
+                    if (cursor >= size || x + count > width) { return false; }
+                    const Uint8 value = data[cursor++];
+                    for (Uint32 i = 0; i < count; ++i) { outRGBE[(x++) * 4 + channel] = value; }
+                } else {
+                    if (count == 0 || cursor + count > size || x + count > width) { return false; }
+                    for (Uint32 i = 0; i < count; ++i) { outRGBE[(x++) * 4 + channel] = data[cursor++]; }
+                }
+            }
+        }
+        return true;
+    }
+}
+
+bool HDRImageLoader::Load(const char* path, HDRImage& outImage) {
+    size_t fileSize;
+    void* fileData = SDL_LoadFile(path, &fileSize);
+    if (fileData == nullptr) {
+        SDL_Log("Failed to load HDR image from disk! %s", path);
+        return false;
+    }
+    const bool isLoaded = Parse(static_cast<const Uint8*>(fileData), fileSize, outImage);
+    if (!isLoaded) { SDL_Log("Invalid HDR image: %s", path); }
+    SDL_free(fileData);
+    return isLoaded;
+}
+
+bool HDRImageLoader::Parse(const Uint8* fileData, size_t fileSize, HDRImage& outImage) {
+    size_t cursor = 0;
+    char line[256];
+    if (!ReadLine(fileData, fileSize, cursor, line, sizeof(line))
+        || (std::strcmp(line, "#?RADIANCE") != 0 && std::strcmp(line, "#?RGBE") != 0)) {
+        return false;
+    }
+
+    // Header variables end with an empty line
+    while (ReadLine(fileData, fileSize, cursor, line, sizeof(line)) && line[0] != '\0') {
+        if (std::strncmp(line, "FORMAT=", 7) == 0 && std::strcmp(line, "FORMAT=32-bit_rle_rgbe") != 0) {
+            SDL_Log("Unsupported HDR format: %s", line + 7);
+            return false;
+        }
+    }
+
+    // Only the standard orientation, top to bottom and left to right, is supported
+    int height = 0;
+    int width = 0;
+    if (!ReadLine(fileData, fileSize, cursor, line, sizeof(line))
+        || SDL_sscanf(line, "-Y %d +X %d", &height, &width) != 2 || width <= 0 || height <= 0) {
+        return false;
+    }
+
+    outImage.width = static_cast<Uint32>(width);
+    outImage.height = static_cast<Uint32>(height);
+    outImage.pixels.resize(static_cast<size_t>(width) * height * 4);
+
+    vector<Uint8> scanline(static_cast<size_t>(width) * 4);
+    for (int y = 0; y < height; ++y) {
+        const bool isRLE = width >= 8 && width < 32768 && cursor + 4 <= fileSize
+                           && fileData[cursor] == 2 && fileData[cursor + 1] == 2
+                           && ((fileData[cursor + 2] << 8) | fileData[cursor + 3]) == width;
+        if (isRLE) {
+            if (!ReadRLEScanline(fileData, fileSize, cursor, width, scanline.data())) { return false; }
+        } else {
+            if (cursor + scanline.size() > fileSize) { return false; }
+            std::memcpy(scanline.data(), fileData + cursor, scanline.size());
+            cursor += scanline.size();
+        }
+
+        float* row = outImage.pixels.data() + static_cast<size_t>(y) * width * 4;
+        for (int x = 0; x < width; ++x) {
+            RGBEToFloat(&scanline[x * 4], &row[x * 4]);
+        }
+    }
+    return true;
+}
+
+Uint16 HDRImageLoader::FloatToHalf(float value) {
+    Uint32 bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const Uint32 sign = (bits >> 16) & 0x8000;
+    const Uint32 exponent = (bits >> 23) & 0xFF;
+    Uint32 mantissa = bits & 0x7FFFFF;
+
+    if (exponent == 0xFF) {
+        // Inf stays inf, NaN stays a quiet NaN
+        return static_cast<Uint16>(sign | 0x7C00 | (mantissa != 0 ? 0x200 : 0));
+    }
+    const int halfExponent = static_cast<int>(exponent) - 127 + 15;
+    if (halfExponent >= 31) {
+        return static_cast<Uint16>(sign | 0x7C00);
+    }
+    if (halfExponent <= 0) {
+        // Subnormal half, or zero
+        if (halfExponent < -10) { return static_cast<Uint16>(sign); }
+        mantissa |= 0x800000;
+        const Uint32 shift = static_cast<Uint32>(14 - halfExponent);
+        Uint32 half = mantissa >> shift;
+        const Uint32 remainder = mantissa & ((1u << shift) - 1);
+        const Uint32 halfway = 1u << (shift - 1);
+        if (remainder > halfway || (remainder == halfway && (half & 1))) { ++half; }
+        return static_cast<Uint16>(sign | half);
+    }
+
+    Uint32 half = (static_cast<Uint32>(halfExponent) << 10) | (mantissa >> 13);
+    const Uint32 remainder = mantissa & 0x1FFF;
+    // A carry out of the mantissa correctly bumps the exponent, up to inf
+    if (remainder > 0x1000 || (remainder == 0x1000 && (half & 1))) { ++half; }
+    return static_cast<Uint16>(sign | half);
+}
+
+float HDRImageLoader::HalfToFloat(Uint16 value) {
+    const Uint32 sign = (value & 0x8000u) << 16;
+    const Uint32 exponent = (value >> 10) & 0x1F;
+    const Uint32 mantissa = value & 0x3FF;
+    Uint32 bits;
+    if (exponent == 0) {
+        const float magnitude = std::ldexp(static_cast<float>(mantissa), -24);
+        return sign ? -magnitude : magnitude;
+    } else if (exponent == 31) {
+        bits = sign | 0x7F800000 | (mantissa << 13);
+    } else {
+        bits = sign | ((exponent - 15 + 127) << 23) | (mantissa << 13);
+    }
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+void HDRImageLoader::ToHalf(const float* pixels, size_t floatCount, Uint16* outHalves) {
+    for (size_t i = 0; i < floatCount; ++i) {
+        outHalves[i] = FloatToHalf(pixels[i]);
+    }
+}
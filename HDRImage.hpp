@@ -0,0 +1,41 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef HDRIMAGE_HPP
+#define HDRIMAGE_HPP
+
+#include <SDL3/SDL_stdinc.h>
+#include <vector>
+
+using std::vector;
+
+/*
+ * Linear floating point image, RGBA32F, top row first.
+ */
+struct HDRImage {
+    Uint32 width { 0 };
+    Uint32 height { 0 };
+    vector<float> pixels;
+};
+
+/*
+ * Radiance RGBE (.hdr) loading and half float conversion for float16 textures.
+ */
+class HDRImageLoader {
+public:
+    static bool Load(const char* path, HDRImage& outImage);
+
+    // Parse an in-memory .hdr file. Flat and new run-length encoded scanlines are supported.
+    static bool Parse(const Uint8* fileData, size_t fileSize, HDRImage& outImage);
+
+    // IEEE 754 binary16, rounded to nearest even
+    static Uint16 FloatToHalf(float value);
+    static float HalfToFloat(Uint16 value);
+
+    // Convert RGBA32F pixels to RGBA16F, for R16G16B16A16_FLOAT textures
+    static void ToHalf(const float* pixels, size_t floatCount, Uint16* outHalves);
+};
+
+
+#endif //HDRIMAGE_HPP
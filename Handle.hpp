@@ -0,0 +1,106 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef HANDLE_HPP
+#define HANDLE_HPP
+
+#include <SDL3/SDL_gpu.h>
+#include <string>
+#include <vector>
+
+using std::string;
+using std::vector;
+
+/*
+ * Generational handle to a resource of type T.
+ * A handle stays safe to use after its resource is released: the pool slot generation changes,
+ * so stale handles resolve to nullptr instead of a dangling or reused pointer.
+ */
+template<typename T>
+struct Handle {
+    Uint32 index { 0 };
+    Uint32 generation { 0 }; // Live slots never have generation 0, so a default handle is invalid
+
+    bool IsValid() const { return generation != 0; }
+    bool operator==(const Handle& other) const = default;
+};
+
+using TextureHandle = Handle<SDL_GPUTexture>;
+using BufferHandle = Handle<SDL_GPUBuffer>;
+
+/*
+ * Slot storage behind handles. Freed slots are reused with an incremented generation.
+ */
+template<typename T>
+class HandlePool {
+public:
+    Handle<T> Add(T* resource, const string& name) {
+        Uint32 index;
+        if (!freeSlots.empty()) {
+            index = freeSlots.back();
+            freeSlots.pop_back();
+        } else {
+            index = static_cast<Uint32>(slots.size());
+            slots.emplace_back();
+        }
+        Slot& slot = slots[index];
+        slot.resource = resource;
+        slot.name = name;
+        ++liveCount;
+        return Handle<T> { index, slot.generation };
+    }
+
+    // Returns nullptr for invalid or stale handles
+    T* Get(Handle<T> handle) const {
+        if (handle.index >= slots.size()) { return nullptr; }
+        const Slot& slot = slots[handle.index];
+        return slot.generation == handle.generation ? slot.resource : nullptr;
+    }
+
+    // Invalidate the handle and give back its resource, or nullptr if the handle was stale
+    T* Remove(Handle<T> handle) {
+        T* resource = Get(handle);
+        if (resource == nullptr) { return nullptr; }
+        Slot& slot = slots[handle.index];
+        slot.resource = nullptr;
+        slot.name.clear();
+        if (++slot.generation == 0) { slot.generation = 1; }
+        freeSlots.push_back(handle.index);
+        --liveCount;
+        return resource;
+    }
+
+    // Swap the resource behind a live handle, e.g. when a target is recreated at a new size.
+    // The handle stays valid. Returns the previous resource, or nullptr if the handle was stale.
+    T* Replace(Handle<T> handle, T* resource) {
+        T* previous = Get(handle);
+        if (previous == nullptr) { return nullptr; }
+        slots[handle.index].resource = resource;
+        return previous;
+    }
+
+    Uint32 GetLiveCount() const { return liveCount; }
+
+    // Call function(name, resource) on every live resource, e.g. to report leaks
+    template<typename Function>
+    void ForEachLive(Function&& function) const {
+        for (const Slot& slot : slots) {
+            if (slot.resource != nullptr) { function(slot.name, slot.resource); }
+        }
+    }
+
+private:
+    struct Slot {
+        T* resource { nullptr };
+        Uint32 generation { 1 };
+        string name;
+    };
+
+    vector<Slot> slots;
+    vector<Uint32> freeSlots;
+    Uint32 liveCount { 0 };
+};
+
+
+#endif //HANDLE_HPP
@@ -15,7 +15,7 @@ enum class DirectionalKey {
 };
 
 struct InputState {
-    bool IsUp(DirectionalKey key) {
+    bool IsUp(DirectionalKey key) const {
         switch (key) {
             case DirectionalKey::Up:
                 return !up;
@@ -28,7 +28,7 @@ struct InputState {
         }
     }
 
-    bool IsDown(DirectionalKey key) {
+    bool IsDown(DirectionalKey key) const {
         switch (key) {
             case DirectionalKey::Up:
                 return up;
@@ -41,7 +41,7 @@ struct InputState {
         }
     }
 
-    bool IsPressed(DirectionalKey key) {
+    bool IsPressed(DirectionalKey key) const {
         switch (key) {
             case DirectionalKey::Up:
                 return up && !previousUp;
@@ -54,7 +54,7 @@ struct InputState {
         }
     }
 
-    bool IsReleased(DirectionalKey key) {
+    bool IsReleased(DirectionalKey key) const {
         switch (key) {
             case DirectionalKey::Up:
                 return !up && previousUp;
@@ -0,0 +1,107 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#include "InstanceCuller.hpp"
+#include "Renderer.hpp"
+
+void InstanceCuller::Load(Renderer& renderer, const char* basePath, Uint32 capacity_) {
+    capacity = capacity_;
+
+    SDL_GPUComputePipelineCreateInfo createInfo = {
+        .num_readonly_storage_buffers = 1,
+        .num_readwrite_storage_buffers = 2,
+        .num_uniform_buffers = 1,
+        .threadcount_x = THREAD_GROUP_SIZE,
+        .threadcount_y = 1,
+        .threadcount_z = 1,
+    };
+    pipeline = renderer.CreateComputePipelineFromShader(basePath, "FrustumCull.comp", &createInfo);
+
+    visibleBuffer = renderer.CreateBuffer(SDL_GPUBufferCreateInfo {
+        .usage = SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_WRITE | SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ,
+        .size = capacity * static_cast<Uint32>(sizeof(Uint32))
+    });
+    renderer.SetBufferName(visibleBuffer, "Visible Instances");
+    drawCommandBuffer = renderer.CreateBuffer(SDL_GPUBufferCreateInfo {
+        .usage = SDL_GPU_BUFFERUSAGE_INDIRECT | SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_WRITE,
+        .size = sizeof(SDL_GPUIndexedIndirectDrawCommand)
+    });
+    renderer.SetBufferName(drawCommandBuffer, "Culled Draw Command");
+    resetTransferBuffer = renderer.CreateTransferBuffer(SDL_GPUTransferBufferCreateInfo {
+        .usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+        .size = sizeof(SDL_GPUIndexedIndirectDrawCommand)
+    });
+}
+
+void InstanceCuller::Cull(Renderer& renderer, SDL_GPUBuffer* instanceBuffer, Uint32 instanceCount,
+                          const Mat4& viewProjection, float localRadius, Uint32 indexCount) {
+    instanceCount = SDL_min(instanceCount, capacity);
+
+    // The shader only increments the instance count, so the command starts each frame with zero instances.
+    // Cycling gives this frame its own command while the previous frame may still draw with the old one.
+    auto command = static_cast<SDL_GPUIndexedIndirectDrawCommand*>(
+        renderer.MapTransferBuffer(resetTransferBuffer, true));
+    *command = SDL_GPUIndexedIndirectDrawCommand {
+        .num_indices = indexCount,
+        .num_instances = 0,
+        .first_index = 0,
+        .vertex_offset = 0,
+        .first_instance = 0
+    };
+    renderer.UnmapTransferBuffer(resetTransferBuffer);
+    renderer.BeginUploadToBuffer();
+    SDL_GPUTransferBufferLocation source {
+        .transfer_buffer = resetTransferBuffer,
+        .offset = 0
+    };
+    SDL_GPUBufferRegion destination {
+        .buffer = drawCommandBuffer,
+        .offset = 0,
+        .size = sizeof(SDL_GPUIndexedIndirectDrawCommand)
+    };
+    renderer.UploadToBuffer(source, destination, true);
+    renderer.EndUploadToBuffer(resetTransferBuffer, false);
+
+    FrustumCullUniforms uniforms {
+        .instanceCount = instanceCount,
+        .localRadius = localRadius
+    };
+    const Frustum frustum = FrustumCulling::ExtractFrustum(viewProjection);
+    for (int i = 0; i < Frustum::PLANE_COUNT; ++i) {
+        uniforms.planes[i] = frustum.planes[i];
+    }
+
+    // The command must not cycle again, or the reset would be lost
+    SDL_GPUStorageBufferReadWriteBinding bufferBindings[2] {{
+        .buffer = visibleBuffer,
+        .cycle = true
+    }, {
+        .buffer = drawCommandBuffer,
+        .cycle = false
+    }};
+    renderer.BeginCompute(nullptr, 0, bufferBindings, 2);
+    renderer.BindComputePipeline(pipeline);
+    renderer.BindComputeStorageBuffers(0, instanceBuffer, 1);
+    renderer.PushComputeUniformData(0, &uniforms, sizeof(uniforms));
+    renderer.DispatchComputeForSize(instanceCount, 1, 1);
+    renderer.EndCompute();
+}
+
+void InstanceCuller::Draw(Renderer& renderer, SDL_GPUBuffer* instanceBuffer, const Mat4& viewProjection) const {
+    SDL_GPUBuffer* storageBuffers[2] { instanceBuffer, visibleBuffer };
+    renderer.BindVertexStorageBuffers(0, storageBuffers, 2);
+    renderer.PushVertexUniformData(0, &viewProjection, sizeof(Mat4));
+    renderer.DrawIndexedPrimitivesIndirect(drawCommandBuffer, 0, 1);
+}
+
+void InstanceCuller::Unload(Renderer& renderer) {
+    renderer.ReleaseBuffer(visibleBuffer);
+    renderer.ReleaseBuffer(drawCommandBuffer);
+    renderer.ReleaseTransferBuffer(resetTransferBuffer);
+    renderer.ReleaseComputePipeline(pipeline);
+    visibleBuffer = nullptr;
+    drawCommandBuffer = nullptr;
+    resetTransferBuffer = nullptr;
+    pipeline = nullptr;
+}
@@ -0,0 +1,54 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef INSTANCECULLER_HPP
+#define INSTANCECULLER_HPP
+
+#include <SDL3/SDL_gpu.h>
+#include "FrustumCulling.hpp"
+
+class Renderer;
+
+// Matches CullUniforms in FrustumCull.comp
+struct FrustumCullUniforms {
+    FrustumPlane planes[Frustum::PLANE_COUNT];
+    Uint32 instanceCount;
+    float localRadius;
+    float padding[2];
+};
+
+/*
+ * GPU driven culling of an instance buffer (see InstancedRenderer).
+ * A compute pass tests every instance bounding sphere against the frustum, appends the visible instance indices to
+ * a buffer and counts them in an indexed indirect draw command. The draw then needs no CPU readback, so its CPU cost
+ * does not depend on the instance count. FrustumCulling is the CPU reference.
+ */
+class InstanceCuller {
+public:
+    void Load(Renderer& renderer, const char* basePath, Uint32 capacity);
+
+    // Reset the draw command and cull. Records a copy pass and a compute pass: call outside of a render pass.
+    // Instances use meshes of indexCount indices that fit in a sphere of localRadius around their origin.
+    void Cull(Renderer& renderer, SDL_GPUBuffer* instanceBuffer, Uint32 instanceCount, const Mat4& viewProjection,
+              float localRadius, Uint32 indexCount);
+
+    // Bind the instance and visible index buffers at vertex storage slots 0 and 1, and the view projection at vertex
+    // uniform slot 0, then issue the indirect draw. Use with InstancedCulled.vert.
+    void Draw(Renderer& renderer, SDL_GPUBuffer* instanceBuffer, const Mat4& viewProjection) const;
+
+    void Unload(Renderer& renderer);
+
+    // Must match the numthreads of FrustumCull.comp
+    static constexpr Uint32 THREAD_GROUP_SIZE = 64;
+
+private:
+    SDL_GPUComputePipeline* pipeline { nullptr };
+    SDL_GPUBuffer* visibleBuffer { nullptr };
+    SDL_GPUBuffer* drawCommandBuffer { nullptr };
+    SDL_GPUTransferBuffer* resetTransferBuffer { nullptr };
+    Uint32 capacity { 0 };
+};
+
+
+#endif //INSTANCECULLER_HPP
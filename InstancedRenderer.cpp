@@ -0,0 +1,75 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#include "InstancedRenderer.hpp"
+#include "Renderer.hpp"
+#include <cstring>
+
+static_assert(sizeof(InstanceData) == 80, "InstanceData must match the layout of InstancedTransform.vert");
+
+void InstancedRenderer::Load(Renderer& renderer, Uint32 capacity_, const string& name) {
+    capacity = capacity_;
+    instances.reserve(capacity);
+
+    const Uint32 size = capacity * static_cast<Uint32>(sizeof(InstanceData));
+    instanceBuffer = renderer.CreateBuffer(SDL_GPUBufferCreateInfo {
+        .usage = SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ | SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_READ,
+        .size = size
+    });
+    renderer.SetBufferName(instanceBuffer, name);
+    transferBuffer = renderer.CreateTransferBuffer(SDL_GPUTransferBufferCreateInfo {
+        .usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+        .size = size
+    });
+}
+
+bool InstancedRenderer::Add(const Mat4& transform, const SDL_FColor& color) {
+    if (instances.size() >= capacity) { return false; }
+    instances.push_back(InstanceData { transform, color });
+    return true;
+}
+
+void InstancedRenderer::Upload(Renderer& renderer) {
+    Upload(renderer, instances.data(), GetInstanceCount());
+}
+
+void InstancedRenderer::Upload(Renderer& renderer, const InstanceData* data, Uint32 count) {
+    uploadedCount = SDL_min(count, capacity);
+    if (uploadedCount == 0) { return; }
+    const Uint32 size = uploadedCount * static_cast<Uint32>(sizeof(InstanceData));
+
+    // Cycling lets the CPU write this frame's instances while the GPU still reads the previous ones
+    void* transferData = renderer.MapTransferBuffer(transferBuffer, true);
+    std::memcpy(transferData, data, size);
+    renderer.UnmapTransferBuffer(transferBuffer);
+
+    renderer.BeginUploadToBuffer();
+    SDL_GPUTransferBufferLocation source {
+        .transfer_buffer = transferBuffer,
+        .offset = 0
+    };
+    SDL_GPUBufferRegion destination {
+        .buffer = instanceBuffer,
+        .offset = 0,
+        .size = size
+    };
+    renderer.UploadToBuffer(source, destination, true);
+    renderer.EndUploadToBuffer(transferBuffer, false);
+}
+
+void InstancedRenderer::Draw(Renderer& renderer, Uint32 indexCount, const Mat4& viewProjection) const {
+    if (uploadedCount == 0) { return; }
+    renderer.BindVertexStorageBuffers(0, &instanceBuffer, 1);
+    renderer.PushVertexUniformData(0, &viewProjection, sizeof(Mat4));
+    renderer.DrawIndexedPrimitives(static_cast<int>(indexCount), static_cast<int>(uploadedCount), 0, 0, 0);
+}
+
+void InstancedRenderer::Unload(Renderer& renderer) {
+    renderer.ReleaseBuffer(instanceBuffer);
+    renderer.ReleaseTransferBuffer(transferBuffer);
+    instanceBuffer = nullptr;
+    transferBuffer = nullptr;
+    instances.clear();
+    uploadedCount = 0;
+}
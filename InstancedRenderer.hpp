@@ -0,0 +1,69 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef INSTANCEDRENDERER_HPP
+#define INSTANCEDRENDERER_HPP
+
+#include <SDL3/SDL_gpu.h>
+#include <string>
+#include <vector>
+#include "Mat4.hpp"
+
+using std::string;
+using std::vector;
+
+class Renderer;
+
+// Matches InstanceData in InstancedTransform.vert
+struct InstanceData {
+    Mat4 transform;
+    SDL_FColor color;
+};
+
+/*
+ * Draw many copies of a mesh in a single call.
+ * Per instance transforms and colors are gathered on the CPU, uploaded in bulk to a storage buffer once per frame,
+ * and read by the vertex shader with the instance id. This replaces one draw call and one uniform push per object.
+ *
+ * Usage per frame: Clear, Add instances, Upload before the render pass, then bind the mesh and Draw in the pass.
+ */
+class InstancedRenderer {
+public:
+    void Load(Renderer& renderer, Uint32 capacity, const string& name);
+
+    void Clear() { instances.clear(); }
+
+    // Returns false when the capacity is reached
+    bool Add(const Mat4& transform, const SDL_FColor& color);
+
+    // Copy the instances to the GPU. Must happen outside of a render pass.
+    void Upload(Renderer& renderer);
+
+    // Same, from instances gathered elsewhere, e.g. in a render packet. The count is clamped to the capacity.
+    void Upload(Renderer& renderer, const InstanceData* data, Uint32 count);
+
+    // Bind the instance buffer at vertex storage slot 0 and the view projection at vertex uniform slot 0, then draw
+    // every instance. The pipeline, mesh buffers and samplers must be bound.
+    void Draw(Renderer& renderer, Uint32 indexCount, const Mat4& viewProjection) const;
+
+    void Unload(Renderer& renderer);
+
+    Uint32 GetInstanceCount() const { return static_cast<Uint32>(instances.size()); }
+    Uint32 GetCapacity() const { return capacity; }
+    Uint32 GetUploadedCount() const { return uploadedCount; }
+    const vector<InstanceData>& GetInstances() const { return instances; }
+
+    // The storage buffer, e.g. for a compute pass that reads the instances
+    SDL_GPUBuffer* GetInstanceBuffer() const { return instanceBuffer; }
+
+private:
+    vector<InstanceData> instances;
+    Uint32 capacity { 0 };
+    Uint32 uploadedCount { 0 };
+    SDL_GPUBuffer* instanceBuffer { nullptr };
+    SDL_GPUTransferBuffer* transferBuffer { nullptr };
+};
+
+
+#endif //INSTANCEDRENDERER_HPP
@@ -6,6 +6,8 @@
 #include <SDL3/SDL_main.h>
 
 #include "Renderer.hpp"
+#include "FrameLoop.hpp"
+#include "PerformanceHud.hpp"
 #include "Scene01Clear.hpp"
 #include "Scene02Triangle.hpp"
 #include "Scene03TriangleVertexBuffer.hpp"
@@ -17,6 +19,17 @@
 #include "Scene09BasicCompute.hpp"
 #include "Scene10UniformsCompute.hpp"
 #include "Scene11SpriteBatchCompute.hpp"
+#include "Scene12CompressedTexture.hpp"
+#include "Scene13TextureStreaming.hpp"
+#include "Scene14ToneMapping.hpp"
+#include "Scene15InstancedQuads.hpp"
+#include "Scene16GpuParticles.hpp"
+#include "Scene17Skybox.hpp"
+#include "Scene18DepthPrePass.hpp"
+#include "Scene19ClipStack.hpp"
+#include "Scene20Text.hpp"
+#include "Scene21SpriteGrid.hpp"
+#include "TaskScheduler.hpp"
 #include "Time.hpp"
 #include "Window.hpp"
 
@@ -28,23 +41,28 @@ int main(int argc, char **argv) {
     Time time {};
     window.Init();
     renderer.Init(window);
+    TaskScheduler::Init();
+    PerformanceHud hud {};
+    hud.Load(renderer, SDL_GetBasePath(), time);
 
-    auto scene = std::make_unique<Scene11SpriteBatchCompute>();
+    auto scene = std::make_unique<Scene21SpriteGrid>();
     scene->Load(renderer);
 
-    bool isRunning { true };
-    while (isRunning) {
-        const float dt = time.ComputeDeltaTime();
-
-        isRunning = scene->Update(dt);
-        scene->Draw(renderer);
-
-        time.DelayTime();
+    // Scenes do not work around missing pipelines: stop rather than run with some of them null
+    const Uint32 shaderFailureCount = renderer.GetShaderFailureCount();
+    if (shaderFailureCount > 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
+                     "%u shaders failed to load, run Content/Shaders/Source/compile.sh", shaderFailureCount);
+    } else {
+        // Scene15 simulates on its own thread with FrameLoop::RunThreaded. Other scenes run with FrameLoop::Run.
+        FrameLoop::Run(*scene, renderer, time);
     }
 
     scene->Unload(renderer);
+    hud.Unload(renderer);
 
+    TaskScheduler::Close();
     renderer.Close();
     window.Close();
-    return 0;
+    return shaderFailureCount > 0 ? 1 : 0;
 }
\ No newline at end of file
@@ -74,6 +74,16 @@ Mat4 Mat4::CreateTranslation(float x, float y, float z)
     };
 }
 
+Mat4 Mat4::CreateScale(float x, float y, float z)
+{
+    return Mat4 {
+            x, 0, 0, 0,
+            0, y, 0, 0,
+            0, 0, z, 0,
+            0, 0, 0, 1
+    };
+}
+
 Mat4 Mat4::CreateOrthographicOffCenter(
         float left,
         float right,
@@ -27,6 +27,7 @@ public:
     static Mat4 CreateRotationMatrix(float axisX, float axisY, float axisZ, float angle);
     static Mat4 CreateRotationZ(float angle);
     static Mat4 CreateTranslation(float x, float y, float z);
+    static Mat4 CreateScale(float x, float y, float z);
     Mat4 operator*(const Mat4& other) const;
     static Mat4 CreateOrthographicOffCenter(float left, float right, float bottom, float top, float zNearPlane, float zFarPlane);
     static Mat4 CreatePerspectiveFieldOfView(float fieldOfView, float aspectRatio,
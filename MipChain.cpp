@@ -0,0 +1,105 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#include "MipChain.hpp"
+#include <SDL3/SDL_intrin.h>
+#include <cstring>
+
+namespace {
+    // Source texels of output texel i along an axis: 2i and 2i + 1, clamped on a size of 1. On odd sizes, the last
+    // output texel also covers the last source texel, so that no source row or column is dropped.
+    Uint32 GetTapCount(Uint32 i, Uint32 outSize, Uint32 sourceSize) {
+        const Uint32 first = i * 2;
+        if (i == outSize - 1 && first + 2 < sourceSize) { return 3; }
+        return first + 1 < sourceSize ? 2 : 1;
+    }
+
+    void DownsampleRowScalar(const Uint8* const* rows, Uint32 rowCount, Uint32 sourceWidth, Uint32 firstX,
+                             Uint32 outWidth, Uint8* outRow) {
+        for (Uint32 x = firstX; x < outWidth; ++x) {
+            const Uint32 x0 = x * 2;
+            const Uint32 columnCount = GetTapCount(x, outWidth, sourceWidth);
+            const Uint32 tapCount = columnCount * rowCount;
+            for (Uint32 c = 0; c < 4; ++c) {
+                Uint32 sum = 0;
+                for (Uint32 row = 0; row < rowCount; ++row) {
+                    for (Uint32 column = 0; column < columnCount; ++column) {
+                        sum += rows[row][(x0 + column) * 4 + c];
+                    }
+                }
+                outRow[x * 4 + c] = static_cast<Uint8>((sum + tapCount / 2) / tapCount);
+            }
+        }
+    }
+
+#ifdef SDL_SSE2_INTRINSICS
+    // Two output texels per iteration: 16 bytes from each source row are widened to 16 bits,
+    // summed vertically, then horizontally by pairing texels 0/2 with texels 1/3.
+    Uint32 DownsampleRowSSE2(const Uint8* row0, const Uint8* row1, Uint32 outWidth, Uint8* outRow) {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i rounding = _mm_set1_epi16(2);
+        Uint32 x = 0;
+        for (; x + 2 <= outWidth; x += 2) {
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row0 + x * 8));
+            const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row1 + x * 8));
+            const __m128i low = _mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+            const __m128i high = _mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+            const __m128i even = _mm_unpacklo_epi64(low, high);
+            const __m128i odd = _mm_unpackhi_epi64(low, high);
+            __m128i sum = _mm_add_epi16(_mm_add_epi16(even, odd), rounding);
+            sum = _mm_srli_epi16(sum, 2);
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(outRow + x * 4), _mm_packus_epi16(sum, zero));
+        }
+        return x;
+    }
+#endif
+}
+
+Uint32 MipChain::ComputeLevelCount(Uint32 width, Uint32 height) {
+    Uint32 size = SDL_max(width, height);
+    Uint32 levelCount = 1;
+    while (size > 1) {
+        size >>= 1;
+        ++levelCount;
+    }
+    return levelCount;
+}
+
+void MipChain::Build(const Uint8* pixels, Uint32 width, Uint32 height, vector<MipLevel>& outLevels) {
+    const Uint32 levelCount = ComputeLevelCount(width, height);
+    outLevels.resize(levelCount);
+    outLevels[0].width = width;
+    outLevels[0].height = height;
+    outLevels[0].pixels.assign(pixels, pixels + static_cast<size_t>(width) * height * 4);
+    for (Uint32 level = 1; level < levelCount; ++level) {
+        Downsample(outLevels[level - 1], outLevels[level]);
+    }
+}
+
+void MipChain::Downsample(const MipLevel& source, MipLevel& outLevel) {
+    outLevel.width = SDL_max(source.width / 2, 1u);
+    outLevel.height = SDL_max(source.height / 2, 1u);
+    outLevel.pixels.resize(static_cast<size_t>(outLevel.width) * outLevel.height * 4);
+
+    for (Uint32 y = 0; y < outLevel.height; ++y) {
+        const Uint32 y0 = y * 2;
+        const Uint32 rowCount = GetTapCount(y, outLevel.height, source.height);
+        const Uint8* rows[3];
+        for (Uint32 row = 0; row < rowCount; ++row) {
+            rows[row] = source.pixels.data() + static_cast<size_t>(y0 + row) * source.width * 4;
+        }
+        Uint8* outRow = outLevel.pixels.data() + static_cast<size_t>(y) * outLevel.width * 4;
+
+        Uint32 firstX = 0;
+#ifdef SDL_SSE2_INTRINSICS
+        // 2x2 texels only: the 3 tap row and column of odd sizes go through the scalar path
+        if (rowCount == 2) {
+            const Uint32 twoTapWidth = GetTapCount(outLevel.width - 1, outLevel.width, source.width) == 2
+                                       ? outLevel.width : outLevel.width - 1;
+            firstX = DownsampleRowSSE2(rows[0], rows[1], twoTapWidth, outRow);
+        }
+#endif
+        DownsampleRowScalar(rows, rowCount, source.width, firstX, outLevel.width, outRow);
+    }
+}
@@ -0,0 +1,38 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef MIPCHAIN_HPP
+#define MIPCHAIN_HPP
+
+#include <SDL3/SDL_stdinc.h>
+#include <vector>
+
+using std::vector;
+
+// One level of a RGBA8 mip chain, tightly packed
+struct MipLevel {
+    Uint32 width { 0 };
+    Uint32 height { 0 };
+    vector<Uint8> pixels;
+};
+
+/*
+ * CPU mip chain generation for RGBA8 images, for headless or offline use.
+ * At runtime, prefer Renderer::GenerateMipmaps which does the same work on the GPU.
+ */
+class MipChain {
+public:
+    // Number of levels down to 1x1 for a texture of this size
+    static Uint32 ComputeLevelCount(Uint32 width, Uint32 height);
+
+    // Build the full chain. Level 0 is a copy of the source image.
+    static void Build(const Uint8* pixels, Uint32 width, Uint32 height, vector<MipLevel>& outLevels);
+
+    // Halve a level with a 2x2 box filter. On odd sizes, the last row or column is folded into the edge texels,
+    // which average 3 texels on that axis.
+    static void Downsample(const MipLevel& source, MipLevel& outLevel);
+};
+
+
+#endif //MIPCHAIN_HPP
@@ -0,0 +1,137 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#include "ParticleSimulation.hpp"
+#include "Random.hpp"
+#include <SDL3/SDL_intrin.h>
+
+namespace {
+    // Scalar step of particle i, shared by both versions for the tail. Returns whether the particle is alive after.
+    bool SimulateParticle(ParticleArrays& p, Uint32 i, const ParticleSimulateUniforms& u) {
+        if (p.age[i] >= p.lifetime[i]) { return false; }
+
+        p.velocityX[i] = (p.velocityX[i] + u.gravityX * u.dt) * u.damping;
+        p.velocityY[i] = (p.velocityY[i] + u.gravityY * u.dt) * u.damping;
+        p.positionX[i] = p.positionX[i] + p.velocityX[i] * u.dt;
+        p.positionY[i] = p.positionY[i] + p.velocityY[i] * u.dt;
+        p.rotation[i] = p.rotation[i] + p.angularVelocity[i] * u.dt;
+        p.age[i] = p.age[i] + u.dt;
+
+        if (p.age[i] >= p.lifetime[i]) {
+            p.deadIndices.push_back(i);
+            return false;
+        }
+        return true;
+    }
+
+#ifdef SDL_SSE2_INTRINSICS
+    // a where mask is set, b elsewhere
+    inline __m128 Select(__m128 mask, __m128 a, __m128 b) {
+        return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+    }
+
+    // Steps particles by groups of four, returns the alive count. Dead particles are left untouched.
+    Uint32 SimulateSSE2(ParticleArrays& p, const ParticleSimulateUniforms& u, Uint32 count) {
+        const __m128 dt = _mm_set1_ps(u.dt);
+        const __m128 gravityX = _mm_set1_ps(u.gravityX * u.dt);
+        const __m128 gravityY = _mm_set1_ps(u.gravityY * u.dt);
+        const __m128 damping = _mm_set1_ps(u.damping);
+        Uint32 aliveCount = 0;
+
+        for (Uint32 i = 0; i + 4 <= count; i += 4) {
+            const __m128 age = _mm_loadu_ps(&p.age[i]);
+            const __m128 lifetime = _mm_loadu_ps(&p.lifetime[i]);
+            const __m128 wasAlive = _mm_cmplt_ps(age, lifetime);
+            const int wasAliveBits = _mm_movemask_ps(wasAlive);
+            if (wasAliveBits == 0) { continue; }
+
+            const __m128 velocityX = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(&p.velocityX[i]), gravityX), damping);
+            const __m128 velocityY = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(&p.velocityY[i]), gravityY), damping);
+            const __m128 positionX = _mm_loadu_ps(&p.positionX[i]);
+            const __m128 positionY = _mm_loadu_ps(&p.positionY[i]);
+            const __m128 rotation = _mm_loadu_ps(&p.rotation[i]);
+            const __m128 newAge = _mm_add_ps(age, dt);
+
+            _mm_storeu_ps(&p.velocityX[i], Select(wasAlive, velocityX, _mm_loadu_ps(&p.velocityX[i])));
+            _mm_storeu_ps(&p.velocityY[i], Select(wasAlive, velocityY, _mm_loadu_ps(&p.velocityY[i])));
+            _mm_storeu_ps(&p.positionX[i], Select(wasAlive, _mm_add_ps(positionX, _mm_mul_ps(velocityX, dt)),
+                                                  positionX));
+            _mm_storeu_ps(&p.positionY[i], Select(wasAlive, _mm_add_ps(positionY, _mm_mul_ps(velocityY, dt)),
+                                                  positionY));
+            const __m128 angularVelocity = _mm_loadu_ps(&p.angularVelocity[i]);
+            _mm_storeu_ps(&p.rotation[i], Select(wasAlive, _mm_add_ps(rotation, _mm_mul_ps(angularVelocity, dt)),
+                                                 rotation));
+            _mm_storeu_ps(&p.age[i], Select(wasAlive, newAge, age));
+
+            // Particles that die in this step go back to the free list
+            const int isAliveBits = _mm_movemask_ps(_mm_and_ps(wasAlive, _mm_cmplt_ps(newAge, lifetime)));
+            const int diedBits = wasAliveBits & ~isAliveBits;
+            for (Uint32 lane = 0; lane < 4; ++lane) {
+                if (diedBits & (1 << lane)) {
+                    p.deadIndices.push_back(i + lane);
+                }
+            }
+            aliveCount += (isAliveBits & 1) + ((isAliveBits >> 1) & 1) + ((isAliveBits >> 2) & 1)
+                    + ((isAliveBits >> 3) & 1);
+        }
+        return aliveCount;
+    }
+#endif
+}
+
+void ParticleArrays::Reset(Uint32 count) {
+    count = (count + 3) & ~3u;
+    for (vector<float>* array : { &positionX, &positionY, &velocityX, &velocityY, &rotation, &angularVelocity,
+                                  &age, &lifetime }) {
+        array->assign(count, 0.0f);
+    }
+    // Popped from the back: the first particles are emitted first, like the GPU dead list
+    deadIndices.resize(count);
+    for (Uint32 i = 0; i < count; ++i) {
+        deadIndices[i] = count - 1 - i;
+    }
+}
+
+Uint32 ParticleSimulation::Emit(ParticleArrays& particles, const ParticleEmitUniforms& uniforms, Random& random) {
+    const Uint32 emitCount = SDL_min(uniforms.emitCount, static_cast<Uint32>(particles.deadIndices.size()));
+    for (Uint32 n = 0; n < emitCount; ++n) {
+        const Uint32 i = particles.deadIndices.back();
+        particles.deadIndices.pop_back();
+
+        const float angle = uniforms.direction + random.NextFloat(-uniforms.spread, uniforms.spread);
+        const float speed = random.NextFloat(uniforms.speedMin, uniforms.speedMax);
+        particles.positionX[i] = uniforms.positionX;
+        particles.positionY[i] = uniforms.positionY;
+        particles.velocityX[i] = SDL_cosf(angle) * speed;
+        particles.velocityY[i] = SDL_sinf(angle) * speed;
+        particles.rotation[i] = random.NextAngle();
+        particles.angularVelocity[i] = random.NextFloat(-uniforms.angularSpeedMax, uniforms.angularSpeedMax);
+        particles.age[i] = 0;
+        particles.lifetime[i] = random.NextFloat(uniforms.lifetimeMin, uniforms.lifetimeMax);
+    }
+    return emitCount;
+}
+
+Uint32 ParticleSimulation::Simulate(ParticleArrays& particles, const ParticleSimulateUniforms& uniforms) {
+    const Uint32 count = SDL_min(uniforms.capacity, particles.GetCapacity());
+    Uint32 first = 0;
+    Uint32 aliveCount = 0;
+#ifdef SDL_SSE2_INTRINSICS
+    aliveCount = SimulateSSE2(particles, uniforms, count);
+    first = count & ~3u;
+#endif
+    for (Uint32 i = first; i < count; ++i) {
+        aliveCount += SimulateParticle(particles, i, uniforms) ? 1 : 0;
+    }
+    return aliveCount;
+}
+
+Uint32 ParticleSimulation::SimulateScalar(ParticleArrays& particles, const ParticleSimulateUniforms& uniforms) {
+    const Uint32 count = SDL_min(uniforms.capacity, particles.GetCapacity());
+    Uint32 aliveCount = 0;
+    for (Uint32 i = 0; i < count; ++i) {
+        aliveCount += SimulateParticle(particles, i, uniforms) ? 1 : 0;
+    }
+    return aliveCount;
+}
@@ -0,0 +1,83 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef PARTICLESIMULATION_HPP
+#define PARTICLESIMULATION_HPP
+
+#include <SDL3/SDL_stdinc.h>
+#include <vector>
+
+using std::vector;
+
+class Random;
+
+// Matches Particle in the Particle*.comp and ParticleSprite.vert shaders. A particle is dead when age >= lifetime.
+struct Particle {
+    float positionX, positionY;
+    float velocityX, velocityY;
+    float rotation, angularVelocity;
+    float age, lifetime;
+    float r, g, b, a;
+    float size;
+    float padding[3];
+};
+
+// Matches EmitUniforms in ParticleEmit.comp
+struct ParticleEmitUniforms {
+    float positionX, positionY;
+    // Particles leave in direction +/- spread, in radians
+    float direction, spread;
+    float speedMin, speedMax;
+    float lifetimeMin, lifetimeMax;
+    float size;
+    float angularSpeedMax;
+    Uint32 emitCount;
+    Uint32 seed;
+    float r, g, b, a;
+};
+
+// Matches SimulateUniforms in ParticleSimulate.comp
+struct ParticleSimulateUniforms {
+    float dt;
+    float gravityX, gravityY;
+    // Velocity factor per step, 1 - drag * dt
+    float damping;
+    Uint32 capacity;
+    float padding[3];
+};
+
+// Particle state split in arrays, so that the CPU reference steps four particles per SSE2 instruction
+struct ParticleArrays {
+    vector<float> positionX, positionY;
+    vector<float> velocityX, velocityY;
+    vector<float> rotation, angularVelocity;
+    vector<float> age, lifetime;
+    // Free list of dead particle indices, like the dead list of the GPU version
+    vector<Uint32> deadIndices;
+
+    // count dead particles. The count is rounded up to a multiple of four, the SIMD width.
+    void Reset(Uint32 count);
+
+    Uint32 GetCapacity() const { return static_cast<Uint32>(age.size()); }
+};
+
+/*
+ * CPU reference of the GPU particle system (see ParticleSystem), to validate and benchmark the integration
+ * headless. Integration does the same operations in the same order as ParticleSimulate.comp.
+ */
+class ParticleSimulation {
+public:
+    // Emit up to emitCount particles from the free list, with random numbers from random instead of the shader hash.
+    // Returns the emitted count.
+    static Uint32 Emit(ParticleArrays& particles, const ParticleEmitUniforms& uniforms, Random& random);
+
+    // Integrate the alive particles, free the ones that die. Returns the alive count. Uses SSE2 when available.
+    static Uint32 Simulate(ParticleArrays& particles, const ParticleSimulateUniforms& uniforms);
+
+    // Plain C++ version, to check the SIMD path against
+    static Uint32 SimulateScalar(ParticleArrays& particles, const ParticleSimulateUniforms& uniforms);
+};
+
+
+#endif //PARTICLESIMULATION_HPP
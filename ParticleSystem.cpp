@@ -0,0 +1,161 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#include "ParticleSystem.hpp"
+#include "Renderer.hpp"
+#include "Mat4.hpp"
+
+void ParticleSystem::Load(Renderer& renderer, const char* basePath, Uint32 capacity_) {
+    capacity = SDL_min(capacity_, MAX_CAPACITY);
+
+    // Every step reads and writes the particles, the free list and its counter
+    SDL_GPUComputePipelineCreateInfo createInfo = {
+        .num_readwrite_storage_buffers = 3,
+        .num_uniform_buffers = 1,
+        .threadcount_x = THREAD_GROUP_SIZE,
+        .threadcount_y = 1,
+        .threadcount_z = 1,
+    };
+    initPipeline = renderer.CreateComputePipelineFromShader(basePath, "ParticleInit.comp", &createInfo);
+    emitPipeline = renderer.CreateComputePipelineFromShader(basePath, "ParticleEmit.comp", &createInfo);
+    createInfo.num_readwrite_storage_buffers = 5;
+    simulatePipeline = renderer.CreateComputePipelineFromShader(basePath, "ParticleSimulate.comp", &createInfo);
+
+    particleBuffer = renderer.CreateBuffer(SDL_GPUBufferCreateInfo {
+        .usage = SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_READ | SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_WRITE
+                 | SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ,
+        .size = capacity * static_cast<Uint32>(sizeof(Particle))
+    });
+    renderer.SetBufferName(particleBuffer, "Particles");
+    deadListBuffer = renderer.CreateBuffer(SDL_GPUBufferCreateInfo {
+        .usage = SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_READ | SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_WRITE,
+        .size = capacity * static_cast<Uint32>(sizeof(Uint32))
+    });
+    renderer.SetBufferName(deadListBuffer, "Dead Particles");
+    counterBuffer = renderer.CreateBuffer(SDL_GPUBufferCreateInfo {
+        .usage = SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_READ | SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_WRITE,
+        .size = sizeof(Sint32)
+    });
+    renderer.SetBufferName(counterBuffer, "Dead Particle Count");
+    aliveListBuffer = renderer.CreateBuffer(SDL_GPUBufferCreateInfo {
+        .usage = SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_WRITE | SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ,
+        .size = capacity * static_cast<Uint32>(sizeof(Uint32))
+    });
+    renderer.SetBufferName(aliveListBuffer, "Alive Particles");
+    drawCommandBuffer = renderer.CreateBuffer(SDL_GPUBufferCreateInfo {
+        .usage = SDL_GPU_BUFFERUSAGE_INDIRECT | SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_WRITE,
+        .size = sizeof(SDL_GPUIndirectDrawCommand)
+    });
+    renderer.SetBufferName(drawCommandBuffer, "Particle Draw Command");
+    resetTransferBuffer = renderer.CreateTransferBuffer(SDL_GPUTransferBufferCreateInfo {
+        .usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+        .size = sizeof(SDL_GPUIndirectDrawCommand)
+    });
+
+    // Kill every particle and fill the free list on the GPU, instead of uploading the initial state
+    SDL_GPUStorageBufferReadWriteBinding bufferBindings[3] {
+        { .buffer = particleBuffer, .cycle = false },
+        { .buffer = deadListBuffer, .cycle = false },
+        { .buffer = counterBuffer, .cycle = false },
+    };
+    renderer.BeginCompute(nullptr, 0, bufferBindings, 3);
+    renderer.BindComputePipeline(initPipeline);
+    renderer.DispatchComputeForSize(capacity, 1, 1, 0);
+    renderer.EndCompute();
+}
+
+void ParticleSystem::Emit(Renderer& renderer, const ParticleEmitUniforms& uniforms) {
+    if (uniforms.emitCount == 0) { return; }
+    const Uint32 emitCount = SDL_min(uniforms.emitCount, capacity);
+
+    // Particle state persists from frame to frame: never cycle it
+    SDL_GPUStorageBufferReadWriteBinding bufferBindings[3] {
+        { .buffer = particleBuffer, .cycle = false },
+        { .buffer = deadListBuffer, .cycle = false },
+        { .buffer = counterBuffer, .cycle = false },
+    };
+    ParticleEmitUniforms emitUniforms = uniforms;
+    emitUniforms.emitCount = emitCount;
+    renderer.BeginCompute(nullptr, 0, bufferBindings, 3);
+    renderer.BindComputePipeline(emitPipeline);
+    renderer.PushComputeUniformData(0, &emitUniforms, sizeof(emitUniforms));
+    renderer.DispatchComputeForSize(emitCount, 1, 1);
+    renderer.EndCompute();
+}
+
+void ParticleSystem::Simulate(Renderer& renderer, float dt, float gravityX, float gravityY, float drag) {
+    // The shader only increments the instance count, so the command starts each frame with zero instances.
+    // Cycling gives this frame its own command while the previous frame may still draw with the old one.
+    auto command = static_cast<SDL_GPUIndirectDrawCommand*>(renderer.MapTransferBuffer(resetTransferBuffer, true));
+    *command = SDL_GPUIndirectDrawCommand {
+        .num_vertices = VERTICES_PER_PARTICLE,
+        .num_instances = 0,
+        .first_vertex = 0,
+        .first_instance = 0
+    };
+    renderer.UnmapTransferBuffer(resetTransferBuffer);
+    renderer.BeginUploadToBuffer();
+    SDL_GPUTransferBufferLocation source {
+        .transfer_buffer = resetTransferBuffer,
+        .offset = 0
+    };
+    SDL_GPUBufferRegion destination {
+        .buffer = drawCommandBuffer,
+        .offset = 0,
+        .size = sizeof(SDL_GPUIndirectDrawCommand)
+    };
+    renderer.UploadToBuffer(source, destination, true);
+    renderer.EndUploadToBuffer(resetTransferBuffer, false);
+
+    const ParticleSimulateUniforms uniforms {
+        .dt = dt,
+        .gravityX = gravityX,
+        .gravityY = gravityY,
+        .damping = SDL_max(0.0f, 1.0f - drag * dt),
+        .capacity = capacity
+    };
+
+    // The alive list is rebuilt every frame, so it can cycle. The command must not cycle again: the reset
+    // would be lost.
+    SDL_GPUStorageBufferReadWriteBinding bufferBindings[5] {
+        { .buffer = particleBuffer, .cycle = false },
+        { .buffer = deadListBuffer, .cycle = false },
+        { .buffer = counterBuffer, .cycle = false },
+        { .buffer = aliveListBuffer, .cycle = true },
+        { .buffer = drawCommandBuffer, .cycle = false },
+    };
+    renderer.BeginCompute(nullptr, 0, bufferBindings, 5);
+    renderer.BindComputePipeline(simulatePipeline);
+    renderer.PushComputeUniformData(0, &uniforms, sizeof(uniforms));
+    renderer.DispatchComputeForSize(capacity, 1, 1);
+    renderer.EndCompute();
+}
+
+void ParticleSystem::Draw(Renderer& renderer, const Mat4& viewProjection) const {
+    SDL_GPUBuffer* storageBuffers[2] { particleBuffer, aliveListBuffer };
+    renderer.BindVertexStorageBuffers(0, storageBuffers, 2);
+    renderer.PushVertexUniformData(0, &viewProjection, sizeof(Mat4));
+    renderer.DrawPrimitivesIndirect(drawCommandBuffer, 0, 1);
+}
+
+void ParticleSystem::Unload(Renderer& renderer) {
+    renderer.ReleaseBuffer(particleBuffer);
+    renderer.ReleaseBuffer(deadListBuffer);
+    renderer.ReleaseBuffer(counterBuffer);
+    renderer.ReleaseBuffer(aliveListBuffer);
+    renderer.ReleaseBuffer(drawCommandBuffer);
+    renderer.ReleaseTransferBuffer(resetTransferBuffer);
+    renderer.ReleaseComputePipeline(initPipeline);
+    renderer.ReleaseComputePipeline(emitPipeline);
+    renderer.ReleaseComputePipeline(simulatePipeline);
+    particleBuffer = nullptr;
+    deadListBuffer = nullptr;
+    counterBuffer = nullptr;
+    aliveListBuffer = nullptr;
+    drawCommandBuffer = nullptr;
+    resetTransferBuffer = nullptr;
+    initPipeline = nullptr;
+    emitPipeline = nullptr;
+    simulatePipeline = nullptr;
+}
@@ -0,0 +1,63 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef PARTICLESYSTEM_HPP
+#define PARTICLESYSTEM_HPP
+
+#include <SDL3/SDL_gpu.h>
+#include "ParticleSimulation.hpp"
+
+class Renderer;
+class Mat4;
+
+/*
+ * GPU particle system. The particles, a free list of dead particle indices and its counter live in storage buffers
+ * and never come back to the CPU:
+ * - ParticleEmit.comp pops dead indices with an atomic decrement of the counter and spawns particles there,
+ * - ParticleSimulate.comp integrates the alive particles, pushes the ones that die back on the free list, and compacts
+ *   the alive indices in a list whose length is the instance count of an indirect draw.
+ * The CPU only sends the emit count and the frame constants, whatever the particle count. ParticleSprite.vert then
+ * expands each alive particle to a sprite quad. ParticleSimulation is the CPU reference.
+ */
+class ParticleSystem {
+public:
+    // Must match the numthreads of the Particle*.comp shaders
+    static constexpr Uint32 THREAD_GROUP_SIZE = 64;
+    // The simulation dispatches one thread per particle, on a single dimension
+    static constexpr Uint32 MAX_CAPACITY = 65535 * THREAD_GROUP_SIZE;
+    static constexpr Uint32 VERTICES_PER_PARTICLE = 6;
+
+    // Every particle starts dead
+    void Load(Renderer& renderer, const char* basePath, Uint32 capacity);
+
+    // Spawn uniforms.emitCount particles at most, fewer when the free list runs out. Call outside of a render pass.
+    void Emit(Renderer& renderer, const ParticleEmitUniforms& uniforms);
+
+    // Integrate, free the dead particles and build the draw. Call outside of a render pass, once per frame.
+    void Simulate(Renderer& renderer, float dt, float gravityX, float gravityY, float drag);
+
+    // Bind the particle and alive lists at vertex storage slots 0 and 1, and the view projection at vertex uniform
+    // slot 0, then issue the indirect draw. Use with ParticleSprite.vert and no vertex buffer.
+    void Draw(Renderer& renderer, const Mat4& viewProjection) const;
+
+    void Unload(Renderer& renderer);
+
+    Uint32 GetCapacity() const { return capacity; }
+
+private:
+    SDL_GPUComputePipeline* initPipeline { nullptr };
+    SDL_GPUComputePipeline* emitPipeline { nullptr };
+    SDL_GPUComputePipeline* simulatePipeline { nullptr };
+    SDL_GPUBuffer* particleBuffer { nullptr };
+    SDL_GPUBuffer* deadListBuffer { nullptr };
+    // Dead particle count, signed so that emission can overshoot then give back
+    SDL_GPUBuffer* counterBuffer { nullptr };
+    SDL_GPUBuffer* aliveListBuffer { nullptr };
+    SDL_GPUBuffer* drawCommandBuffer { nullptr };
+    SDL_GPUTransferBuffer* resetTransferBuffer { nullptr };
+    Uint32 capacity { 0 };
+};
+
+
+#endif //PARTICLESYSTEM_HPP
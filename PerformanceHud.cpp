@@ -0,0 +1,168 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#include "PerformanceHud.hpp"
+#include "GlyphAtlas.hpp"
+#include "Renderer.hpp"
+#include "Time.hpp"
+#include "Mat4.hpp"
+#include <SDL3/SDL.h>
+
+namespace {
+    // In swapchain pixels
+    constexpr float PANEL_X = 8.0f;
+    constexpr float PANEL_Y = 8.0f;
+    constexpr float PADDING = 6.0f;
+    constexpr float BAR_WIDTH = 2.0f;
+    constexpr float GRAPH_WIDTH = BAR_WIDTH * Time::HISTORY_SIZE;
+    constexpr float GRAPH_HEIGHT = 60.0f;
+    constexpr Uint32 COUNTER_LINE_COUNT = 7;
+    // Bitmap glyphs from the 8 x 16 mip level of the atlas
+    constexpr float TEXT_SCALE = 0.25f;
+
+    constexpr SDL_FColor PANEL_COLOR { 0.0f, 0.0f, 0.0f, 0.6f };
+    constexpr SDL_FColor TEXT_COLOR { 0.9f, 0.9f, 0.9f, 1.0f };
+    constexpr SDL_FColor ON_TIME_COLOR { 0.3f, 0.8f, 0.3f, 1.0f };
+    constexpr SDL_FColor LATE_COLOR { 0.9f, 0.7f, 0.2f, 1.0f };
+    constexpr SDL_FColor VERY_LATE_COLOR { 0.9f, 0.25f, 0.2f, 1.0f };
+    constexpr SDL_FColor WORK_COLOR { 1.0f, 1.0f, 1.0f, 0.35f };
+    constexpr SDL_FColor TARGET_LINE_COLOR { 1.0f, 1.0f, 1.0f, 0.5f };
+
+    constexpr double MEGABYTE = 1024.0 * 1024.0;
+}
+
+void PerformanceHud::Load(Renderer& renderer, const char* basePath, const Time& time_) {
+    time = &time_;
+    textRenderer.Load(renderer, basePath, MAX_GLYPHS,
+                      SDL_GetGPUSwapchainTextureFormat(renderer.device, renderer.renderWindow));
+    renderer.SetOverlay([this](Renderer& overlayRenderer) { Draw(overlayRenderer); });
+    SDL_AddEventWatch(OnKeyEvent, this);
+    SDL_Log("Press F1 to toggle the performance HUD");
+}
+
+void PerformanceHud::Unload(Renderer& renderer) {
+    SDL_RemoveEventWatch(OnKeyEvent, this);
+    renderer.SetOverlay({});
+    textRenderer.Unload(renderer);
+}
+
+void PerformanceHud::Draw(Renderer& renderer) {
+    if (!IsVisible()) { return; }
+    const Uint64 start = SDL_GetPerformanceCounter();
+
+    uploadBytesSinceRefresh += renderer.GetFrameStats().uploadBytes;
+    ++framesSinceRefresh;
+    const Uint64 refreshTicks = static_cast<Uint64>(REFRESH_PERIOD * SDL_GetPerformanceFrequency());
+    if (start - lastRefreshCounter >= refreshTicks) {
+        RefreshCounters(renderer);
+        lastRefreshCounter = start;
+    }
+
+    textRenderer.Begin();
+    const float textHeight = COUNTER_LINE_COUNT * GlyphAtlas::LINE_HEIGHT * TEXT_SCALE;
+    textRenderer.AddRect(PANEL_X, PANEL_Y, GRAPH_WIDTH + 2 * PADDING, GRAPH_HEIGHT + textHeight + 3 * PADDING,
+                         PANEL_COLOR);
+
+    // Oldest frame on the left. Work bars are drawn over the frame bars: the gap above is the wait for the cap.
+    const float graphBottom = PANEL_Y + PADDING + GRAPH_HEIGHT;
+    for (Uint32 i = 0; i < Time::HISTORY_SIZE; ++i) {
+        const float frameTime = time->GetFrameTime(i);
+        const float x = PANEL_X + PADDING + static_cast<float>(i) * BAR_WIDTH;
+        const float frameHeight = SDL_min(frameTime / GRAPH_MAX_TIME, 1.0f) * GRAPH_HEIGHT;
+        const float workHeight = SDL_min(time->GetWorkTime(i) / GRAPH_MAX_TIME, 1.0f) * GRAPH_HEIGHT;
+        const SDL_FColor& color = frameTime <= TARGET_FRAME_TIME * 1.05f ? ON_TIME_COLOR
+                                  : frameTime <= TARGET_FRAME_TIME * 1.5f ? LATE_COLOR : VERY_LATE_COLOR;
+        textRenderer.AddRect(x, graphBottom - frameHeight, BAR_WIDTH, frameHeight, color);
+        textRenderer.AddRect(x, graphBottom - workHeight, BAR_WIDTH, workHeight, WORK_COLOR);
+    }
+    const float targetY = graphBottom - TARGET_FRAME_TIME / GRAPH_MAX_TIME * GRAPH_HEIGHT;
+    textRenderer.AddRect(PANEL_X + PADDING, targetY, GRAPH_WIDTH, 1.0f, TARGET_LINE_COLOR);
+
+    textRenderer.AddText(counterText, PANEL_X + PADDING, graphBottom + PADDING, TEXT_SCALE, TEXT_COLOR,
+                         FontMode::Bitmap);
+    textRenderer.Upload(renderer);
+
+    // Over whatever the scene rendered
+    SDL_GPUColorTargetInfo colorTargetInfo {
+        .texture = renderer.swapchainTexture,
+        .load_op = SDL_GPU_LOADOP_LOAD,
+        .store_op = SDL_GPU_STOREOP_STORE,
+    };
+    renderer.BeginRenderPass(colorTargetInfo);
+    const Mat4 viewProjection = Mat4::CreateOrthographicOffCenter(0, static_cast<float>(renderer.swapchainWidth),
+                                                                  static_cast<float>(renderer.swapchainHeight), 0,
+                                                                  0, -1);
+    textRenderer.Draw(renderer, viewProjection);
+    renderer.EndRenderPass();
+
+    const Uint64 end = SDL_GetPerformanceCounter();
+    drawTime = static_cast<float>(static_cast<double>(end - start) * 1000.0
+                                  / static_cast<double>(SDL_GetPerformanceFrequency()));
+    LogDrawTime(end);
+}
+
+void PerformanceHud::LogDrawTime(Uint64 counter) {
+    drawTimeSum += drawTime;
+    drawTimeMax = SDL_max(drawTimeMax, drawTime);
+    ++framesSinceLog;
+    const Uint64 logTicks = static_cast<Uint64>(LOG_PERIOD * SDL_GetPerformanceFrequency());
+    if (counter - lastLogCounter < logTicks) { return; }
+
+    // The first period starts with the HUD, the time since the counter origin is not a period
+    if (lastLogCounter != 0) {
+        const float average = drawTimeSum / static_cast<float>(framesSinceLog);
+        SDL_Log("HUD CPU time over %u frames: %.3f ms avg, %.3f ms max, target %.1f ms%s", framesSinceLog,
+                average, drawTimeMax, TARGET_DRAW_TIME, average > TARGET_DRAW_TIME ? ", over target" : "");
+    }
+    lastLogCounter = counter;
+    drawTimeSum = 0;
+    drawTimeMax = 0;
+    framesSinceLog = 0;
+}
+
+void PerformanceHud::RefreshCounters(const Renderer& renderer) {
+    float frameSum = 0;
+    float frameMax = 0;
+    float workSum = 0;
+    float workMax = 0;
+    for (Uint32 i = 0; i < Time::HISTORY_SIZE; ++i) {
+        frameSum += time->GetFrameTime(i);
+        frameMax = SDL_max(frameMax, time->GetFrameTime(i));
+        workSum += time->GetWorkTime(i);
+        workMax = SDL_max(workMax, time->GetWorkTime(i));
+    }
+    const float frameAverage = frameSum / Time::HISTORY_SIZE;
+    const float workAverage = workSum / Time::HISTORY_SIZE;
+
+    const RendererStats& stats = renderer.GetFrameStats();
+    const GpuMemoryStats memory = renderer.GetGpuMemoryStats();
+    const double uploadKilobytes = static_cast<double>(uploadBytesSinceRefresh) / 1024.0
+                                   / SDL_max(framesSinceRefresh, 1u);
+    SDL_snprintf(counterText, sizeof(counterText),
+                 "Frame %5.2f ms avg %5.2f max %5.1f fps\n"
+                 "Work  %5.2f ms avg %5.2f max\n"
+                 "Draws %u  Dispatches %u  Pipelines %u\n"
+                 "Binds %u  Uniforms %u  Skipped %u\n"
+                 "Upload %.1f KB per frame\n"
+                 "GPU %.1f MB: tex %.1f buf %.1f xfer %.1f\n"
+                 "HUD %.3f ms",
+                 frameAverage, frameMax, frameAverage > 0 ? 1000.0f / frameAverage : 0.0f,
+                 workAverage, workMax,
+                 stats.drawCalls, stats.dispatches, stats.pipelineBinds,
+                 stats.bufferBinds + stats.samplerBinds, stats.uniformPushes, stats.skippedStateChanges,
+                 uploadKilobytes,
+                 memory.Total() / MEGABYTE, memory.textureBytes / MEGABYTE, memory.bufferBytes / MEGABYTE,
+                 memory.transferBufferBytes / MEGABYTE,
+                 drawTime);
+    uploadBytesSinceRefresh = 0;
+    framesSinceRefresh = 0;
+}
+
+bool SDLCALL PerformanceHud::OnKeyEvent(void* userData, SDL_Event* event) {
+    if (event->type == SDL_EVENT_KEY_DOWN && event->key.key == TOGGLE_KEY && !event->key.repeat) {
+        auto hud = static_cast<PerformanceHud*>(userData);
+        hud->SetVisible(!hud->IsVisible());
+    }
+    return true;
+}
@@ -0,0 +1,68 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef PERFORMANCEHUD_HPP
+#define PERFORMANCEHUD_HPP
+
+#include <SDL3/SDL_atomic.h>
+#include <SDL3/SDL_events.h>
+#include "TextRenderer.hpp"
+
+class Time;
+
+/*
+ * Overlay of frame times and renderer counters, drawn over every scene as the renderer overlay. F1 toggles it.
+ * A graph of the last Time::HISTORY_SIZE frames, their time and the part spent working before the frame cap, then
+ * the counters of the previous frame: draws, dispatches, state changes, uploaded bytes and GPU memory.
+ * Panel, graph and text are a single TextRenderer batch, drawn in its own load-and-store pass over the swapchain.
+ * Counters are formatted every REFRESH_PERIOD, so that their text layout is reused in between.
+ * While visible, the average and worst CPU time of the HUD frames are logged every LOG_PERIOD, against
+ * TARGET_DRAW_TIME.
+ */
+class PerformanceHud {
+public:
+    static constexpr Uint32 MAX_GLYPHS = 1024;
+    static constexpr float REFRESH_PERIOD = 0.25f; // Seconds
+    static constexpr float LOG_PERIOD = 1.0f; // Seconds
+    static constexpr float TARGET_DRAW_TIME = 0.1f; // Milliseconds of CPU per HUD frame
+    static constexpr SDL_Keycode TOGGLE_KEY = SDLK_F1;
+    static constexpr float TARGET_FRAME_TIME = 1000.0f / 60.0f; // Milliseconds, at the top of green bars
+    static constexpr float GRAPH_MAX_TIME = 2.0f * TARGET_FRAME_TIME;
+
+    // time must outlive the HUD
+    void Load(Renderer& renderer, const char* basePath, const Time& time);
+
+    void Unload(Renderer& renderer);
+
+    void SetVisible(bool isVisible_) { SDL_SetAtomicInt(&isVisible, isVisible_ ? 1 : 0); }
+    bool IsVisible() { return SDL_GetAtomicInt(&isVisible) != 0; }
+
+private:
+    // Renderer overlay
+    void Draw(Renderer& renderer);
+
+    void RefreshCounters(const Renderer& renderer);
+
+    // Accumulate drawTime, and log its average and maximum when LOG_PERIOD elapsed since the last log
+    void LogDrawTime(Uint64 counter);
+
+    // Event watch, may run on another thread
+    static bool SDLCALL OnKeyEvent(void* userData, SDL_Event* event);
+
+    TextRenderer textRenderer;
+    const Time* time { nullptr };
+    SDL_AtomicInt isVisible {};
+
+    char counterText[512] {};
+    Uint64 lastRefreshCounter { 0 };
+    Uint64 uploadBytesSinceRefresh { 0 };
+    Uint32 framesSinceRefresh { 0 };
+    float drawTime { 0 }; // Milliseconds of CPU taken by the last HUD frame
+    float drawTimeSum { 0 };
+    float drawTimeMax { 0 };
+    Uint32 framesSinceLog { 0 };
+    Uint64 lastLogCounter { 0 };
+};
+
+#endif //PERFORMANCEHUD_HPP
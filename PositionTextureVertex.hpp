@@ -11,4 +11,20 @@ typedef struct PositionTextureVertex
     float u, v;
 } PositionTextureVertex;
 
+struct PositionTextureColorVertex
+{
+    float x, y, z, w;
+    float u, v, padding_a, padding_b;
+    float r, g, b, a;
+};
+
+// Expanded to four PositionTextureColorVertex by SpriteBatch.comp, or GlyphBatch.comp for text
+struct ComputeSpriteInstance
+{
+    float x, y, z;
+    float rotation;
+    float w, h, padding_a, padding_b;
+    float r, g, b, a;
+};
+
 #endif //POSITIONTEXTUREVERTEX_HPP
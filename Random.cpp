@@ -0,0 +1,166 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#include "Random.hpp"
+#include <SDL3/SDL_intrin.h>
+
+namespace {
+    // 24 high bits to a float in [0, 1)
+    constexpr float FLOAT_UNIT = 1.0f / 16777216.0f;
+
+    // Odd constant, so that the seeding sequences of streams start far apart
+    constexpr Uint64 STREAM_INCREMENT = 0xD1B54A32D192ED03ull;
+
+    // Jump polynomial of xoshiro128, equivalent to 2^64 steps
+    constexpr Uint32 JUMP[4] = { 0x8764000Bu, 0xF542D2D3u, 0x6FA035C3u, 0x77F2DB5Bu };
+
+    // Seeds the state words, as recommended by the xoshiro authors
+    Uint64 SplitMix64(Uint64& x) {
+        Uint64 z = (x += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    inline Uint32 RotateLeft(Uint32 x, int k) {
+        return (x << k) | (x >> (32 - k));
+    }
+
+    // One xoshiro128+ step of a lane
+    inline Uint32 Step(Uint32& s0, Uint32& s1, Uint32& s2, Uint32& s3) {
+        const Uint32 result = s0 + s3;
+        const Uint32 t = s1 << 9;
+        s2 ^= s0;
+        s3 ^= s1;
+        s1 ^= s2;
+        s0 ^= s3;
+        s2 ^= t;
+        s3 = RotateLeft(s3, 11);
+        return result;
+    }
+
+    // unitScale is FLOAT_UNIT * (max - min)
+    inline float ToFloat(Uint32 value, float min, float unitScale) {
+        return min + static_cast<float>(value >> 8) * unitScale;
+    }
+}
+
+Random::Random(Uint64 seed, Uint64 stream) {
+    Seed(seed, stream);
+}
+
+void Random::Seed(Uint64 seed, Uint64 stream) {
+    Uint64 x = seed + stream * STREAM_INCREMENT;
+    for (Uint32 lane = 0; lane < LANE_COUNT; ++lane) {
+        const Uint64 low = SplitMix64(x);
+        const Uint64 high = SplitMix64(x);
+        state[0][lane] = static_cast<Uint32>(low);
+        state[1][lane] = static_cast<Uint32>(low >> 32);
+        state[2][lane] = static_cast<Uint32>(high);
+        state[3][lane] = static_cast<Uint32>(high >> 32);
+    }
+    bufferIndex = LANE_COUNT;
+}
+
+void Random::Jump() {
+    for (Uint32 lane = 0; lane < LANE_COUNT; ++lane) {
+        Uint32 s0 = state[0][lane], s1 = state[1][lane], s2 = state[2][lane], s3 = state[3][lane];
+        Uint32 j0 = 0, j1 = 0, j2 = 0, j3 = 0;
+        for (Uint32 word : JUMP) {
+            for (int bit = 0; bit < 32; ++bit) {
+                if (word & (1u << bit)) {
+                    j0 ^= s0;
+                    j1 ^= s1;
+                    j2 ^= s2;
+                    j3 ^= s3;
+                }
+                Step(s0, s1, s2, s3);
+            }
+        }
+        state[0][lane] = j0;
+        state[1][lane] = j1;
+        state[2][lane] = j2;
+        state[3][lane] = j3;
+    }
+    bufferIndex = LANE_COUNT;
+}
+
+void Random::Refill() {
+    for (Uint32 lane = 0; lane < LANE_COUNT; ++lane) {
+        buffer[lane] = Step(state[0][lane], state[1][lane], state[2][lane], state[3][lane]);
+    }
+    bufferIndex = 0;
+}
+
+Uint32 Random::NextUint32() {
+    if (bufferIndex == LANE_COUNT) { Refill(); }
+    return buffer[bufferIndex++];
+}
+
+Uint32 Random::NextUint32(Uint32 min, Uint32 max) {
+    // Multiply then keep the high bits, instead of a modulo
+    return min + static_cast<Uint32>((static_cast<Uint64>(NextUint32()) * (max - min)) >> 32);
+}
+
+float Random::NextFloat() {
+    return ToFloat(NextUint32(), 0.0f, FLOAT_UNIT);
+}
+
+float Random::NextFloat(float min, float max) {
+    return ToFloat(NextUint32(), min, FLOAT_UNIT * (max - min));
+}
+
+float Random::NextAngle() {
+    return NextFloat(0.0f, SDL_PI_F * 2);
+}
+
+void Random::FillUint32(Uint32* outValues, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        outValues[i] = NextUint32();
+    }
+}
+
+void Random::FillFloat(float* outValues, size_t count, float min, float max) {
+    const float unitScale = FLOAT_UNIT * (max - min);
+    size_t i = 0;
+    // Use up the buffered numbers first, so that the lanes are in step
+    while (i < count && bufferIndex < LANE_COUNT) {
+        outValues[i++] = ToFloat(buffer[bufferIndex++], min, unitScale);
+    }
+
+#ifdef SDL_SSE2_INTRINSICS
+    __m128i s0 = _mm_load_si128(reinterpret_cast<const __m128i*>(state[0]));
+    __m128i s1 = _mm_load_si128(reinterpret_cast<const __m128i*>(state[1]));
+    __m128i s2 = _mm_load_si128(reinterpret_cast<const __m128i*>(state[2]));
+    __m128i s3 = _mm_load_si128(reinterpret_cast<const __m128i*>(state[3]));
+    const __m128 minimum = _mm_set1_ps(min);
+    const __m128 unitScales = _mm_set1_ps(unitScale);
+    for (; i + LANE_COUNT <= count; i += LANE_COUNT) {
+        const __m128i result = _mm_add_epi32(s0, s3);
+        const __m128i t = _mm_slli_epi32(s1, 9);
+        s2 = _mm_xor_si128(s2, s0);
+        s3 = _mm_xor_si128(s3, s1);
+        s1 = _mm_xor_si128(s1, s2);
+        s0 = _mm_xor_si128(s0, s3);
+        s2 = _mm_xor_si128(s2, t);
+        s3 = _mm_or_si128(_mm_slli_epi32(s3, 11), _mm_srli_epi32(s3, 21));
+
+        // 24 bits fit a signed conversion. Same operation order as ToFloat.
+        const __m128 unit = _mm_cvtepi32_ps(_mm_srli_epi32(result, 8));
+        _mm_storeu_ps(outValues + i, _mm_add_ps(minimum, _mm_mul_ps(unit, unitScales)));
+    }
+    _mm_store_si128(reinterpret_cast<__m128i*>(state[0]), s0);
+    _mm_store_si128(reinterpret_cast<__m128i*>(state[1]), s1);
+    _mm_store_si128(reinterpret_cast<__m128i*>(state[2]), s2);
+    _mm_store_si128(reinterpret_cast<__m128i*>(state[3]), s3);
+#endif
+
+    for (; i < count; ++i) {
+        outValues[i] = ToFloat(NextUint32(), min, unitScale);
+    }
+}
+
+void Random::FillAngle(float* outValues, size_t count) {
+    FillFloat(outValues, count, 0.0f, SDL_PI_F * 2);
+}
@@ -0,0 +1,62 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef RANDOM_HPP
+#define RANDOM_HPP
+
+#include <SDL3/SDL_stdinc.h>
+
+/*
+ * xoshiro128+ pseudo random generator, with four interleaved lanes so that batches fill four numbers per SSE2
+ * step. Single numbers are served from the last step of the lanes.
+ *
+ * A generator is not thread safe: give each thread, or each parallel range, its own. The same seed and stream
+ * always give the same numbers, on any platform and whatever thread runs the generator. Batch fills give the same
+ * numbers as the matching single calls, in order.
+ */
+class Random {
+public:
+    static constexpr Uint32 LANE_COUNT = 4;
+
+    // Streams of a seed are seeded apart. Use Jump for streams that are guaranteed not to overlap.
+    explicit Random(Uint64 seed = 0, Uint64 stream = 0);
+
+    void Seed(Uint64 seed, Uint64 stream = 0);
+
+    // Advance by 2^64 numbers per lane, for up to 2^64 long non overlapping sequences
+    void Jump();
+
+    Uint32 NextUint32();
+
+    // In [min, max), min < max. The bias is below (max - min) / 2^32.
+    Uint32 NextUint32(Uint32 min, Uint32 max);
+
+    // In [0, 1), with 24 bits of precision
+    float NextFloat();
+
+    // In [min, max)
+    float NextFloat(float min, float max);
+
+    // In [0, 2 pi), for rotations
+    float NextAngle();
+
+    void FillUint32(Uint32* outValues, size_t count);
+
+    // count floats in [min, max). Uses SSE2 when available.
+    void FillFloat(float* outValues, size_t count, float min, float max);
+
+    void FillAngle(float* outValues, size_t count);
+
+private:
+    // Step all lanes once and keep the results in buffer
+    void Refill();
+
+    // state[i][lane]: word i of each lane, contiguous for SIMD loads
+    alignas(16) Uint32 state[4][LANE_COUNT] {};
+    alignas(16) Uint32 buffer[LANE_COUNT] {};
+    Uint32 bufferIndex { LANE_COUNT };
+};
+
+
+#endif //RANDOM_HPP
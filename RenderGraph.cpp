@@ -0,0 +1,323 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#include "RenderGraph.hpp"
+#include "Renderer.hpp"
+#include <SDL3/SDL_log.h>
+#include <algorithm>
+
+RenderGraphTexture RenderGraph::ImportTexture(const string& name, SDL_GPUTexture* texture,
+                                              const RenderGraphTextureDescription& description) {
+    textures.push_back(TextureResource {
+        .name = name,
+        .description = description,
+        .texture = texture,
+        .isImported = true
+    });
+    return RenderGraphTexture { static_cast<Uint32>(textures.size() - 1) };
+}
+
+RenderGraphBuffer RenderGraph::ImportBuffer(const string& name, SDL_GPUBuffer* buffer) {
+    buffers.push_back(BufferResource { name, buffer });
+    return RenderGraphBuffer { static_cast<Uint32>(buffers.size() - 1) };
+}
+
+RenderGraphTexture RenderGraph::CreateTexture(const string& name, const RenderGraphTextureDescription& description) {
+    textures.push_back(TextureResource {
+        .name = name,
+        .description = description
+    });
+    return RenderGraphTexture { static_cast<Uint32>(textures.size() - 1) };
+}
+
+void RenderGraph::AddPass(RenderGraphPassDescription&& pass) {
+    passes.push_back(std::move(pass));
+}
+
+SDL_GPUTexture* RenderGraph::GetTexture(RenderGraphTexture texture) const {
+    return texture.IsValid() ? textures[texture.index].texture : nullptr;
+}
+
+SDL_GPUBuffer* RenderGraph::GetBuffer(RenderGraphBuffer buffer) const {
+    return buffer.IsValid() ? buffers[buffer.index].buffer : nullptr;
+}
+
+const RenderGraphTextureDescription& RenderGraph::GetDescription(RenderGraphTexture texture) const {
+    return textures[texture.index].description;
+}
+
+void RenderGraph::Execute(Renderer& renderer) {
+    vector<Dependency> dependencies;
+    BuildDependencies(dependencies);
+    vector<bool> isNeeded;
+    CullPasses(dependencies, isNeeded);
+    SortPasses(dependencies, isNeeded);
+    AssignPhysicalTextures(renderer);
+
+    vector<bool> isWritten(textures.size(), false);
+    for (Uint32 passIndex : executionOrder) {
+        ExecutePass(renderer, passes[passIndex], isWritten);
+    }
+
+    textures.clear();
+    buffers.clear();
+    passes.clear();
+    executionOrder.clear();
+    ++frame;
+}
+
+void RenderGraph::BuildDependencies(vector<Dependency>& outDependencies) const {
+    // Accesses are tracked per resource in declaration order. Buffers come after textures.
+    struct AccessState {
+        Uint32 lastWriter { NONE };
+        vector<Uint32> readers;        // Readers of the last written version
+        vector<Uint32> pendingReaders; // Readers declared before any writer
+    };
+    vector<AccessState> states(textures.size() + buffers.size());
+
+    auto read = [&](Uint32 resource, Uint32 pass) {
+        AccessState& state = states[resource];
+        if (state.lastWriter == NONE) {
+            state.pendingReaders.push_back(pass);
+        } else {
+            if (state.lastWriter != pass) { outDependencies.push_back(Dependency { state.lastWriter, pass, true }); }
+            state.readers.push_back(pass);
+        }
+    };
+    auto write = [&](Uint32 resource, Uint32 pass) {
+        AccessState& state = states[resource];
+        if (state.lastWriter != NONE && state.lastWriter != pass) {
+            outDependencies.push_back(Dependency { state.lastWriter, pass, true });
+        }
+        for (Uint32 reader : state.readers) {
+            if (reader != pass) { outDependencies.push_back(Dependency { reader, pass, false }); }
+        }
+        // Passes may be declared before the pass producing what they read
+        if (state.lastWriter == NONE) {
+            for (Uint32 reader : state.pendingReaders) {
+                if (reader != pass) { outDependencies.push_back(Dependency { pass, reader, true }); }
+            }
+            state.pendingReaders.clear();
+        }
+        state.lastWriter = pass;
+        state.readers.clear();
+    };
+
+    const Uint32 bufferOffset = static_cast<Uint32>(textures.size());
+    for (Uint32 pass = 0; pass < passes.size(); ++pass) {
+        for (RenderGraphTexture texture : passes[pass].textureReads) { read(texture.index, pass); }
+        for (RenderGraphBuffer buffer : passes[pass].bufferReads) { read(bufferOffset + buffer.index, pass); }
+        for (RenderGraphTexture texture : passes[pass].textureWrites) { write(texture.index, pass); }
+        for (RenderGraphBuffer buffer : passes[pass].bufferWrites) { write(bufferOffset + buffer.index, pass); }
+    }
+}
+
+void RenderGraph::CullPasses(const vector<Dependency>& dependencies, vector<bool>& outIsNeeded) const {
+    // Passes with a visible result are roots, then every pass producing data for a needed pass is needed
+    outIsNeeded.assign(passes.size(), false);
+    vector<Uint32> toVisit;
+    for (Uint32 pass = 0; pass < passes.size(); ++pass) {
+        bool isRoot = passes[pass].hasSideEffects || !passes[pass].bufferWrites.empty();
+        for (RenderGraphTexture texture : passes[pass].textureWrites) {
+            isRoot = isRoot || textures[texture.index].isImported;
+        }
+        if (isRoot) {
+            outIsNeeded[pass] = true;
+            toVisit.push_back(pass);
+        }
+    }
+    while (!toVisit.empty()) {
+        const Uint32 pass = toVisit.back();
+        toVisit.pop_back();
+        for (const Dependency& dependency : dependencies) {
+            if (dependency.isData && dependency.to == pass && !outIsNeeded[dependency.from]) {
+                outIsNeeded[dependency.from] = true;
+                toVisit.push_back(dependency.from);
+            }
+        }
+    }
+}
+
+void RenderGraph::SortPasses(const vector<Dependency>& dependencies, const vector<bool>& isNeeded) {
+    // Kahn's algorithm. Among ready passes, the first declared runs first, so the order is stable.
+    vector<Uint32> incomingCount(passes.size(), 0);
+    for (const Dependency& dependency : dependencies) {
+        if (isNeeded[dependency.from] && isNeeded[dependency.to]) { ++incomingCount[dependency.to]; }
+    }
+    vector<Uint32> ready;
+    Uint32 neededCount = 0;
+    for (Uint32 pass = 0; pass < passes.size(); ++pass) {
+        if (!isNeeded[pass]) { continue; }
+        ++neededCount;
+        if (incomingCount[pass] == 0) { ready.push_back(pass); }
+    }
+
+    executionOrder.clear();
+    while (!ready.empty()) {
+        const auto first = std::min_element(ready.begin(), ready.end());
+        const Uint32 pass = *first;
+        ready.erase(first);
+        executionOrder.push_back(pass);
+        for (const Dependency& dependency : dependencies) {
+            if (dependency.from == pass && isNeeded[dependency.to] && --incomingCount[dependency.to] == 0) {
+                ready.push_back(dependency.to);
+            }
+        }
+    }
+
+    if (executionOrder.size() != neededCount) {
+        SDL_Log("Render graph has a dependency cycle, passes run in declaration order");
+        executionOrder.clear();
+        for (Uint32 pass = 0; pass < passes.size(); ++pass) {
+            if (isNeeded[pass]) { executionOrder.push_back(pass); }
+        }
+    }
+
+    stats.passCount = static_cast<Uint32>(passes.size());
+    stats.culledPassCount = static_cast<Uint32>(passes.size()) - neededCount;
+}
+
+void RenderGraph::AssignPhysicalTextures(Renderer& renderer) {
+    // Lifetimes, in execution positions
+    for (Uint32 position = 0; position < executionOrder.size(); ++position) {
+        const RenderGraphPassDescription& pass = passes[executionOrder[position]];
+        auto use = [&](RenderGraphTexture handle) {
+            TextureResource& texture = textures[handle.index];
+            texture.firstUse = SDL_min(texture.firstUse, position);
+            texture.lastUse = SDL_max(texture.lastUse, position);
+        };
+        for (RenderGraphTexture texture : pass.textureReads) { use(texture); }
+        for (RenderGraphTexture texture : pass.textureWrites) { use(texture); }
+    }
+
+    vector<Uint32> transients;
+    for (Uint32 i = 0; i < textures.size(); ++i) {
+        if (!textures[i].isImported && textures[i].firstUse != NONE) { transients.push_back(i); }
+    }
+    std::sort(transients.begin(), transients.end(), [this](Uint32 a, Uint32 b) {
+        return textures[a].firstUse < textures[b].firstUse;
+    });
+
+    for (PooledTexture& pooled : texturePool) { pooled.busyUntil = NONE; }
+    stats.transientTextureCount = static_cast<Uint32>(transients.size());
+    stats.transientBytes = 0;
+
+    // A pooled texture is reused as soon as its previous occupant is dead
+    for (Uint32 index : transients) {
+        TextureResource& texture = textures[index];
+        const RenderGraphTextureDescription& description = texture.description;
+        stats.transientBytes += SDL_CalculateGPUTextureFormatSize(description.format, description.width,
+                                                                  description.height, 1);
+
+        PooledTexture* match = nullptr;
+        for (PooledTexture& pooled : texturePool) {
+            if (pooled.description == description
+                && (pooled.busyUntil == NONE || pooled.busyUntil < texture.firstUse)) {
+                match = &pooled;
+                break;
+            }
+        }
+        if (match == nullptr) {
+            SDL_GPUTexture* gpuTexture = renderer.CreateTexture(SDL_GPUTextureCreateInfo {
+                .type = SDL_GPU_TEXTURETYPE_2D,
+                .format = description.format,
+                .usage = description.usage,
+                .width = description.width,
+                .height = description.height,
+                .layer_count_or_depth = 1,
+                .num_levels = 1,
+            });
+            if (gpuTexture == nullptr) {
+                SDL_Log("Render graph could not create %s: %s", texture.name.c_str(), SDL_GetError());
+                continue;
+            }
+            renderer.SetTextureName(gpuTexture, "Render Graph " + texture.name);
+            texturePool.push_back(PooledTexture { description, gpuTexture });
+            match = &texturePool.back();
+        }
+        match->busyUntil = texture.lastUse;
+        match->lastUsedFrame = frame;
+        texture.texture = match->texture;
+    }
+
+    // Drop what the last frames did not need. Releases are deferred until the GPU is done with them.
+    stats.physicalTextureCount = 0;
+    stats.physicalBytes = 0;
+    for (size_t i = 0; i < texturePool.size();) {
+        PooledTexture& pooled = texturePool[i];
+        if (frame - pooled.lastUsedFrame > UNUSED_TEXTURE_FRAME_COUNT) {
+            renderer.ReleaseTexture(pooled.texture);
+            texturePool[i] = texturePool.back();
+            texturePool.pop_back();
+            continue;
+        }
+        if (pooled.busyUntil != NONE) {
+            ++stats.physicalTextureCount;
+            stats.physicalBytes += SDL_CalculateGPUTextureFormatSize(pooled.description.format,
+                                                                     pooled.description.width,
+                                                                     pooled.description.height, 1);
+        }
+        ++i;
+    }
+}
+
+void RenderGraph::ExecutePass(Renderer& renderer, const RenderGraphPassDescription& pass, vector<bool>& isWritten) {
+    switch (pass.type) {
+        case RenderGraphPassType::Render: {
+            if (pass.textureWrites.size() != 1) {
+                SDL_Log("Render graph pass %s needs exactly one color target", pass.name.c_str());
+                return;
+            }
+            const Uint32 target = pass.textureWrites[0].index;
+            // Transient content is undefined before its first write, imported content is kept
+            SDL_GPULoadOp loadOp = SDL_GPU_LOADOP_LOAD;
+            if (pass.isClearing) { loadOp = SDL_GPU_LOADOP_CLEAR; }
+            else if (!isWritten[target] && !textures[target].isImported) { loadOp = SDL_GPU_LOADOP_DONT_CARE; }
+
+            SDL_GPUColorTargetInfo colorTargetInfo {
+                .texture = textures[target].texture,
+                .clear_color = pass.clearColor,
+                .load_op = loadOp,
+                .store_op = SDL_GPU_STOREOP_STORE
+            };
+            renderer.BeginRenderPass(colorTargetInfo);
+            if (pass.execute) { pass.execute(renderer, *this); }
+            renderer.EndRenderPass();
+            break;
+        }
+        case RenderGraphPassType::Compute: {
+            vector<SDL_GPUStorageTextureReadWriteBinding> textureBindings;
+            for (RenderGraphTexture texture : pass.textureWrites) {
+                textureBindings.push_back(SDL_GPUStorageTextureReadWriteBinding {
+                    .texture = textures[texture.index].texture
+                });
+            }
+            vector<SDL_GPUStorageBufferReadWriteBinding> bufferBindings;
+            for (RenderGraphBuffer buffer : pass.bufferWrites) {
+                bufferBindings.push_back(SDL_GPUStorageBufferReadWriteBinding {
+                    .buffer = buffers[buffer.index].buffer
+                });
+            }
+            renderer.BeginComputeInFrame(textureBindings.data(), static_cast<Uint32>(textureBindings.size()),
+                                         bufferBindings.data(), static_cast<Uint32>(bufferBindings.size()));
+            if (pass.execute) { pass.execute(renderer, *this); }
+            renderer.EndCompute();
+            break;
+        }
+        case RenderGraphPassType::Transfer:
+            if (pass.execute) { pass.execute(renderer, *this); }
+            break;
+    }
+
+    for (RenderGraphTexture texture : pass.textureWrites) {
+        isWritten[texture.index] = true;
+    }
+}
+
+void RenderGraph::Release(Renderer& renderer) {
+    for (PooledTexture& pooled : texturePool) {
+        renderer.ReleaseTexture(pooled.texture);
+    }
+    texturePool.clear();
+}
@@ -0,0 +1,159 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef RENDERGRAPH_HPP
+#define RENDERGRAPH_HPP
+
+#include <SDL3/SDL_gpu.h>
+#include <functional>
+#include <string>
+#include <vector>
+
+using std::function;
+using std::string;
+using std::vector;
+
+class Renderer;
+class RenderGraph;
+
+struct RenderGraphTexture {
+    static constexpr Uint32 INVALID = 0xFFFFFFFF;
+    Uint32 index { INVALID };
+
+    bool IsValid() const { return index != INVALID; }
+};
+
+struct RenderGraphBuffer {
+    static constexpr Uint32 INVALID = 0xFFFFFFFF;
+    Uint32 index { INVALID };
+
+    bool IsValid() const { return index != INVALID; }
+};
+
+struct RenderGraphTextureDescription {
+    Uint32 width { 0 };
+    Uint32 height { 0 };
+    SDL_GPUTextureFormat format { SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM };
+    SDL_GPUTextureUsageFlags usage { 0 };
+
+    bool operator==(const RenderGraphTextureDescription& other) const = default;
+};
+
+enum class RenderGraphPassType {
+    Render,   // The written texture is the color target of a render pass
+    Compute,  // Written textures and buffers are the read-write storage bindings of a compute pass
+    Transfer  // No pass is opened, e.g. for blits and copies
+};
+
+using RenderGraphExecute = function<void(Renderer& renderer, const RenderGraph& graph)>;
+
+struct RenderGraphPassDescription {
+    string name;
+    RenderGraphPassType type { RenderGraphPassType::Render };
+    vector<RenderGraphTexture> textureReads;
+    vector<RenderGraphTexture> textureWrites;
+    vector<RenderGraphBuffer> bufferReads;
+    vector<RenderGraphBuffer> bufferWrites;
+    bool isClearing { false };
+    SDL_FColor clearColor { 0.0f, 0.0f, 0.0f, 1.0f };
+    bool hasSideEffects { false }; // Never culled
+    RenderGraphExecute execute;
+};
+
+struct RenderGraphStats {
+    Uint32 passCount { 0 };
+    Uint32 culledPassCount { 0 };
+    Uint32 transientTextureCount { 0 };
+    Uint32 physicalTextureCount { 0 };
+    Uint64 transientBytes { 0 };  // If every transient texture had its own memory
+    Uint64 physicalBytes { 0 };   // Actually used after aliasing
+};
+
+/*
+ * Frame render graph.
+ * Passes declare the textures and buffers they read and write. When executed, the graph:
+ * - culls passes whose results never reach an imported resource,
+ * - orders passes so that every read comes after the write it depends on,
+ * - records all passes in the frame command buffer, opening render and compute passes with the declared targets,
+ * - gives transient textures with non overlapping lifetimes the same physical texture.
+ * SDL GPU inserts the barriers itself from the pass bindings, so correct ordering and bindings are enough.
+ *
+ * The graph is built again every frame. Physical textures are pooled and kept across frames.
+ */
+class RenderGraph {
+public:
+    // External resources, e.g. the swapchain texture. Writing them is a visible result, so their writers are kept.
+    RenderGraphTexture ImportTexture(const string& name, SDL_GPUTexture* texture,
+                                     const RenderGraphTextureDescription& description);
+    RenderGraphBuffer ImportBuffer(const string& name, SDL_GPUBuffer* buffer);
+
+    // Texture owned by the graph, only valid during Execute
+    RenderGraphTexture CreateTexture(const string& name, const RenderGraphTextureDescription& description);
+
+    void AddPass(RenderGraphPassDescription&& pass);
+
+    // Compile and record every pass in the frame command buffer, then clear the passes and resources.
+    // The command buffer must be acquired and is submitted by the caller.
+    void Execute(Renderer& renderer);
+
+    SDL_GPUTexture* GetTexture(RenderGraphTexture texture) const;
+    SDL_GPUBuffer* GetBuffer(RenderGraphBuffer buffer) const;
+    const RenderGraphTextureDescription& GetDescription(RenderGraphTexture texture) const;
+
+    // Stats of the last execution
+    const RenderGraphStats& GetStats() const { return stats; }
+
+    void Release(Renderer& renderer);
+
+    // Pooled textures unused for this many frames are released
+    static constexpr Uint32 UNUSED_TEXTURE_FRAME_COUNT = 4;
+
+private:
+    static constexpr Uint32 NONE = 0xFFFFFFFF;
+
+    struct TextureResource {
+        string name;
+        RenderGraphTextureDescription description;
+        SDL_GPUTexture* texture { nullptr };
+        bool isImported { false };
+        Uint32 firstUse { NONE }; // Positions in the execution order
+        Uint32 lastUse { 0 };
+    };
+
+    struct BufferResource {
+        string name;
+        SDL_GPUBuffer* buffer { nullptr };
+    };
+
+    struct Dependency {
+        Uint32 from;
+        Uint32 to;
+        bool isData; // Read after write or write after write. Write after read only constrains the order.
+    };
+
+    struct PooledTexture {
+        RenderGraphTextureDescription description;
+        SDL_GPUTexture* texture { nullptr };
+        Uint64 lastUsedFrame { 0 };
+        Uint32 busyUntil { NONE }; // Last execution position of the current occupant in this frame
+    };
+
+    void BuildDependencies(vector<Dependency>& outDependencies) const;
+    void CullPasses(const vector<Dependency>& dependencies, vector<bool>& outIsNeeded) const;
+    void SortPasses(const vector<Dependency>& dependencies, const vector<bool>& isNeeded);
+    void AssignPhysicalTextures(Renderer& renderer);
+    void ExecutePass(Renderer& renderer, const RenderGraphPassDescription& pass, vector<bool>& isWritten);
+
+    vector<TextureResource> textures;
+    vector<BufferResource> buffers;
+    vector<RenderGraphPassDescription> passes;
+    vector<Uint32> executionOrder;
+
+    vector<PooledTexture> texturePool;
+    Uint64 frame { 0 };
+    RenderGraphStats stats;
+};
+
+
+#endif //RENDERGRAPH_HPP
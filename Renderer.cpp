@@ -7,7 +7,13 @@
 #include <SDL3/SDL_assert.h>
 
 #include "Window.hpp"
+#include "TextureCompression.hpp"
+#include "AssetPackage.hpp"
+#include "TaskScheduler.hpp"
+#include <SDL3/SDL_filesystem.h>
 #include <SDL3/SDL_log.h>
+#include <SDL3/SDL_timer.h>
+#include <cstring>
 
 
 void Renderer::Init(Window& window) {
@@ -17,16 +23,34 @@ void Renderer::Init(Window& window) {
             true,
             nullptr);
     SDL_ClaimWindowForGPUDevice(device, renderWindow);
+
+    vertexAllocator.Init(device, SDL_GPU_BUFFERUSAGE_VERTEX, "Shared Vertex Buffer");
+    indexAllocator.Init(device, SDL_GPU_BUFFERUSAGE_INDEX, "Shared Index Buffer");
+    storageAllocator.Init(device,
+            SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ | SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_READ
+            | SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_WRITE,
+            "Shared Storage Buffer");
+
+    // Cooked by the cook-assets target, which compiles the shaders first
+    char packagePath[256];
+    SDL_snprintf(packagePath, sizeof(packagePath), "%sContent/Assets.pak", SDL_GetBasePath());
+    if (SDL_GetPathInfo(packagePath, nullptr)) {
+        assetPackage.Open(packagePath);
+    }
+
+    SDL_AddEventWatch(OnWindowEvent, this);
 }
 
 void Renderer::Begin(SDL_GPUDepthStencilTargetInfo* depthStencilTargetInfo) {
     cmdBuffer = SDL_AcquireGPUCommandBuffer(device);
     if (cmdBuffer == nullptr) { SDL_Log("AcquireGPUCommandBuffer failed: %s", SDL_GetError()); }
 
-    if (!SDL_WaitAndAcquireGPUSwapchainTexture(cmdBuffer, renderWindow, &swapchainTexture, nullptr, nullptr)) {
+    if (!SDL_WaitAndAcquireGPUSwapchainTexture(cmdBuffer, renderWindow, &swapchainTexture,
+                                               &swapchainWidth, &swapchainHeight)) {
         SDL_Log("AcquireGPUSwapchainTexture failed: %s", SDL_GetError());
     }
 
+    frameStats.targetPixels = swapchainWidth * swapchainHeight;
     if (swapchainTexture != nullptr) {
         SDL_GPUColorTargetInfo colorTargetInfo = {};
         colorTargetInfo.texture = swapchainTexture;
@@ -38,18 +62,154 @@ void Renderer::Begin(SDL_GPUDepthStencilTargetInfo* depthStencilTargetInfo) {
     }
 }
 
-void Renderer::End() const {
+void Renderer::BeginWithDepth(float clearDepth) {
+    BeginWithDepthTarget(depthTarget, "Renderer Depth Target", GetDepthFormat(), clearDepth, 0);
+}
+
+void Renderer::BeginWithDepthStencil(float clearDepth, Uint8 clearStencil) {
+    BeginWithDepthTarget(depthStencilTarget, "Renderer Depth Stencil Target", GetDepthStencilFormat(), clearDepth,
+                         clearStencil);
+}
+
+void Renderer::BeginWithDepthTarget(TextureHandle& target, const char* name, SDL_GPUTextureFormat format,
+                                    float clearDepth, Uint8 clearStencil) {
+    if (!target.IsValid()) {
+        target = CreateSizedTarget(SizedTargetDescription {
+            .name = name,
+            .format = format,
+            .usage = SDL_GPU_TEXTUREUSAGE_DEPTH_STENCIL_TARGET,
+        });
+    }
+
+    SDL_GPUDepthStencilTargetInfo depthTargetInfo {};
+    depthTargetInfo.texture = GetTexture(target);
+    depthTargetInfo.clear_depth = clearDepth;
+    depthTargetInfo.load_op = SDL_GPU_LOADOP_CLEAR;
+    depthTargetInfo.store_op = SDL_GPU_STOREOP_DONT_CARE;
+    depthTargetInfo.stencil_load_op = SDL_GPU_LOADOP_CLEAR;
+    depthTargetInfo.stencil_store_op = SDL_GPU_STOREOP_DONT_CARE;
+    depthTargetInfo.cycle = true;
+    depthTargetInfo.clear_stencil = clearStencil;
+    Begin(&depthTargetInfo);
+}
+
+SDL_GPUTextureFormat Renderer::GetDepthFormat() {
+    if (depthFormat == SDL_GPU_TEXTUREFORMAT_INVALID) {
+        // D16 is supported everywhere as a depth target
+        depthFormat = SDL_GPU_TEXTUREFORMAT_D16_UNORM;
+        for (SDL_GPUTextureFormat format : { SDL_GPU_TEXTUREFORMAT_D32_FLOAT, SDL_GPU_TEXTUREFORMAT_D24_UNORM }) {
+            if (DoesTextureSupportFormat(format, SDL_GPU_TEXTURETYPE_2D, SDL_GPU_TEXTUREUSAGE_DEPTH_STENCIL_TARGET)) {
+                depthFormat = format;
+                break;
+            }
+        }
+    }
+    return depthFormat;
+}
+
+SDL_GPUTextureFormat Renderer::GetDepthStencilFormat() {
+    if (depthStencilFormat == SDL_GPU_TEXTUREFORMAT_INVALID) {
+        // One of the two is supported everywhere
+        depthStencilFormat = SDL_GPU_TEXTUREFORMAT_D32_FLOAT_S8_UINT;
+        if (DoesTextureSupportFormat(SDL_GPU_TEXTUREFORMAT_D24_UNORM_S8_UINT, SDL_GPU_TEXTURETYPE_2D,
+                                     SDL_GPU_TEXTUREUSAGE_DEPTH_STENCIL_TARGET)) {
+            depthStencilFormat = SDL_GPU_TEXTUREFORMAT_D24_UNORM_S8_UINT;
+        }
+    }
+    return depthStencilFormat;
+}
+
+void Renderer::End() {
     SDL_EndGPURenderPass(renderPass);
-    SDL_SubmitGPUCommandBuffer(cmdBuffer);
+    SubmitFrame();
 }
 
-void Renderer::Close() const {
+void Renderer::BeginRenderPass(const SDL_GPUColorTargetInfo& colorTargetInfo,
+                               SDL_GPUDepthStencilTargetInfo* depthStencilTargetInfo) {
+    renderPass = SDL_BeginGPURenderPass(cmdBuffer, &colorTargetInfo, 1, depthStencilTargetInfo);
+}
+
+void Renderer::EndRenderPass() {
+    SDL_EndGPURenderPass(renderPass);
+    renderPass = nullptr;
+}
+
+void Renderer::Close() {
+    SDL_RemoveEventWatch(OnWindowEvent, this);
+    SDL_WaitForGPUIdle(device);
+    for (const InFlightFrame& inFlightFrame : inFlightFrames) {
+        SDL_ReleaseGPUFence(device, inFlightFrame.fence);
+    }
+    inFlightFrames.clear();
+
+    Release(depthTarget);
+    Release(depthStencilTarget);
+    texturePool.ForEachLive([this](const string& name, SDL_GPUTexture* texture) {
+        SDL_Log("Leaked texture: %s", name.c_str());
+        SDL_ReleaseGPUTexture(device, texture);
+    });
+    bufferPool.ForEachLive([this](const string& name, SDL_GPUBuffer* buffer) {
+        SDL_Log("Leaked buffer: %s", name.c_str());
+        SDL_ReleaseGPUBuffer(device, buffer);
+    });
+    sizedTargets.clear();
+    releaseQueue.Flush(device);
+    vertexAllocator.Close();
+    indexAllocator.Close();
+    storageAllocator.Close();
+
+    assetPackage.Close();
+
     SDL_ReleaseWindowFromGPUDevice(device, renderWindow);
     SDL_DestroyGPUDevice(device);
 }
 
-void Renderer::SubmitCommandBuffer() const {
-    SDL_SubmitGPUCommandBuffer(cmdBuffer);
+void Renderer::SubmitCommandBuffer() {
+    SubmitFrame();
+}
+
+void Renderer::SubmitFrame() {
+    if (overlay && swapchainTexture != nullptr) {
+        const RendererStats sceneStats = frameStats;
+        overlay(*this);
+        frameStats = sceneStats;
+    }
+
+    SDL_GPUFence* fence = SDL_SubmitGPUCommandBufferAndAcquireFence(cmdBuffer);
+    if (fence == nullptr) {
+        SDL_Log("SubmitGPUCommandBufferAndAcquireFence failed: %s", SDL_GetError());
+    } else {
+        inFlightFrames.push_back(InFlightFrame { submittedFrameCount, fence });
+    }
+    ++submittedFrameCount;
+
+    const Uint64 ticks = SDL_GetTicksNS();
+    if (lastSubmitTicks != 0) {
+        lastFrameTime = static_cast<float>(ticks - lastSubmitTicks) / static_cast<float>(SDL_NS_PER_SECOND);
+    }
+    lastSubmitTicks = ticks;
+    lastFrameStats = frameStats;
+    frameStats = RendererStats {};
+
+    // Bound the number of frames the CPU can get ahead, so the release queue cannot grow without limit
+    if (inFlightFrames.size() > MAX_FRAMES_IN_FLIGHT) {
+        SDL_WaitForGPUFences(device, true, &inFlightFrames.front().fence, 1);
+    }
+    RetireCompletedFrames();
+    UpdateSizedTargets();
+}
+
+void Renderer::RetireCompletedFrames() {
+    // Command buffers complete in submission order, so the oldest fence is checked first
+    while (!inFlightFrames.empty() && SDL_QueryGPUFence(device, inFlightFrames.front().fence)) {
+        completedFrameCount = inFlightFrames.front().frame + 1;
+        SDL_ReleaseGPUFence(device, inFlightFrames.front().fence);
+        inFlightFrames.pop_front();
+    }
+    releaseQueue.Retire(device, completedFrameCount);
+    vertexAllocator.Retire(completedFrameCount, releaseQueue, submittedFrameCount);
+    indexAllocator.Retire(completedFrameCount, releaseQueue, submittedFrameCount);
+    storageAllocator.Retire(completedFrameCount, releaseQueue, submittedFrameCount);
 }
 
 
@@ -93,10 +253,17 @@ SDL_GPUShader* Renderer::LoadShader(
         return nullptr;
     }
 
+    const AssetEntry* entry = assetPackage.Find(shaderFilename, format);
+    if (entry != nullptr && entry->type == AssetType::Shader) {
+        return LoadShaderFromPackage(assetPackage, shaderFilename, samplerCount, uniformBufferCount,
+                                     storageBufferCount, storageTextureCount);
+    }
+
     size_t codeSize;
     void* code = SDL_LoadFile(fullPath, &codeSize);
     if (code == nullptr) {
         SDL_Log("Failed to load shader from disk! %s", fullPath);
+        ++shaderFailureCount;
         return nullptr;
     }
 
@@ -114,6 +281,7 @@ SDL_GPUShader* Renderer::LoadShader(
     SDL_GPUShader* shader = SDL_CreateGPUShader(device, &shaderInfo);
     if (shader == nullptr) {
         SDL_Log("Failed to create shader!");
+        ++shaderFailureCount;
         SDL_free(code);
         return nullptr;
     }
@@ -122,13 +290,79 @@ SDL_GPUShader* Renderer::LoadShader(
     return shader;
 }
 
+SDL_GPUShader* Renderer::LoadShaderFromPackage(
+        const AssetPackage& package,
+        const char* shaderFilename,
+        Uint32 samplerCount,
+        Uint32 uniformBufferCount,
+        Uint32 storageBufferCount,
+        Uint32 storageTextureCount
+) {
+    SDL_GPUShaderStage stage;
+    if (SDL_strstr(shaderFilename, ".vert")) { stage = SDL_GPU_SHADERSTAGE_VERTEX; }
+    else if (SDL_strstr(shaderFilename, ".frag")) { stage = SDL_GPU_SHADERSTAGE_FRAGMENT; }
+    else {
+        SDL_Log("Invalid shader stage!");
+        return nullptr;
+    }
+
+    SDL_GPUShaderFormat backendFormats = SDL_GetGPUShaderFormats(device);
+    SDL_GPUShaderFormat format = SDL_GPU_SHADERFORMAT_INVALID;
+    const char* entrypoint;
+
+    if (backendFormats & SDL_GPU_SHADERFORMAT_SPIRV) {
+        format = SDL_GPU_SHADERFORMAT_SPIRV;
+        entrypoint = "main";
+    } else if (backendFormats & SDL_GPU_SHADERFORMAT_MSL) {
+        format = SDL_GPU_SHADERFORMAT_MSL;
+        entrypoint = "main0";
+    } else if (backendFormats & SDL_GPU_SHADERFORMAT_DXIL) {
+        format = SDL_GPU_SHADERFORMAT_DXIL;
+        entrypoint = "main";
+    } else {
+        SDL_Log("%s", "Unrecognized backend shader format!");
+        return nullptr;
+    }
+
+    const AssetEntry* entry = package.Find(shaderFilename, format);
+    if (entry == nullptr || entry->type != AssetType::Shader) {
+        SDL_Log("Shader %s is not in the asset package", shaderFilename);
+        ++shaderFailureCount;
+        return nullptr;
+    }
+
+    // The code is read in place from the mapped package
+    SDL_GPUShaderCreateInfo shaderInfo = {
+            .code_size = entry->size,
+            .code = package.GetData(*entry),
+            .entrypoint = entrypoint,
+            .format = format,
+            .stage = stage,
+            .num_samplers = samplerCount,
+            .num_storage_textures = storageTextureCount,
+            .num_storage_buffers = storageBufferCount,
+            .num_uniform_buffers = uniformBufferCount
+    };
+    SDL_GPUShader* shader = SDL_CreateGPUShader(device, &shaderInfo);
+    if (shader == nullptr) {
+        SDL_Log("Failed to create shader!");
+        ++shaderFailureCount;
+        return nullptr;
+    }
+    return shader;
+}
+
 void Renderer::BindGraphicsPipeline(SDL_GPUGraphicsPipeline* pipeline) const {
+    ++frameStats.pipelineBinds;
     SDL_BindGPUGraphicsPipeline(renderPass, pipeline);
 }
 
 void Renderer::SetViewport(const SDL_GPUViewport& viewport) const { SDL_SetGPUViewport(renderPass, &viewport); }
 
-void Renderer::SetScissorRect(const SDL_Rect& rect) const { SDL_SetGPUScissor(renderPass, &rect); }
+void Renderer::SetScissorRect(const SDL_Rect& rect) const {
+    ++frameStats.scissorChanges;
+    SDL_SetGPUScissor(renderPass, &rect);
+}
 
 void Renderer::SetStencilReference(Uint8 stencilReference) const {
     SDL_SetGPUStencilReference(renderPass, stencilReference);
@@ -140,14 +374,26 @@ bool Renderer::DoesTextureSupportFormat(SDL_GPUTextureFormat format, SDL_GPUText
 }
 
 void Renderer::DrawPrimitives(int numVertices, int numInstances, int firstVertex, int firstInstance) const {
+    ++frameStats.drawCalls;
     SDL_DrawGPUPrimitives(renderPass, numVertices, numInstances, firstVertex, firstInstance);
 }
 
 void Renderer::DrawIndexedPrimitives(int numIndices, int numInstances, int firstIndex,
                                      int vertexOffset, int firstInstance) const {
+    ++frameStats.drawCalls;
     SDL_DrawGPUIndexedPrimitives(renderPass, numIndices, numInstances, firstIndex, vertexOffset, firstInstance);
 }
 
+void Renderer::DrawIndexedPrimitivesIndirect(SDL_GPUBuffer* buffer, Uint32 offset, Uint32 drawCount) const {
+    ++frameStats.drawCalls;
+    SDL_DrawGPUIndexedPrimitivesIndirect(renderPass, buffer, offset, drawCount);
+}
+
+void Renderer::DrawPrimitivesIndirect(SDL_GPUBuffer* buffer, Uint32 offset, Uint32 drawCount) const {
+    ++frameStats.drawCalls;
+    SDL_DrawGPUPrimitivesIndirect(renderPass, buffer, offset, drawCount);
+}
+
 SDL_GPUGraphicsPipeline*
 Renderer::CreateGPUGraphicsPipeline(const SDL_GPUGraphicsPipelineCreateInfo& createInfo) const {
     return SDL_CreateGPUGraphicsPipeline(device, &createInfo);
@@ -182,6 +428,241 @@ SDL_Surface* Renderer::LoadBMPImage(const char* basePath, const char* imageFilen
     return result;
 }
 
+SDL_GPUTexture* Renderer::LoadCompressedTexture(const char* basePath, const char* imageFilename, bool* outIsNative) {
+    char fullPath[256];
+    SDL_snprintf(fullPath, sizeof(fullPath), "%sContent/Images/%s", basePath, imageFilename);
+
+    CompressedImage image;
+    const bool isLoaded = SDL_strstr(imageFilename, ".dds") ? TextureCompression::LoadDDS(fullPath, image)
+                                                             : TextureCompression::LoadASTC(fullPath, image);
+    if (!isLoaded) {
+        SDL_Log("Failed to load compressed image: %s", fullPath);
+        return nullptr;
+    }
+
+    // Keep the blocks compressed if the GPU can sample them, else transcode to RGBA8
+    const bool isNative = DoesTextureSupportFormat(image.format, SDL_GPU_TEXTURETYPE_2D,
+                                                   SDL_GPU_TEXTUREUSAGE_SAMPLER);
+    SDL_GPUTextureFormat format = image.format;
+    vector<Uint8> decodedPixels;
+    const Uint8* pixels = image.data.data();
+    Uint32 dataSize = static_cast<Uint32>(image.data.size());
+    if (!isNative) {
+        if (!TextureCompression::DecodeToRGBA8(image, decodedPixels)) {
+            SDL_Log("Texture format of %s is not supported by the GPU and cannot be decoded", imageFilename);
+            return nullptr;
+        }
+        format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM;
+        pixels = decodedPixels.data();
+        dataSize = static_cast<Uint32>(decodedPixels.size());
+    }
+    if (outIsNative != nullptr) { *outIsNative = isNative; }
+
+    SDL_GPUTextureCreateInfo textureInfo {
+        .type = SDL_GPU_TEXTURETYPE_2D,
+        .format = format,
+        .usage = SDL_GPU_TEXTUREUSAGE_SAMPLER,
+        .width = image.width,
+        .height = image.height,
+        .layer_count_or_depth = 1,
+        .num_levels = 1,
+    };
+    SDL_GPUTexture* texture = CreateTexture(textureInfo);
+    if (texture == nullptr) {
+        SDL_Log("Failed to create texture: %s", SDL_GetError());
+        return nullptr;
+    }
+    SetTextureName(texture, imageFilename);
+
+    SDL_GPUTransferBufferCreateInfo transferBufferCreateInfo {
+        .usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+        .size = dataSize
+    };
+    SDL_GPUTransferBuffer* transferBuffer = CreateTransferBuffer(transferBufferCreateInfo);
+    void* transferData = MapTransferBuffer(transferBuffer, false);
+    std::memcpy(transferData, pixels, dataSize);
+    UnmapTransferBuffer(transferBuffer);
+
+    BeginUploadToBuffer();
+    SDL_GPUTextureTransferInfo textureBufferLocation {
+        .transfer_buffer = transferBuffer,
+        .offset = 0
+    };
+    SDL_GPUTextureRegion textureBufferRegion {
+        .texture = texture,
+        .w = image.width,
+        .h = image.height,
+        .d = 1
+    };
+    UploadToTexture(textureBufferLocation, textureBufferRegion, false);
+    EndUploadToBuffer(transferBuffer);
+
+    return texture;
+}
+
+SDL_GPUTexture* Renderer::LoadCubemap(const char* basePath, const char* const faceFilenames[CUBE_FACE_COUNT]) {
+    // Decoding dominates, one face per task
+    SDL_Surface* faces[CUBE_FACE_COUNT] {};
+    TaskScheduler::ParallelFor(CUBE_FACE_COUNT, 1, [&](Uint32 begin, Uint32 end) {
+        for (Uint32 i = begin; i < end; ++i) {
+            faces[i] = LoadBMPImage(basePath, faceFilenames[i], 4);
+        }
+    });
+
+    bool areFacesValid = true;
+    for (Uint32 i = 0; i < CUBE_FACE_COUNT; ++i) {
+        if (faces[i] == nullptr) {
+            areFacesValid = false;
+        } else if (faces[i]->w != faces[i]->h || faces[i]->w != faces[0]->w) {
+            SDL_Log("Cubemap face %s is %dx%d, faces must be square and of the same size", faceFilenames[i],
+                    faces[i]->w, faces[i]->h);
+            areFacesValid = false;
+        }
+        if (!areFacesValid) { break; }
+    }
+    auto releaseFaces = [&] {
+        for (SDL_Surface* face : faces) {
+            if (face != nullptr) { ReleaseSurface(face); }
+        }
+    };
+    if (!areFacesValid) {
+        releaseFaces();
+        return nullptr;
+    }
+
+    const Uint32 size = static_cast<Uint32>(faces[0]->w);
+    SDL_GPUTextureCreateInfo textureInfo {
+        .type = SDL_GPU_TEXTURETYPE_CUBE,
+        .format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM,
+        .usage = SDL_GPU_TEXTUREUSAGE_SAMPLER,
+        .width = size,
+        .height = size,
+        .layer_count_or_depth = CUBE_FACE_COUNT,
+        .num_levels = 1,
+    };
+    SDL_GPUTexture* texture = CreateTexture(textureInfo);
+    if (texture == nullptr) {
+        SDL_Log("Failed to create cubemap texture: %s", SDL_GetError());
+        releaseFaces();
+        return nullptr;
+    }
+    SetTextureName(texture, faceFilenames[0]);
+
+    // All faces in one transfer buffer, copied in parallel, then uploaded with one copy pass
+    const Uint32 rowSize = size * 4;
+    const Uint32 faceSize = rowSize * size;
+    SDL_GPUTransferBufferCreateInfo transferBufferCreateInfo {
+        .usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+        .size = faceSize * CUBE_FACE_COUNT
+    };
+    SDL_GPUTransferBuffer* transferBuffer = CreateTransferBuffer(transferBufferCreateInfo);
+    auto* transferData = static_cast<Uint8*>(MapTransferBuffer(transferBuffer, false));
+    TaskScheduler::ParallelFor(CUBE_FACE_COUNT, 1, [&](Uint32 begin, Uint32 end) {
+        for (Uint32 i = begin; i < end; ++i) {
+            const auto* pixels = static_cast<const Uint8*>(faces[i]->pixels);
+            for (Uint32 y = 0; y < size; ++y) {
+                std::memcpy(transferData + i * faceSize + y * rowSize, pixels + y * faces[i]->pitch, rowSize);
+            }
+        }
+    });
+    UnmapTransferBuffer(transferBuffer);
+    releaseFaces();
+
+    BeginUploadToBuffer();
+    for (Uint32 i = 0; i < CUBE_FACE_COUNT; ++i) {
+        SDL_GPUTextureTransferInfo textureBufferLocation {
+            .transfer_buffer = transferBuffer,
+            .offset = i * faceSize
+        };
+        SDL_GPUTextureRegion textureBufferRegion {
+            .texture = texture,
+            .layer = i,
+            .w = size,
+            .h = size,
+            .d = 1
+        };
+        UploadToTexture(textureBufferLocation, textureBufferRegion, false);
+    }
+    EndUploadToBuffer(transferBuffer);
+
+    return texture;
+}
+
+SDL_GPUTexture* Renderer::CreateTextureFromPackage(const AssetPackage& package, const char* imageFilename) {
+    const AssetEntry* entry = package.Find(imageFilename);
+    if (entry == nullptr || entry->type != AssetType::Texture) {
+        SDL_Log("Texture %s is not in the asset package", imageFilename);
+        return nullptr;
+    }
+
+    auto format = static_cast<SDL_GPUTextureFormat>(entry->format);
+    const Uint8* data = package.GetData(*entry);
+    Uint32 levelCount = entry->levelCount;
+    vector<Uint8> decodedPixels;
+    if (!DoesTextureSupportFormat(format, SDL_GPU_TEXTURETYPE_2D, SDL_GPU_TEXTUREUSAGE_SAMPLER)) {
+        // Cooked compressed textures hold a single level
+        CompressedImage image;
+        image.width = entry->width;
+        image.height = entry->height;
+        image.data.assign(data, data + entry->levelSizes[0]);
+        if (!TextureCompression::SetBlockFormat(format, image) || !TextureCompression::CanDecode(format)
+            || !TextureCompression::DecodeToRGBA8(image, decodedPixels)) {
+            SDL_Log("Texture format of %s is not supported by the GPU and cannot be decoded", imageFilename);
+            return nullptr;
+        }
+        format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM;
+        data = decodedPixels.data();
+        levelCount = 1;
+    }
+
+    SDL_GPUTextureCreateInfo textureInfo {
+        .type = SDL_GPU_TEXTURETYPE_2D,
+        .format = format,
+        .usage = SDL_GPU_TEXTUREUSAGE_SAMPLER,
+        .width = entry->width,
+        .height = entry->height,
+        .layer_count_or_depth = 1,
+        .num_levels = levelCount,
+    };
+    SDL_GPUTexture* texture = CreateTexture(textureInfo);
+    if (texture == nullptr) {
+        SDL_Log("Failed to create texture: %s", SDL_GetError());
+        return nullptr;
+    }
+    SetTextureName(texture, imageFilename);
+
+    // Levels are contiguous in the package: a single copy fills the transfer buffer
+    const Uint32 dataSize = decodedPixels.empty() ? static_cast<Uint32>(entry->size)
+                                                  : static_cast<Uint32>(decodedPixels.size());
+    SDL_GPUTransferBufferCreateInfo transferBufferCreateInfo {
+        .usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+        .size = dataSize
+    };
+    SDL_GPUTransferBuffer* transferBuffer = CreateTransferBuffer(transferBufferCreateInfo);
+    void* transferData = MapTransferBuffer(transferBuffer, false);
+    std::memcpy(transferData, data, dataSize);
+    UnmapTransferBuffer(transferBuffer);
+
+    BeginUploadToBuffer();
+    for (Uint32 level = 0; level < levelCount; ++level) {
+        SDL_GPUTextureTransferInfo textureBufferLocation {
+            .transfer_buffer = transferBuffer,
+            .offset = decodedPixels.empty() ? entry->levelOffsets[level] : 0
+        };
+        SDL_GPUTextureRegion textureBufferRegion {
+            .texture = texture,
+            .mip_level = level,
+            .w = SDL_max(entry->width >> level, 1u),
+            .h = SDL_max(entry->height >> level, 1u),
+            .d = 1
+        };
+        UploadToTexture(textureBufferLocation, textureBufferRegion, false);
+    }
+    EndUploadToBuffer(transferBuffer);
+
+    return texture;
+}
+
 SDL_GPUSampler* Renderer::CreateSampler(const SDL_GPUSamplerCreateInfo& createInfo) const {
     return SDL_CreateGPUSampler(device, &createInfo);
 }
@@ -189,7 +670,12 @@ SDL_GPUSampler* Renderer::CreateSampler(const SDL_GPUSamplerCreateInfo& createIn
 void Renderer::ReleaseSurface(SDL_Surface* surface) const { SDL_DestroySurface(surface); }
 
 SDL_GPUBuffer* Renderer::CreateBuffer(const SDL_GPUBufferCreateInfo& createInfo) const {
-    return SDL_CreateGPUBuffer(device, &createInfo);
+    SDL_GPUBuffer* buffer = SDL_CreateGPUBuffer(device, &createInfo);
+    if (buffer != nullptr) {
+        gpuAllocations[buffer] = GpuAllocation { GPUResourceType::Buffer, createInfo.size };
+        gpuMemory.bufferBytes += createInfo.size;
+    }
+    return buffer;
 }
 
 void Renderer::SetBufferName(SDL_GPUBuffer* buffer, const string& name) const {
@@ -197,7 +683,12 @@ void Renderer::SetBufferName(SDL_GPUBuffer* buffer, const string& name) const {
 }
 
 SDL_GPUTransferBuffer* Renderer::CreateTransferBuffer(const SDL_GPUTransferBufferCreateInfo& createInfo) const {
-    return SDL_CreateGPUTransferBuffer(device, &createInfo);
+    SDL_GPUTransferBuffer* transferBuffer = SDL_CreateGPUTransferBuffer(device, &createInfo);
+    if (transferBuffer != nullptr) {
+        gpuAllocations[transferBuffer] = GpuAllocation { GPUResourceType::TransferBuffer, createInfo.size };
+        gpuMemory.transferBufferBytes += createInfo.size;
+    }
+    return transferBuffer;
 }
 
 void* Renderer::MapTransferBuffer(SDL_GPUTransferBuffer* transferBuffer, bool cycle) const {
@@ -208,22 +699,38 @@ void Renderer::UnmapTransferBuffer(SDL_GPUTransferBuffer* transferBuffer) const
     SDL_UnmapGPUTransferBuffer(device, transferBuffer);
 }
 
-void Renderer::ReleaseTransferBuffer(SDL_GPUTransferBuffer* transferBuffer) const {
-    SDL_ReleaseGPUTransferBuffer(device, transferBuffer);
+void Renderer::ReleaseTransferBuffer(SDL_GPUTransferBuffer* transferBuffer) {
+    ForgetGpuAllocation(transferBuffer);
+    releaseQueue.Push(GPUResourceType::TransferBuffer, transferBuffer, submittedFrameCount);
 }
 
 SDL_GPUTexture* Renderer::CreateTexture(const SDL_GPUTextureCreateInfo& createInfo) const {
-    return SDL_CreateGPUTexture(device, &createInfo);
+    SDL_GPUTexture* texture = SDL_CreateGPUTexture(device, &createInfo);
+    if (texture != nullptr) {
+        const Uint64 size = ComputeTextureSize(createInfo);
+        gpuAllocations[texture] = GpuAllocation { GPUResourceType::Texture, size, createInfo.format };
+        gpuMemory.textureBytes += size;
+    }
+    return texture;
 }
 
 void Renderer::SetTextureName(SDL_GPUTexture* texture, const string& name) const {
     SDL_SetGPUTextureName(device, texture, name.c_str());
 }
 
-void Renderer::ReleaseTexture(SDL_GPUTexture* texture) const { SDL_ReleaseGPUTexture(device, texture); }
+void Renderer::ReleaseTexture(SDL_GPUTexture* texture) {
+    ForgetGpuAllocation(texture);
+    releaseQueue.Push(GPUResourceType::Texture, texture, submittedFrameCount);
+}
+
+void Renderer::GenerateMipmaps(SDL_GPUTexture* texture) const {
+    SDL_GPUCommandBuffer* mipmapCmdBuffer = SDL_AcquireGPUCommandBuffer(device);
+    SDL_GenerateMipmapsForGPUTexture(mipmapCmdBuffer, texture);
+    SDL_SubmitGPUCommandBuffer(mipmapCmdBuffer);
+}
 
-void Renderer::ReleaseSampler(SDL_GPUSampler* sampler) const {
-    SDL_ReleaseGPUSampler(device, sampler);
+void Renderer::ReleaseSampler(SDL_GPUSampler* sampler) {
+    releaseQueue.Push(GPUResourceType::Sampler, sampler, submittedFrameCount);
 }
 
 void Renderer::BeginUploadToBuffer() {
@@ -234,46 +741,103 @@ void Renderer::BeginUploadToBuffer() {
 void Renderer::UploadToBuffer(const SDL_GPUTransferBufferLocation& source,
                               const SDL_GPUBufferRegion& destination,
                               bool cycle) const {
+    frameStats.uploadBytes += destination.size;
     SDL_UploadToGPUBuffer(copyPass, &source, &destination, cycle);
 }
 
+void Renderer::UploadToBuffer(const SDL_GPUTransferBufferLocation& source,
+                              const BufferAllocation& destination) const {
+    SDL_GPUBufferRegion region {
+        .buffer = destination.buffer,
+        .offset = destination.offset,
+        .size = destination.size
+    };
+    frameStats.uploadBytes += destination.size;
+    SDL_UploadToGPUBuffer(copyPass, &source, &region, false);
+}
+
 void Renderer::UploadToTexture(const SDL_GPUTextureTransferInfo& source, const SDL_GPUTextureRegion& destination,
                                bool cycle) const {
+    const auto allocation = gpuAllocations.find(destination.texture);
+    if (allocation != gpuAllocations.end()) {
+        frameStats.uploadBytes += SDL_CalculateGPUTextureFormatSize(allocation->second.format, destination.w,
+                                                                     destination.h, destination.d);
+    }
     SDL_UploadToGPUTexture(copyPass, &source, &destination, cycle);
 }
 
-void Renderer::EndUploadToBuffer(SDL_GPUTransferBuffer* transferBuffer, bool release) const {
+void Renderer::EndUploadToBuffer(SDL_GPUTransferBuffer* transferBuffer, bool release) {
     SDL_EndGPUCopyPass(copyPass);
     SDL_SubmitGPUCommandBuffer(uploadCmdBuf);
-    if (release) SDL_ReleaseGPUTransferBuffer(device, transferBuffer);
+    // The upload is submitted before the current frame, so it is done when this frame retires
+    if (release) ReleaseTransferBuffer(transferBuffer);
 }
 
 
 void Renderer::BindVertexBuffers(Uint32 firstSlot, const SDL_GPUBufferBinding& bindings, Uint32 numBindings) const {
+    ++frameStats.bufferBinds;
     SDL_BindGPUVertexBuffers(renderPass, firstSlot, &bindings, numBindings);
 }
 
 void Renderer::BindIndexBuffer(const SDL_GPUBufferBinding& bindings, SDL_GPUIndexElementSize indexElementSize) const {
+    ++frameStats.bufferBinds;
     SDL_BindGPUIndexBuffer(renderPass, &bindings, indexElementSize);
 }
 
+void Renderer::BindVertexBuffer(Uint32 slot, const BufferAllocation& allocation) const {
+    ++frameStats.bufferBinds;
+    SDL_GPUBufferBinding binding { .buffer = allocation.buffer, .offset = allocation.offset };
+    SDL_BindGPUVertexBuffers(renderPass, slot, &binding, 1);
+}
+
+void Renderer::BindIndexBuffer(const BufferAllocation& allocation, SDL_GPUIndexElementSize indexElementSize) const {
+    ++frameStats.bufferBinds;
+    SDL_GPUBufferBinding binding { .buffer = allocation.buffer, .offset = allocation.offset };
+    SDL_BindGPUIndexBuffer(renderPass, &binding, indexElementSize);
+}
+
 void Renderer::BindFragmentSamplers(Uint32 firstSlot, const SDL_GPUTextureSamplerBinding& bindings,
                                     Uint32 numBindings) const {
+    ++frameStats.samplerBinds;
     SDL_BindGPUFragmentSamplers(renderPass, firstSlot, &bindings, numBindings);
 }
 
-void Renderer::ReleaseBuffer(SDL_GPUBuffer* buffer) const { SDL_ReleaseGPUBuffer(device, buffer); }
+void Renderer::BindVertexStorageBuffers(Uint32 firstSlot, SDL_GPUBuffer* const* buffers, Uint32 numBuffers) const {
+    ++frameStats.bufferBinds;
+    SDL_BindGPUVertexStorageBuffers(renderPass, firstSlot, buffers, numBuffers);
+}
+
+void Renderer::ReleaseBuffer(SDL_GPUBuffer* buffer) {
+    ForgetGpuAllocation(buffer);
+    releaseQueue.Push(GPUResourceType::Buffer, buffer, submittedFrameCount);
+}
+
+BufferAllocation Renderer::AllocateBuffer(BufferUsageClass usageClass, Uint32 size) {
+    switch (usageClass) {
+        case BufferUsageClass::Vertex: return vertexAllocator.Allocate(size);
+        case BufferUsageClass::Index: return indexAllocator.Allocate(size);
+        case BufferUsageClass::Storage: return storageAllocator.Allocate(size);
+    }
+    return BufferAllocation {};
+}
+
+void Renderer::FreeBuffer(BufferAllocation& allocation) {
+    if (allocation.owner == nullptr) { return; }
+    allocation.owner->Free(allocation, submittedFrameCount);
+}
 
-void Renderer::ReleaseGraphicsPipeline(SDL_GPUGraphicsPipeline* pipeline) const {
-    SDL_ReleaseGPUGraphicsPipeline(device, pipeline);
+void Renderer::ReleaseGraphicsPipeline(SDL_GPUGraphicsPipeline* pipeline) {
+    releaseQueue.Push(GPUResourceType::GraphicsPipeline, pipeline, submittedFrameCount);
 }
 
 void Renderer::PushVertexUniformData(uint32_t slot, const void* data, Uint32 size) const {
-    SDL_PushGPUVertexUniformData(cmdBuffer, 0, data, size);
+    ++frameStats.uniformPushes;
+    SDL_PushGPUVertexUniformData(cmdBuffer, slot, data, size);
 }
 
 void Renderer::PushFragmentUniformData(uint32_t slot, const void* data, Uint32 size) const {
-    SDL_PushGPUFragmentUniformData(cmdBuffer, 0, data, size);
+    ++frameStats.uniformPushes;
+    SDL_PushGPUFragmentUniformData(cmdBuffer, slot, data, size);
 }
 
 SDL_GPUComputePipeline* Renderer::CreateComputePipelineFromShader(const char* basePath, const char* shaderFilename,
@@ -300,16 +864,23 @@ SDL_GPUComputePipeline* Renderer::CreateComputePipelineFromShader(const char* ba
         return nullptr;
     }
 
-    size_t codeSize;
-    auto* code = static_cast<Uint8*>(SDL_LoadFile(fullPath, &codeSize));
-    if (code == nullptr) {
-        SDL_Log("Failed to load compute shader from disk! %s", fullPath);
-        return nullptr;
+    // Like LoadShader, the code is read in place from the asset package when it has the shader
+    const AssetEntry* entry = assetPackage.Find(shaderFilename, format);
+    const bool isPackaged = entry != nullptr && entry->type == AssetType::Shader;
+    size_t codeSize = isPackaged ? static_cast<size_t>(entry->size) : 0;
+    Uint8* code = nullptr;
+    if (!isPackaged) {
+        code = static_cast<Uint8*>(SDL_LoadFile(fullPath, &codeSize));
+        if (code == nullptr) {
+            SDL_Log("Failed to load compute shader from disk! %s", fullPath);
+            ++shaderFailureCount;
+            return nullptr;
+        }
     }
 
     // Make a copy of the create data, then overwrite the parts we need
     SDL_GPUComputePipelineCreateInfo newCreateInfo = *createInfo;
-    newCreateInfo.code = code;
+    newCreateInfo.code = isPackaged ? assetPackage.GetData(*entry) : code;
     newCreateInfo.code_size = codeSize;
     newCreateInfo.entrypoint = entrypoint;
     newCreateInfo.format = format;
@@ -317,11 +888,17 @@ SDL_GPUComputePipeline* Renderer::CreateComputePipelineFromShader(const char* ba
     SDL_GPUComputePipeline* pipeline = SDL_CreateGPUComputePipeline(device, &newCreateInfo);
     if (pipeline == nullptr) {
         SDL_Log("Failed to create compute pipeline!");
+        ++shaderFailureCount;
         SDL_free(code);
         return nullptr;
     }
 
     SDL_free(code);
+    computeThreadCounts[pipeline] = ComputeThreadCount {
+        SDL_max(createInfo->threadcount_x, 1u),
+        SDL_max(createInfo->threadcount_y, 1u),
+        SDL_max(createInfo->threadcount_z, 1u)
+    };
     return pipeline;
 }
 
@@ -336,37 +913,81 @@ void Renderer::BeginCompute(SDL_GPUStorageTextureReadWriteBinding* storageTextur
 
 }
 
-void Renderer::BindComputePipeline(SDL_GPUComputePipeline* computePipeline) const {
+void Renderer::BeginComputeInFrame(SDL_GPUStorageTextureReadWriteBinding* storageTextureBindings,
+                                   Uint32 numStorageTextureBindings,
+                                   SDL_GPUStorageBufferReadWriteBinding* storageBufferBindings,
+                                   Uint32 numStorageBufferBindings) {
+    computeCmdBuffer = cmdBuffer;
+    computePass = SDL_BeginGPUComputePass(computeCmdBuffer,
+                                          storageTextureBindings, numStorageTextureBindings,
+                                          storageBufferBindings, numStorageBufferBindings);
+}
+
+void Renderer::BindComputePipeline(SDL_GPUComputePipeline* computePipeline) {
+    ++frameStats.pipelineBinds;
     SDL_BindGPUComputePipeline(computePass, computePipeline);
+    const auto threadCount = computeThreadCounts.find(computePipeline);
+    boundComputeThreadCount = threadCount != computeThreadCounts.end()
+                              ? threadCount->second : ComputeThreadCount { 1, 1, 1 };
+}
+
+void Renderer::BindComputeStorageTextures(Uint32 firstSlot, SDL_GPUTexture* const* textures,
+                                          Uint32 numTextures) const {
+    ++frameStats.bufferBinds;
+    SDL_BindGPUComputeStorageTextures(computePass, firstSlot, textures, numTextures);
 }
 
 void Renderer::BindComputeStorageBuffers(Uint32 firstSlot, SDL_GPUBuffer* buffers, Uint32 numBuffers) const {
+    ++frameStats.bufferBinds;
     SDL_BindGPUComputeStorageBuffers(computePass, firstSlot, &buffers, numBuffers);
 }
 
 
 void Renderer::DispatchCompute(Uint32 groupCountX, Uint32 groupCountY, Uint32 groupCountZ) {
+    ++frameStats.dispatches;
     SDL_DispatchGPUCompute(computePass, groupCountX, groupCountY, groupCountZ);
 }
 
+void Renderer::DispatchComputeForSize(Uint32 sizeX, Uint32 sizeY, Uint32 sizeZ) {
+    ++frameStats.dispatches;
+    SDL_DispatchGPUCompute(computePass,
+                           GetGroupCount(sizeX, boundComputeThreadCount.x),
+                           GetGroupCount(sizeY, boundComputeThreadCount.y),
+                           GetGroupCount(sizeZ, boundComputeThreadCount.z));
+}
+
+void Renderer::DispatchComputeForSize(Uint32 sizeX, Uint32 sizeY, Uint32 sizeZ, Uint32 boundsSlot) {
+    const Uint32 bounds[4] = { sizeX, sizeY, sizeZ, 0 };
+    ++frameStats.uniformPushes;
+    SDL_PushGPUComputeUniformData(computeCmdBuffer, boundsSlot, bounds, sizeof(bounds));
+    DispatchComputeForSize(sizeX, sizeY, sizeZ);
+}
+
 void Renderer::PushComputeUniformData(uint32_t slot, const void* data, Uint32 size) const {
+    ++frameStats.uniformPushes;
     SDL_PushGPUComputeUniformData(computeCmdBuffer, slot, data, size);
 }
 
-void Renderer::ReleaseComputePipeline(SDL_GPUComputePipeline* computePipeline) const {
-    SDL_ReleaseGPUComputePipeline(device, computePipeline);
+void Renderer::ReleaseComputePipeline(SDL_GPUComputePipeline* computePipeline) {
+    computeThreadCounts.erase(computePipeline);
+    releaseQueue.Push(GPUResourceType::ComputePipeline, computePipeline, submittedFrameCount);
 }
 
 void Renderer::EndCompute() {
     SDL_EndGPUComputePass(computePass);
-    SDL_SubmitGPUCommandBuffer(computeCmdBuffer);
+    // A pass recorded in the frame command buffer is submitted with the frame
+    if (computeCmdBuffer != cmdBuffer) {
+        SDL_SubmitGPUCommandBuffer(computeCmdBuffer);
+    }
+    computeCmdBuffer = nullptr;
 }
 
-void Renderer::AcquireCmdBufferAndSwapchainTexture(Uint32 width, Uint32 height) {
+void Renderer::AcquireCmdBufferAndSwapchainTexture() {
     cmdBuffer = SDL_AcquireGPUCommandBuffer(device);
     if (cmdBuffer == nullptr) { SDL_Log("AcquireGPUCommandBuffer failed: %s", SDL_GetError()); }
 
-    if (!SDL_WaitAndAcquireGPUSwapchainTexture(cmdBuffer, renderWindow, &swapchainTexture, &width, &height)) {
+    if (!SDL_WaitAndAcquireGPUSwapchainTexture(cmdBuffer, renderWindow, &swapchainTexture,
+                                               &swapchainWidth, &swapchainHeight)) {
         SDL_Log("AcquireGPUSwapchainTexture failed: %s", SDL_GetError());
     }
 }
@@ -384,9 +1005,188 @@ bool Renderer::IsSwapchainTextureValid() const {
     return swapchainTexture != nullptr;
 }
 
+bool Renderer::SetSwapchainComposition(SDL_GPUSwapchainComposition composition) {
+    if (!SDL_WindowSupportsGPUSwapchainComposition(device, renderWindow, composition)
+        || !SDL_SetGPUSwapchainParameters(device, renderWindow, composition, presentMode)) {
+        return false;
+    }
+    swapchainComposition = composition;
+    return true;
+}
 
+bool Renderer::SetPresentMode(SDL_GPUPresentMode mode) {
+    if (!SDL_WindowSupportsGPUPresentMode(device, renderWindow, mode)
+        || !SDL_SetGPUSwapchainParameters(device, renderWindow, swapchainComposition, mode)) {
+        return false;
+    }
+    presentMode = mode;
+    return true;
+}
 
+const char* Renderer::GetPresentModeName(SDL_GPUPresentMode mode) {
+    switch (mode) {
+        case SDL_GPU_PRESENTMODE_VSYNC: return "VSync";
+        case SDL_GPU_PRESENTMODE_IMMEDIATE: return "Immediate";
+        case SDL_GPU_PRESENTMODE_MAILBOX: return "Mailbox";
+    }
+    return "Unknown";
+}
 
+TextureHandle Renderer::CreateSizedTarget(const SizedTargetDescription& description) {
+    if (sizedTargetWidth == 0) {
+        int w, h;
+        SDL_GetWindowSizeInPixels(renderWindow, &w, &h);
+        sizedTargetWidth = static_cast<Uint32>(SDL_max(w, 1));
+        sizedTargetHeight = static_cast<Uint32>(SDL_max(h, 1));
+    }
+    SDL_GPUTexture* texture = CreateSizedTexture(description);
+    if (texture == nullptr) { return TextureHandle {}; }
+    const TextureHandle handle = texturePool.Add(texture, description.name);
+    sizedTargets.push_back(SizedTarget { handle, description });
+    return handle;
+}
 
+SDL_GPUTexture* Renderer::CreateSizedTexture(const SizedTargetDescription& description) const {
+    auto scaleSize = [&description](Uint32 size) {
+        return SDL_max(1u, static_cast<Uint32>(static_cast<float>(size) * description.scale));
+    };
+    SDL_GPUTexture* texture = CreateTexture(SDL_GPUTextureCreateInfo {
+        .type = SDL_GPU_TEXTURETYPE_2D,
+        .format = description.format,
+        .usage = description.usage,
+        .width = scaleSize(sizedTargetWidth),
+        .height = scaleSize(sizedTargetHeight),
+        .layer_count_or_depth = 1,
+        .num_levels = 1,
+        .sample_count = description.sampleCount
+    });
+    if (texture == nullptr) {
+        SDL_Log("CreateTexture %s failed: %s", description.name.c_str(), SDL_GetError());
+        return nullptr;
+    }
+    SetTextureName(texture, description.name);
+    return texture;
+}
+
+Uint64 Renderer::ComputeTextureSize(const SDL_GPUTextureCreateInfo& createInfo) {
+    // Every layer of a 2D array or a cube, the depth of 3D textures shrinks with the levels
+    const bool is3D = createInfo.type == SDL_GPU_TEXTURETYPE_3D;
+    Uint64 size = 0;
+    for (Uint32 level = 0; level < createInfo.num_levels; ++level) {
+        const Uint32 depth = is3D ? SDL_max(createInfo.layer_count_or_depth >> level, 1u)
+                                  : createInfo.layer_count_or_depth;
+        size += SDL_CalculateGPUTextureFormatSize(createInfo.format, SDL_max(createInfo.width >> level, 1u),
+                                                  SDL_max(createInfo.height >> level, 1u), depth);
+    }
+    // SDL_GPU_SAMPLECOUNT_N is log2(N)
+    return size << createInfo.sample_count;
+}
+
+void Renderer::ForgetGpuAllocation(const void* resource) {
+    const auto allocation = gpuAllocations.find(resource);
+    if (allocation == gpuAllocations.end()) { return; }
+    switch (allocation->second.type) {
+        case GPUResourceType::Texture: gpuMemory.textureBytes -= allocation->second.size; break;
+        case GPUResourceType::Buffer: gpuMemory.bufferBytes -= allocation->second.size; break;
+        case GPUResourceType::TransferBuffer: gpuMemory.transferBufferBytes -= allocation->second.size; break;
+        default: break;
+    }
+    gpuAllocations.erase(allocation);
+}
+
+GpuMemoryStats Renderer::GetGpuMemoryStats() const {
+    GpuMemoryStats stats = gpuMemory;
+    stats.bufferBytes += vertexAllocator.GetPoolBytes() + indexAllocator.GetPoolBytes()
+                         + storageAllocator.GetPoolBytes();
+    return stats;
+}
+
+void Renderer::UpdateSizedTargets() {
+    int w, h;
+    SDL_GetWindowSizeInPixels(renderWindow, &w, &h);
+    // Minimized
+    if (w <= 0 || h <= 0 || sizedTargets.empty()) { return; }
+
+    const Uint32 width = static_cast<Uint32>(w);
+    const Uint32 height = static_cast<Uint32>(h);
+    const Uint32 lastResize = SDL_GetAtomicU32(&lastResizeTicks);
+    const bool isSettled = static_cast<Uint32>(SDL_GetTicks()) - lastResize >= RESIZE_SETTLE_TIME;
+
+    Uint32 newWidth = sizedTargetWidth;
+    Uint32 newHeight = sizedTargetHeight;
+    if (isSettled) {
+        newWidth = width;
+        newHeight = height;
+    } else if (width > sizedTargetWidth || height > sizedTargetHeight) {
+        // Bursts of resize events while dragging: grow with margin, never shrink
+        auto roundUp = [](Uint32 size) {
+            return (size + RESIZE_GRANULARITY - 1) / RESIZE_GRANULARITY * RESIZE_GRANULARITY;
+        };
+        newWidth = roundUp(SDL_max(width, sizedTargetWidth));
+        newHeight = roundUp(SDL_max(height, sizedTargetHeight));
+    }
+    if (newWidth == sizedTargetWidth && newHeight == sizedTargetHeight) { return; }
+
+    sizedTargetWidth = newWidth;
+    sizedTargetHeight = newHeight;
+    for (size_t i = 0; i < sizedTargets.size();) {
+        // Targets released through their handle are forgotten
+        if (texturePool.Get(sizedTargets[i].handle) == nullptr) {
+            sizedTargets[i] = sizedTargets.back();
+            sizedTargets.pop_back();
+            continue;
+        }
+        SDL_GPUTexture* texture = CreateSizedTexture(sizedTargets[i].description);
+        if (texture != nullptr) {
+            // Frames in flight may still use the previous texture
+            SDL_GPUTexture* previous = texturePool.Replace(sizedTargets[i].handle, texture);
+            ForgetGpuAllocation(previous);
+            releaseQueue.Push(GPUResourceType::Texture, previous, submittedFrameCount);
+        }
+        ++i;
+    }
+    SDL_Log("Sized targets reallocated at %ux%u", sizedTargetWidth, sizedTargetHeight);
+}
 
+bool SDLCALL Renderer::OnWindowEvent(void* userData, SDL_Event* event) {
+    auto renderer = static_cast<Renderer*>(userData);
+    if (event->type == SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED
+        && event->window.windowID == SDL_GetWindowID(renderer->renderWindow)) {
+        SDL_SetAtomicU32(&renderer->lastResizeTicks, static_cast<Uint32>(SDL_GetTicks()));
+    }
+    return true;
+}
 
+TextureHandle Renderer::CreateTextureHandle(const SDL_GPUTextureCreateInfo& createInfo, const string& name) {
+    SDL_GPUTexture* texture = CreateTexture(createInfo);
+    if (texture == nullptr) {
+        SDL_Log("CreateTexture %s failed: %s", name.c_str(), SDL_GetError());
+        return TextureHandle {};
+    }
+    SetTextureName(texture, name);
+    return texturePool.Add(texture, name);
+}
+
+BufferHandle Renderer::CreateBufferHandle(const SDL_GPUBufferCreateInfo& createInfo, const string& name) {
+    SDL_GPUBuffer* buffer = CreateBuffer(createInfo);
+    if (buffer == nullptr) {
+        SDL_Log("CreateBuffer %s failed: %s", name.c_str(), SDL_GetError());
+        return BufferHandle {};
+    }
+    SetBufferName(buffer, name);
+    return bufferPool.Add(buffer, name);
+}
+
+SDL_GPUTexture* Renderer::GetTexture(TextureHandle handle) const { return texturePool.Get(handle); }
+
+SDL_GPUBuffer* Renderer::GetBuffer(BufferHandle handle) const { return bufferPool.Get(handle); }
+
+void Renderer::Release(TextureHandle& handle) {
+    ReleaseTexture(texturePool.Remove(handle));
+    handle = TextureHandle {};
+}
+
+void Renderer::Release(BufferHandle& handle) {
+    ReleaseBuffer(bufferPool.Remove(handle));
+    handle = BufferHandle {};
+}
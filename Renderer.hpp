@@ -6,26 +6,113 @@
 #define RENDERER_HPP
 
 #include <SDL3/SDL_gpu.h>
+#include <SDL3/SDL_atomic.h>
+#include <SDL3/SDL_events.h>
 #include <vector>
 #include <string>
+#include <deque>
+#include <unordered_map>
+#include <functional>
+
+#include "Handle.hpp"
+#include "DeferredReleaseQueue.hpp"
+#include "BufferAllocator.hpp"
+#include "AssetPackage.hpp"
 
 using std::vector;
 using std::string;
+using std::deque;
+using std::unordered_map;
+using std::function;
 
 class Window;
 
+/*
+ * Texture sized from the window, e.g. a depth buffer or an HDR color target.
+ * The renderer recreates it when the window pixel size changes.
+ */
+struct SizedTargetDescription {
+    string name;
+    SDL_GPUTextureFormat format { SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM };
+    SDL_GPUTextureUsageFlags usage { SDL_GPU_TEXTUREUSAGE_COLOR_TARGET };
+    float scale { 1.0f }; // Relative to the window pixel size, e.g. 0.5 for half resolution
+    SDL_GPUSampleCount sampleCount { SDL_GPU_SAMPLECOUNT_1 };
+};
+
+/*
+ * Commands recorded during a frame, counted by the renderer calls.
+ * Skipped state changes are binds that a DrawQueue found redundant and did not issue.
+ */
+struct RendererStats {
+    Uint32 drawCalls { 0 };
+    Uint32 dispatches { 0 };
+    Uint32 pipelineBinds { 0 };
+    Uint32 bufferBinds { 0 }; // Vertex, index and storage buffers, storage textures
+    Uint32 samplerBinds { 0 };
+    Uint32 uniformPushes { 0 };
+    Uint32 skippedStateChanges { 0 };
+    Uint32 depthPrePassDraws { 0 };
+    // Pixels rasterized by the queued draws, from the coverage estimates of their packets
+    Uint64 rasterizedPixels { 0 };
+    Uint64 depthPrePassPixels { 0 };
+    Uint32 targetPixels { 0 }; // Swapchain pixel count
+    Uint32 scissorChanges { 0 };
+    Uint64 uploadBytes { 0 }; // Copied into buffers and textures
+
+    Uint32 StateChanges() const { return pipelineBinds + bufferBinds + samplerBinds + uniformPushes; }
+
+    // Average number of times each pixel is rasterized by the color draws. With a depth pre-pass, the hidden
+    // fragments among them fail the early depth test and are not shaded.
+    float Overdraw() const {
+        return targetPixels > 0 ? static_cast<float>(rasterizedPixels) / static_cast<float>(targetPixels) : 0.0f;
+    }
+};
+
+/*
+ * GPU memory held by the resources created through the renderer, from their create infos: drivers add alignment and
+ * metadata on top.
+ */
+struct GpuMemoryStats {
+    Uint64 textureBytes { 0 };
+    Uint64 bufferBytes { 0 }; // With the pools of the shared buffers
+    Uint64 transferBufferBytes { 0 };
+
+    Uint64 Total() const { return textureBytes + bufferBytes + transferBufferBytes; }
+};
+
 class Renderer {
 public:
     void Init(Window& window);
 
     void Begin(SDL_GPUDepthStencilTargetInfo* depthStencilTargetInfo = nullptr);
 
-    void End() const;
+    void End();
 
-    void Close() const;
+    // Same as Begin, with the renderer depth buffer cleared to clearDepth
+    void BeginWithDepth(float clearDepth = 1.0f);
 
-    void SubmitCommandBuffer() const;
+    // Format of the renderer depth buffer, the most precise depth-only format the device supports
+    SDL_GPUTextureFormat GetDepthFormat();
 
+    // Same as BeginWithDepth, with a depth stencil buffer, e.g. for stencil masks
+    void BeginWithDepthStencil(float clearDepth = 1.0f, Uint8 clearStencil = 0);
+
+    // Format of the renderer depth stencil buffer, with 8 bits of stencil
+    SDL_GPUTextureFormat GetDepthStencilFormat();
+
+    // Render pass in the frame command buffer, e.g. into an offscreen target. The buffer is submitted by End or
+    // SubmitCommandBuffer.
+    void BeginRenderPass(const SDL_GPUColorTargetInfo& colorTargetInfo,
+                         SDL_GPUDepthStencilTargetInfo* depthStencilTargetInfo = nullptr);
+
+    void EndRenderPass();
+
+    // Wait for the GPU, report the handles still alive and release everything left
+    void Close();
+
+    void SubmitCommandBuffer();
+
+    // From the asset package opened by Init when it has the shader, else from the compiled shader files
     SDL_GPUShader* LoadShader(
             const char* basePath,
             const char* shaderFilename,
@@ -35,10 +122,34 @@ public:
             Uint32 storageTextureCount
     );
 
+    // Same as LoadShader, from the blob cooked for the current backend
+    SDL_GPUShader* LoadShaderFromPackage(
+            const AssetPackage& package,
+            const char* shaderFilename,
+            Uint32 samplerCount,
+            Uint32 uniformBufferCount,
+            Uint32 storageBufferCount,
+            Uint32 storageTextureCount
+    );
+
     void ReleaseShader(SDL_GPUShader* shader) const;
 
     SDL_Surface* LoadBMPImage(const char* basePath, const char* imageFilename, int desiredChannels);
 
+    // Load a .astc or .dds texture. Blocks are uploaded as is when the device supports the format,
+    // otherwise they are decoded on the CPU into a R8G8B8A8 texture.
+    SDL_GPUTexture* LoadCompressedTexture(const char* basePath, const char* imageFilename,
+                                          bool* outIsNative = nullptr);
+
+    // Load the six BMP faces of a cube texture, in +X, -X, +Y, -Y, +Z, -Z order. Faces are decoded in parallel
+    // on the task scheduler and uploaded in a single copy pass. They must be square and of the same size.
+    static constexpr Uint32 CUBE_FACE_COUNT = 6;
+    SDL_GPUTexture* LoadCubemap(const char* basePath, const char* const faceFilenames[CUBE_FACE_COUNT]);
+
+    // Create a texture with all the mip levels cooked in the package.
+    // Compressed textures the GPU cannot sample are decoded to R8G8B8A8.
+    SDL_GPUTexture* CreateTextureFromPackage(const AssetPackage& package, const char* imageFilename);
+
     SDL_GPUSampler* CreateSampler(const SDL_GPUSamplerCreateInfo& createInfo) const;
 
     void ReleaseSurface(SDL_Surface* surface) const;
@@ -47,9 +158,13 @@ public:
 
     void SetTextureName(SDL_GPUTexture* texture, const string& name) const;
 
-    void ReleaseTexture(SDL_GPUTexture* texture) const;
+    // Release functions are deferred: the resource is freed once the frames that may use it have retired
+    void ReleaseTexture(SDL_GPUTexture* texture);
 
-    void ReleaseSampler(SDL_GPUSampler* sampler) const;
+    // Fill every mip level from level 0. The texture needs the SAMPLER and COLOR_TARGET usages.
+    void GenerateMipmaps(SDL_GPUTexture* texture) const;
+
+    void ReleaseSampler(SDL_GPUSampler* sampler);
 
 
     SDL_GPUGraphicsPipeline* CreateGPUGraphicsPipeline(const SDL_GPUGraphicsPipelineCreateInfo& createInfo) const;
@@ -60,13 +175,26 @@ public:
 
     void BindIndexBuffer(const SDL_GPUBufferBinding& bindings, SDL_GPUIndexElementSize indexElementSize) const;
 
+    void BindVertexBuffer(Uint32 slot, const BufferAllocation& allocation) const;
+
+    void BindIndexBuffer(const BufferAllocation& allocation, SDL_GPUIndexElementSize indexElementSize) const;
+
     void BindFragmentSamplers(Uint32 firstSlot, const SDL_GPUTextureSamplerBinding& bindings, Uint32 numBindings) const;
 
+    // Storage buffers read by vertex shaders, e.g. per instance data
+    void BindVertexStorageBuffers(Uint32 firstSlot, SDL_GPUBuffer* const* buffers, Uint32 numBuffers) const;
+
     void DrawPrimitives(int numVertices, int numInstances, int firstVertex, int firstInstance) const;
 
     void DrawIndexedPrimitives(int numIndices, int numInstances, int firstIndex, int vertexOffset,
                                int firstInstance) const;
 
+    // Draw with commands written in a GPU buffer, e.g. by a culling compute pass
+    void DrawIndexedPrimitivesIndirect(SDL_GPUBuffer* buffer, Uint32 offset, Uint32 drawCount) const;
+
+    // Non indexed version, for meshes expanded from the vertex id
+    void DrawPrimitivesIndirect(SDL_GPUBuffer* buffer, Uint32 offset, Uint32 drawCount) const;
+
     void SetViewport(const SDL_GPUViewport& viewport) const;
 
     void SetScissorRect(const SDL_Rect& rect) const;
@@ -87,21 +215,30 @@ public:
 
     void UnmapTransferBuffer(SDL_GPUTransferBuffer* transferBuffer) const;
 
-    void ReleaseTransferBuffer(SDL_GPUTransferBuffer* transferBuffer) const;
+    void ReleaseTransferBuffer(SDL_GPUTransferBuffer* transferBuffer);
 
     void BeginUploadToBuffer();
 
     void UploadToBuffer(const SDL_GPUTransferBufferLocation& source,
                         const SDL_GPUBufferRegion& destination, bool cycle) const;
 
+    // Upload into a sub-allocated range. Never cycles, the buffer is shared.
+    void UploadToBuffer(const SDL_GPUTransferBufferLocation& source, const BufferAllocation& destination) const;
+
     void UploadToTexture(const SDL_GPUTextureTransferInfo& source,
                          const SDL_GPUTextureRegion& destination, bool cycle) const;
 
-    void EndUploadToBuffer(SDL_GPUTransferBuffer* transferBuffer, bool release = true) const;
+    void EndUploadToBuffer(SDL_GPUTransferBuffer* transferBuffer, bool release = true);
 
-    void ReleaseBuffer(SDL_GPUBuffer* buffer) const;
+    void ReleaseBuffer(SDL_GPUBuffer* buffer);
 
-    void ReleaseGraphicsPipeline(SDL_GPUGraphicsPipeline* pipeline) const;
+    // Sub-allocate a range of the large buffers shared by a usage class
+    BufferAllocation AllocateBuffer(BufferUsageClass usageClass, Uint32 size);
+
+    // Deferred like the other releases
+    void FreeBuffer(BufferAllocation& allocation);
+
+    void ReleaseGraphicsPipeline(SDL_GPUGraphicsPipeline* pipeline);
 
     void PushVertexUniformData(uint32_t slot, const void* data, Uint32 size) const;
 
@@ -113,29 +250,120 @@ public:
     void BeginCompute(SDL_GPUStorageTextureReadWriteBinding* storageTextureBindings, Uint32 numStorageTextureBindings,
                       SDL_GPUStorageBufferReadWriteBinding* storageBufferBindings, Uint32 numStorageBufferBindings);
 
-    void BindComputePipeline(SDL_GPUComputePipeline* computePipeline) const;
+    // Same as BeginCompute, recorded in the frame command buffer so that it is ordered with the frame render passes
+    void BeginComputeInFrame(SDL_GPUStorageTextureReadWriteBinding* storageTextureBindings,
+                             Uint32 numStorageTextureBindings,
+                             SDL_GPUStorageBufferReadWriteBinding* storageBufferBindings,
+                             Uint32 numStorageBufferBindings);
+
+    void BindComputePipeline(SDL_GPUComputePipeline* computePipeline);
+
+    // Read-only storage textures
+    void BindComputeStorageTextures(Uint32 firstSlot, SDL_GPUTexture* const* textures, Uint32 numTextures) const;
 
     void BindComputeStorageBuffers(Uint32 firstSlot, SDL_GPUBuffer* buffers, Uint32 numBuffers) const;
 
     void DispatchCompute(Uint32 groupCountX, Uint32 groupCountY, Uint32 groupCountZ);
 
+    // Dispatch enough groups of the bound pipeline threadcount to cover a problem of this size.
+    // Edge groups run extra threads, so shaders must bounds check, e.g. against their output texture size.
+    void DispatchComputeForSize(Uint32 sizeX, Uint32 sizeY, Uint32 sizeZ);
+
+    // Same, and push the size as a uint4 (x, y, z, 0) at uniform slot boundsSlot, for shaders without an output
+    // texture to check against
+    void DispatchComputeForSize(Uint32 sizeX, Uint32 sizeY, Uint32 sizeZ, Uint32 boundsSlot);
+
+    static Uint32 GetGroupCount(Uint32 size, Uint32 threadCount) { return (size + threadCount - 1) / threadCount; }
+
     void PushComputeUniformData(uint32_t slot, const void* data, Uint32 size) const;
 
     void EndCompute();
 
-    void ReleaseComputePipeline(SDL_GPUComputePipeline* computePipeline) const;
+    void ReleaseComputePipeline(SDL_GPUComputePipeline* computePipeline);
 
-    void AcquireCmdBufferAndSwapchainTexture(Uint32 width, Uint32 height);
+    // The size of the acquired texture is kept in swapchainWidth and swapchainHeight
+    void AcquireCmdBufferAndSwapchainTexture();
 
     void BlitSwapchainTexture(Uint32 sourceWidth, Uint32 sourceHeight, SDL_GPUTexture* sourceTexture,
                               Uint32 destinationWidth, Uint32 destinationHeight, SDL_GPUFilter filter) const;
 
     bool IsSwapchainTextureValid() const;
 
+    // Returns false, and keeps the current composition, when the window does not support it
+    bool SetSwapchainComposition(SDL_GPUSwapchainComposition composition);
+
+    // Present mode of the swapchain, e.g. IMMEDIATE or MAILBOX for latency testing.
+    // Returns false, and keeps the current mode, when the window does not support it.
+    bool SetPresentMode(SDL_GPUPresentMode mode);
+
+    SDL_GPUPresentMode GetPresentMode() const { return presentMode; }
+
+    static const char* GetPresentModeName(SDL_GPUPresentMode mode);
+
+    // Texture recreated when the window pixel size changes. The handle stays valid, resolve it every frame.
+    // While the window is being resized, targets only grow, by RESIZE_GRANULARITY steps, so they can be larger
+    // than the swapchain: render with the swapchain size as viewport. They get the exact size once the window
+    // has not been resized for RESIZE_SETTLE_TIME. Release with Release(TextureHandle&).
+    TextureHandle CreateSizedTarget(const SizedTargetDescription& description);
+
+    // Size the targets are allocated for, at scale 1
+    Uint32 GetSizedTargetWidth() const { return sizedTargetWidth; }
+    Uint32 GetSizedTargetHeight() const { return sizedTargetHeight; }
+
+    static constexpr Uint32 RESIZE_GRANULARITY = 128;
+    static constexpr Uint32 RESIZE_SETTLE_TIME = 200; // Milliseconds
+
+    // Handle based resources. Handles of released resources resolve to nullptr.
+    TextureHandle CreateTextureHandle(const SDL_GPUTextureCreateInfo& createInfo, const string& name);
+
+    BufferHandle CreateBufferHandle(const SDL_GPUBufferCreateInfo& createInfo, const string& name);
+
+    SDL_GPUTexture* GetTexture(TextureHandle handle) const;
+
+    SDL_GPUBuffer* GetBuffer(BufferHandle handle) const;
+
+    void Release(TextureHandle& handle);
+
+    void Release(BufferHandle& handle);
+
+    // Time between the last two frame submissions, in seconds
+    float GetLastFrameTime() const { return lastFrameTime; }
+
+    // Counters of the last submitted frame
+    const RendererStats& GetFrameStats() const { return lastFrameStats; }
+
+    GpuMemoryStats GetGpuMemoryStats() const;
+
+    // Shaders and compute pipelines that could not be loaded or created, e.g. because their binaries are not compiled
+    Uint32 GetShaderFailureCount() const { return shaderFailureCount; }
+
+    // Called before each frame is submitted, when there is a swapchain texture, e.g. to draw a HUD over every scene.
+    // It records in the frame command buffer outside of any pass, and is left out of the frame counters.
+    void SetOverlay(const function<void(Renderer&)>& overlay_) { overlay = overlay_; }
+
+    void RecordSkippedStateChanges(Uint32 count) const { frameStats.skippedStateChanges += count; }
+
+    void RecordCoverage(Uint64 pixels, bool isDepthPrePass) const {
+        if (isDepthPrePass) { frameStats.depthPrePassPixels += pixels; }
+        else { frameStats.rasterizedPixels += pixels; }
+    }
+
+    void RecordDepthPrePassDraws(Uint32 count) const { frameStats.depthPrePassDraws += count; }
+
+    // Index of the frame being recorded
+    Uint64 GetFrameIndex() const { return submittedFrameCount; }
+
+    // Every frame before this index is complete on the GPU
+    Uint64 GetCompletedFrameCount() const { return completedFrameCount; }
+
+    static constexpr Uint32 MAX_FRAMES_IN_FLIGHT = 3;
+
     SDL_GPUDevice* device { nullptr };
     SDL_Window* renderWindow { nullptr };
     SDL_GPUCommandBuffer* cmdBuffer { nullptr };
     SDL_GPUTexture* swapchainTexture { nullptr };
+    Uint32 swapchainWidth { 0 };
+    Uint32 swapchainHeight { 0 };
     SDL_GPURenderPass* renderPass { nullptr };
 
     SDL_GPUCommandBuffer* uploadCmdBuf { nullptr };
@@ -144,6 +372,90 @@ public:
     SDL_GPUComputePass* computePass { nullptr };
     SDL_GPUCommandBuffer* computeCmdBuffer { nullptr };
 
+private:
+    struct ComputeThreadCount {
+        Uint32 x;
+        Uint32 y;
+        Uint32 z;
+    };
+
+    struct InFlightFrame {
+        Uint64 frame;
+        SDL_GPUFence* fence;
+    };
+
+    struct SizedTarget {
+        TextureHandle handle;
+        SizedTargetDescription description;
+    };
+
+    // Submit the frame command buffer with a fence and release what retired frames no longer use
+    void SubmitFrame();
+
+    // Recreate the sized targets if the window pixel size changed. Called between frames.
+    void UpdateSizedTargets();
+
+    SDL_GPUTexture* CreateSizedTexture(const SizedTargetDescription& description) const;
+
+    static Uint64 ComputeTextureSize(const SDL_GPUTextureCreateInfo& createInfo);
+
+    // Forget a resource in the GPU memory counts, when its release is requested
+    void ForgetGpuAllocation(const void* resource);
+
+    // Begin with a renderer depth buffer, created as a sized target on first use
+    void BeginWithDepthTarget(TextureHandle& target, const char* name, SDL_GPUTextureFormat format,
+                              float clearDepth, Uint8 clearStencil);
+
+    // Event watch, may run on another thread
+    static bool SDLCALL OnWindowEvent(void* userData, SDL_Event* event);
+
+    void RetireCompletedFrames();
+
+    Uint64 submittedFrameCount { 0 };
+    Uint64 completedFrameCount { 0 };
+    Uint64 lastSubmitTicks { 0 };
+    float lastFrameTime { 0.0f };
+    // Counted from the const recording calls
+    mutable RendererStats frameStats;
+    RendererStats lastFrameStats;
+    deque<InFlightFrame> inFlightFrames;
+    DeferredReleaseQueue releaseQueue;
+    HandlePool<SDL_GPUTexture> texturePool;
+    HandlePool<SDL_GPUBuffer> bufferPool;
+    BufferAllocator vertexAllocator;
+    BufferAllocator indexAllocator;
+    BufferAllocator storageAllocator;
+
+    vector<SizedTarget> sizedTargets;
+    // Shared depth buffers, created by the first BeginWithDepth or BeginWithDepthStencil
+    TextureHandle depthTarget;
+    SDL_GPUTextureFormat depthFormat { SDL_GPU_TEXTUREFORMAT_INVALID };
+    TextureHandle depthStencilTarget;
+    SDL_GPUTextureFormat depthStencilFormat { SDL_GPU_TEXTUREFORMAT_INVALID };
+    Uint32 sizedTargetWidth { 0 };
+    Uint32 sizedTargetHeight { 0 };
+    SDL_AtomicU32 lastResizeTicks {}; // Milliseconds, truncated
+    SDL_GPUSwapchainComposition swapchainComposition { SDL_GPU_SWAPCHAINCOMPOSITION_SDR };
+    SDL_GPUPresentMode presentMode { SDL_GPU_PRESENTMODE_VSYNC };
+
+    // Thread counts are not queryable from SDL pipelines, so they are kept from the create info
+    unordered_map<SDL_GPUComputePipeline*, ComputeThreadCount> computeThreadCounts;
+    ComputeThreadCount boundComputeThreadCount { 1, 1, 1 };
+
+    struct GpuAllocation {
+        GPUResourceType type;
+        Uint64 size;
+        SDL_GPUTextureFormat format; // Textures only, to count their uploads
+    };
+    // Filled by the const create functions
+    mutable unordered_map<const void*, GpuAllocation> gpuAllocations;
+    mutable GpuMemoryStats gpuMemory;
+
+    function<void(Renderer&)> overlay;
+
+    // Content/Assets.pak when it was cooked, shaders are loaded from it first
+    AssetPackage assetPackage;
+    Uint32 shaderFailureCount { 0 };
 };
 
 
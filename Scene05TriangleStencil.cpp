@@ -14,30 +14,8 @@ void Scene05TriangleStencil::Load(Renderer& renderer) {
     fragmentShader = renderer.LoadShader(basePath, "SolidColor.frag", 0, 0, 0, 0);
 
 
-	SDL_GPUTextureFormat depthStencilFormat;
-
-	if (SDL_GPUTextureSupportsFormat(
-		renderer.device,
-		SDL_GPU_TEXTUREFORMAT_D24_UNORM_S8_UINT,
-		SDL_GPU_TEXTURETYPE_2D,
-		SDL_GPU_TEXTUREUSAGE_DEPTH_STENCIL_TARGET
-	))
-	{
-		depthStencilFormat = SDL_GPU_TEXTUREFORMAT_D24_UNORM_S8_UINT;
-	}
-	else if (SDL_GPUTextureSupportsFormat(
-		renderer.device,
-		SDL_GPU_TEXTUREFORMAT_D32_FLOAT_S8_UINT,
-		SDL_GPU_TEXTURETYPE_2D,
-		SDL_GPU_TEXTUREUSAGE_DEPTH_STENCIL_TARGET
-	))
-	{
-		depthStencilFormat = SDL_GPU_TEXTUREFORMAT_D32_FLOAT_S8_UINT;
-	}
-	else
-	{
-		SDL_Log("Stencil formats not supported!");
-	}
+	// Renderer depth stencil buffer, with 8 bits of stencil
+	const SDL_GPUTextureFormat depthStencilFormat = renderer.GetDepthStencilFormat();
 
 	SDL_GPUGraphicsPipelineCreateInfo pipelineCreateInfo = {
         .vertex_shader = vertexShader,
@@ -137,23 +115,6 @@ void Scene05TriangleStencil::Load(Renderer& renderer) {
 		}
 	);
 
-	int w, h;
-	SDL_GetWindowSizeInPixels(renderer.renderWindow, &w, &h);
-
-	depthStencilTexture = SDL_CreateGPUTexture(
-		renderer.device,
-		new SDL_GPUTextureCreateInfo {
-		.type = SDL_GPU_TEXTURETYPE_2D,
-		.format = depthStencilFormat,
-		.usage = SDL_GPU_TEXTUREUSAGE_DEPTH_STENCIL_TARGET,
-		.width = static_cast<Uint32>(w),
-		.height = static_cast<Uint32>(h),
-		.layer_count_or_depth = 1,
-		.num_levels = 1,
-		.sample_count = SDL_GPU_SAMPLECOUNT_1
-	}
-	);
-
 	SDL_GPUTransferBuffer* transferBuffer = SDL_CreateGPUTransferBuffer(
 		renderer.device,
 		new SDL_GPUTransferBufferCreateInfo {
@@ -198,6 +159,7 @@ void Scene05TriangleStencil::Load(Renderer& renderer) {
 	SDL_SubmitGPUCommandBuffer(uploadCmdBuf);
 	SDL_ReleaseGPUTransferBuffer(renderer.device, transferBuffer);
 
+	SDL_Log("Press Up/Down to change the present mode");
 
 /*
 
@@ -369,98 +331,43 @@ void Scene05TriangleStencil::Load(Renderer& renderer) {
 
 bool Scene05TriangleStencil::Update(float dt) {
     const bool isRunning = ManageInput(inputState);
+
+    if (inputState.IsPressed(DirectionalKey::Up) || inputState.IsPressed(DirectionalKey::Down)) {
+        isPresentModeChangeRequested = true;
+        presentModeStep = inputState.IsPressed(DirectionalKey::Up) ? 1 : PRESENT_MODE_COUNT - 1;
+    }
     return isRunning;
 }
 
 void Scene05TriangleStencil::Draw(Renderer& renderer) {
-
-    SDL_GPUCommandBuffer* cmdbuf = SDL_AcquireGPUCommandBuffer(renderer.device);
-    if (cmdbuf == nullptr)
-    {
-        SDL_Log("AcquireGPUCommandBuffer failed: %s", SDL_GetError());
+    if (isPresentModeChangeRequested) {
+        // Skip the modes the window does not support
+        SDL_GPUPresentMode mode = renderer.GetPresentMode();
+        for (int i = 0; i < PRESENT_MODE_COUNT; ++i) {
+            mode = static_cast<SDL_GPUPresentMode>((mode + presentModeStep) % PRESENT_MODE_COUNT);
+            if (renderer.SetPresentMode(mode)) { break; }
+        }
+        SDL_Log("Present mode: %s", Renderer::GetPresentModeName(renderer.GetPresentMode()));
+        isPresentModeChangeRequested = false;
     }
 
-    SDL_GPUTexture* swapchainTexture;
-    if (!SDL_AcquireGPUSwapchainTexture(cmdbuf, renderer.renderWindow, &swapchainTexture, nullptr, nullptr)) {
-        SDL_Log("AcquireGPUSwapchainTexture failed: %s", SDL_GetError());
-    }
-
-    if (swapchainTexture != nullptr)
-    {
-        SDL_GPUColorTargetInfo colorTargetInfo = { 0 };
-        colorTargetInfo.texture = swapchainTexture;
-        colorTargetInfo.clear_color = SDL_FColor { 0.0f, 0.0f, 0.0f, 1.0f };
-        colorTargetInfo.load_op = SDL_GPU_LOADOP_CLEAR;
-        colorTargetInfo.store_op = SDL_GPU_STOREOP_STORE;
-
-        SDL_GPUDepthStencilTargetInfo depthStencilTargetInfo = { 0 };
-        depthStencilTargetInfo.texture = depthStencilTexture;
-        depthStencilTargetInfo.cycle = true;
-        depthStencilTargetInfo.clear_depth = 0;
-        depthStencilTargetInfo.clear_stencil = 0;
-        depthStencilTargetInfo.load_op = SDL_GPU_LOADOP_CLEAR;
-        depthStencilTargetInfo.store_op = SDL_GPU_STOREOP_DONT_CARE;
-        depthStencilTargetInfo.stencil_load_op = SDL_GPU_LOADOP_CLEAR;
-        depthStencilTargetInfo.stencil_store_op = SDL_GPU_STOREOP_DONT_CARE;
-
-        SDL_GPURenderPass* renderPass = SDL_BeginGPURenderPass(
-            cmdbuf,
-            &colorTargetInfo,
-            1,
-            &depthStencilTargetInfo
-        );
-
-        SDL_BindGPUVertexBuffers(renderPass, 0, new SDL_GPUBufferBinding {.buffer = vertexBuffer, .offset = 0 }, 1);
-
-        SDL_SetGPUStencilReference(renderPass, 1);
-        SDL_BindGPUGraphicsPipeline(renderPass, maskerPipeline);
-        SDL_DrawGPUPrimitives(renderPass, 3, 1, 0, 0);
-
-        SDL_SetGPUStencilReference(renderPass, 0);
-        SDL_BindGPUGraphicsPipeline(renderPass, maskeePipeline);
-        SDL_DrawGPUPrimitives(renderPass, 3, 1, 3, 0);
-
-
-        SDL_EndGPURenderPass(renderPass);
-    }
-
-    SDL_SubmitGPUCommandBuffer(cmdbuf);
-
+    renderer.BeginWithDepthStencil(0, 0);
+    if (renderer.IsSwapchainTextureValid()) {
+        SDL_GPUBufferBinding vertexBindings { .buffer = vertexBuffer, .offset = 0 };
+        renderer.BindVertexBuffers(0, vertexBindings, 1);
 
+        renderer.SetStencilReference(1);
+        renderer.BindGraphicsPipeline(maskerPipeline);
+        renderer.DrawPrimitives(3, 1, 0, 0);
 
-
-
-
-
-    /*
-    SDL_GPUDepthStencilTargetInfo depthStencilTargetInfo {};
-    depthStencilTargetInfo.texture = depthStencilTexture;
-    depthStencilTargetInfo.cycle = true;
-    depthStencilTargetInfo.clear_depth = 0;
-    depthStencilTargetInfo.clear_stencil = 0;
-    depthStencilTargetInfo.load_op = SDL_GPU_LOADOP_CLEAR;
-    depthStencilTargetInfo.store_op = SDL_GPU_STOREOP_DONT_CARE;
-    depthStencilTargetInfo.stencil_load_op = SDL_GPU_LOADOP_CLEAR;
-    depthStencilTargetInfo.stencil_store_op = SDL_GPU_STOREOP_DONT_CARE;
-
-    renderer.Begin(&depthStencilTargetInfo);
-    SDL_GPUBufferBinding vertexBindings { .buffer = vertexBuffer, .offset = 0 };
-    renderer.BindVertexBuffers(0, vertexBindings, 1);
-
-    renderer.SetGPUStencilReference(1);
-    renderer.BindGraphicsPipeline(maskerPipeline);
-    renderer.DrawGPUPrimitive(3, 1, 0, 0);
-
-    renderer.SetGPUStencilReference(0);
-    renderer.BindGraphicsPipeline(maskeePipeline);
-    renderer.DrawGPUPrimitive(3, 1, 3, 0);
-
+        renderer.SetStencilReference(0);
+        renderer.BindGraphicsPipeline(maskeePipeline);
+        renderer.DrawPrimitives(3, 1, 3, 0);
+    }
     renderer.End();
-    */
 }
 
 void Scene05TriangleStencil::Unload(Renderer& renderer) {
-    SDL_ReleaseGPUTexture(renderer.device, depthStencilTexture);
     renderer.ReleaseBuffer(vertexBuffer);
     renderer.ReleaseGraphicsPipeline(maskeePipeline);
     renderer.ReleaseGraphicsPipeline(maskerPipeline);
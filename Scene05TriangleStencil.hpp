@@ -23,7 +23,10 @@ private:
     SDL_GPUGraphicsPipeline* maskeePipeline;
     SDL_GPUGraphicsPipeline* maskerPipeline;
     SDL_GPUBuffer* vertexBuffer;
-    SDL_GPUTexture* depthStencilTexture;
+    bool isPresentModeChangeRequested { false };
+    int presentModeStep { 1 };
+
+    static constexpr int PRESENT_MODE_COUNT = 3;
 };
 
 
@@ -5,6 +5,7 @@
 #include "Scene07TextureQuad.hpp"
 #include "Renderer.hpp"
 #include "PositionTextureVertex.hpp"
+#include "MipChain.hpp"
 #include <SDL3/SDL.h>
 #include <cstring>
 
@@ -66,6 +67,7 @@ void Scene07TextureQuad::Load(Renderer& renderer) {
 		.address_mode_u = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
 		.address_mode_v = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
 		.address_mode_w = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
+		.max_lod = 1000.0f, // Allow sampling the whole mip chain
 	});
 	// PointWrap
 	samplers[1] = renderer.CreateSampler(SDL_GPUSamplerCreateInfo {
@@ -75,6 +77,7 @@ void Scene07TextureQuad::Load(Renderer& renderer) {
 		.address_mode_u = SDL_GPU_SAMPLERADDRESSMODE_REPEAT,
 		.address_mode_v = SDL_GPU_SAMPLERADDRESSMODE_REPEAT,
 		.address_mode_w = SDL_GPU_SAMPLERADDRESSMODE_REPEAT,
+		.max_lod = 1000.0f,
 	});
 	// LinearClamp
 	samplers[2] = renderer.CreateSampler(SDL_GPUSamplerCreateInfo {
@@ -84,6 +87,7 @@ void Scene07TextureQuad::Load(Renderer& renderer) {
 		.address_mode_u = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
 		.address_mode_v = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
 		.address_mode_w = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
+		.max_lod = 1000.0f,
 	});
 	// LinearWrap
 	samplers[3] = renderer.CreateSampler(SDL_GPUSamplerCreateInfo {
@@ -93,6 +97,7 @@ void Scene07TextureQuad::Load(Renderer& renderer) {
 		.address_mode_u = SDL_GPU_SAMPLERADDRESSMODE_REPEAT,
 		.address_mode_v = SDL_GPU_SAMPLERADDRESSMODE_REPEAT,
 		.address_mode_w = SDL_GPU_SAMPLERADDRESSMODE_REPEAT,
+		.max_lod = 1000.0f,
 	});
 	// AnisotropicClamp
 	samplers[4] = renderer.CreateSampler(SDL_GPUSamplerCreateInfo{
@@ -103,6 +108,7 @@ void Scene07TextureQuad::Load(Renderer& renderer) {
 		.address_mode_v = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
 		.address_mode_w = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
 		.max_anisotropy = 4,
+		.max_lod = 1000.0f,
 		.enable_anisotropy = true,
 	});
 	// AnisotropicWrap
@@ -114,6 +120,7 @@ void Scene07TextureQuad::Load(Renderer& renderer) {
 		.address_mode_v = SDL_GPU_SAMPLERADDRESSMODE_REPEAT,
 		.address_mode_w = SDL_GPU_SAMPLERADDRESSMODE_REPEAT,
 		.max_anisotropy = 4,
+		.max_lod = 1000.0f,
 		.enable_anisotropy = true,
 	});
 
@@ -136,11 +143,12 @@ void Scene07TextureQuad::Load(Renderer& renderer) {
 	SDL_GPUTextureCreateInfo textureInfo {
 		.type = SDL_GPU_TEXTURETYPE_2D,
 		.format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM,
-		.usage = SDL_GPU_TEXTUREUSAGE_SAMPLER,
+		// Color target usage is required to generate the mip chain on the GPU
+		.usage = SDL_GPU_TEXTUREUSAGE_SAMPLER | SDL_GPU_TEXTUREUSAGE_COLOR_TARGET,
 		.width = static_cast<Uint32>(imageData->w),
 		.height = static_cast<Uint32>(imageData->h),
 		.layer_count_or_depth = 1,
-		.num_levels = 1,
+		.num_levels = MipChain::ComputeLevelCount(imageData->w, imageData->h),
 	};
 	texture = renderer.CreateTexture(textureInfo);
 	renderer.SetTextureName(texture,"Ravioli Texture");
@@ -218,6 +226,7 @@ void Scene07TextureQuad::Load(Renderer& renderer) {
     renderer.UploadToBuffer(transferIndexBufferLocation, indexBufferRegion, false);
 	renderer.UploadToTexture(textureBufferLocation, textureBufferRegion, false);
     renderer.EndUploadToBuffer(transferBuffer);
+	renderer.GenerateMipmaps(texture);
 	renderer.ReleaseTransferBuffer(textureTransferBuffer);
 	renderer.ReleaseSurface(imageData);
 
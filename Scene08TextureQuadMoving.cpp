@@ -5,6 +5,7 @@
 #include "Scene08TextureQuadMoving.hpp"
 #include "Renderer.hpp"
 #include "PositionTextureVertex.hpp"
+#include "MipChain.hpp"
 #include "Mat4.hpp"
 #include <SDL3/SDL.h>
 #include <cstring>
@@ -68,6 +69,39 @@ void Scene08TextureQuadMoving::Load(Renderer& renderer) {
     renderer.ReleaseShader(vertexShader);
     renderer.ReleaseShader(fragmentShader);
 
+    // Same pipeline, with the per draw constants read from the uniform arena. The draw id comes from slot 1.
+    vertexShader = renderer.LoadShader(basePath, "TexturedQuadArena.vert", 0, 0, 1, 0);
+    fragmentShader = renderer.LoadShader(basePath, "TexturedQuadColor.frag", 1, 0, 0, 0);
+    pipelineCreateInfo.vertex_shader = vertexShader;
+    pipelineCreateInfo.fragment_shader = fragmentShader;
+    pipelineCreateInfo.vertex_input_state = SDL_GPUVertexInputState {
+        .vertex_buffer_descriptions = new SDL_GPUVertexBufferDescription[2] {{
+            .slot = 0,
+            .pitch = sizeof(PositionTextureVertex),
+            .input_rate = SDL_GPU_VERTEXINPUTRATE_VERTEX,
+            .instance_step_rate = 0,
+        }, UniformArena::GetDrawIdBufferDescription(1)},
+        .num_vertex_buffers = 2,
+        .vertex_attributes = new SDL_GPUVertexAttribute[3] {{
+            .location = 0,
+            .buffer_slot = 0,
+            .format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT3,
+            .offset = 0
+        }, {
+            .location = 1,
+            .buffer_slot = 0,
+            .format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT2,
+            .offset = sizeof(float) * 3
+        }, UniformArena::GetDrawIdAttribute(2, 1)},
+        .num_vertex_attributes = 3,
+    };
+    arenaPipeline = renderer.CreateGPUGraphicsPipeline(pipelineCreateInfo);
+    renderer.ReleaseShader(vertexShader);
+    renderer.ReleaseShader(fragmentShader);
+
+    uniformArena.Load(renderer, sizeof(QuadDrawConstants), QUAD_COUNT, "Quad Draw Constants");
+    SDL_Log("Press Left/Right to push uniforms per draw / read them from the uniform arena");
+
     // Texture sampler
 	sampler = renderer.CreateSampler(SDL_GPUSamplerCreateInfo {
 		.min_filter = SDL_GPU_FILTER_NEAREST,
@@ -76,6 +110,7 @@ void Scene08TextureQuadMoving::Load(Renderer& renderer) {
 		.address_mode_u = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
 		.address_mode_v = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
 		.address_mode_w = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
+		.max_lod = 1000.0f, // Allow sampling the whole mip chain
 	});
 
 
@@ -98,11 +133,12 @@ void Scene08TextureQuadMoving::Load(Renderer& renderer) {
 	SDL_GPUTextureCreateInfo textureInfo {
 		.type = SDL_GPU_TEXTURETYPE_2D,
 		.format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM,
-		.usage = SDL_GPU_TEXTUREUSAGE_SAMPLER,
+		// Color target usage is required to generate the mip chain on the GPU
+		.usage = SDL_GPU_TEXTUREUSAGE_SAMPLER | SDL_GPU_TEXTUREUSAGE_COLOR_TARGET,
 		.width = static_cast<Uint32>(imageData->w),
 		.height = static_cast<Uint32>(imageData->h),
 		.layer_count_or_depth = 1,
-		.num_levels = 1,
+		.num_levels = MipChain::ComputeLevelCount(imageData->w, imageData->h),
 	};
 	texture = renderer.CreateTexture(textureInfo);
 	renderer.SetTextureName(texture,"Ravioli Texture");
@@ -180,6 +216,7 @@ void Scene08TextureQuadMoving::Load(Renderer& renderer) {
     renderer.UploadToBuffer(transferIndexBufferLocation, indexBufferRegion, false);
 	renderer.UploadToTexture(textureBufferLocation, textureBufferRegion, false);
     renderer.EndUploadToBuffer(transferBuffer);
+	renderer.GenerateMipmaps(texture);
 	renderer.ReleaseTransferBuffer(textureTransferBuffer);
 	renderer.ReleaseSurface(imageData);
 }
@@ -188,64 +225,89 @@ bool Scene08TextureQuadMoving::Update(float dt) {
     const bool isRunning = ManageInput(inputState);
     time += dt;
 
+    if (inputState.IsPressed(DirectionalKey::Left)) {
+        isArenaEnabled = false;
+        SDL_Log("Uniforms pushed per draw");
+    }
+    if (inputState.IsPressed(DirectionalKey::Right)) {
+        isArenaEnabled = true;
+        SDL_Log("Uniforms read from the arena");
+    }
+
+    timeSinceLastLog += dt;
+    if (timeSinceLastLog >= 1.0f) {
+        timeSinceLastLog = 0;
+        logStats = true;
+    }
+
     return isRunning;
 }
 
 void Scene08TextureQuadMoving::Draw(Renderer& renderer) {
-    renderer.Begin();
+    if (logStats) {
+        // Stats of the previous frame
+        const RendererStats& stats = renderer.GetFrameStats();
+        SDL_Log("Draws: %u, state changes: %u, skipped: %u",
+                stats.drawCalls, stats.StateChanges(), stats.skippedStateChanges);
+        logStats = false;
+    }
 
-    renderer.BindGraphicsPipeline(pipeline);
-    SDL_GPUBufferBinding vertexBindings { .buffer = vertexBuffer, .offset = 0 };
-    renderer.BindVertexBuffers(0, vertexBindings, 1);
-    SDL_GPUBufferBinding indexBindings { .buffer = indexBuffer, .offset = 0 };
-    renderer.BindIndexBuffer(indexBindings, SDL_GPU_INDEXELEMENTSIZE_16BIT);
-	SDL_GPUTextureSamplerBinding textureSamplerBinding { .texture = texture, .sampler = sampler };
-	renderer.BindFragmentSamplers(0, textureSamplerBinding, 1);
-
-
-    // Top-left
-    Mat4 matrixUniform =
-            Mat4::CreateRotationZ(time) *
-            Mat4::CreateTranslation(-0.5f, -0.5f, 0);
-    renderer.PushVertexUniformData(0, &matrixUniform, sizeof(matrixUniform));
-    FragMultiplyUniform fragMultiplyUniform0 { 1.0f, 0.5f + SDL_sinf(time) * 0.5f, 1.0f, 1.0f };
-    renderer.PushFragmentUniformData(0, &fragMultiplyUniform0, sizeof(FragMultiplyUniform));
-    renderer.DrawIndexedPrimitives(6, 1, 0, 0, 0);
-
-    // Top-right
-    matrixUniform =
-            Mat4::CreateRotationZ((2.0f * SDL_PI_F) - time) *
-            Mat4::CreateTranslation(0.5f, -0.5f, 0);
-    renderer.PushVertexUniformData(0, &matrixUniform, sizeof(matrixUniform));
-    FragMultiplyUniform fragMultiplyUniform1 { 1.0f, 0.5f + SDL_cosf(time) * 0.5f, 1.0f, 1.0f };
-    renderer.PushFragmentUniformData(0, &fragMultiplyUniform1, sizeof(FragMultiplyUniform));
-    renderer.DrawIndexedPrimitives(6, 1, 0, 0, 0);
-
-    // Bottom-left
-    matrixUniform =
-            Mat4::CreateRotationZ(time) *
-            Mat4::CreateTranslation(-0.5f, 0.5f, 0);
-    renderer.PushVertexUniformData(0, &matrixUniform, sizeof(matrixUniform));
-    FragMultiplyUniform fragMultiplyUniform2 { 1.0f, 0.5f + SDL_sinf(time) * 0.2f, 1.0f, 1.0f };
-    renderer.PushFragmentUniformData(0, &fragMultiplyUniform2, sizeof(FragMultiplyUniform));
-    renderer.DrawIndexedPrimitives(6, 1, 0, 0, 0);
-
-    // Bottom-right
-    matrixUniform =
-            Mat4::CreateRotationZ(time) *
-            Mat4::CreateTranslation(0.5f, 0.5f, 0);
-    renderer.PushVertexUniformData(0, &matrixUniform, sizeof(matrixUniform));
-    FragMultiplyUniform fragMultiplyUniform3 { 1.0f, 0.5f + SDL_cosf(time) * 1.0f, 1.0f, 1.0f };
-    renderer.PushFragmentUniformData(0, &fragMultiplyUniform3, sizeof(FragMultiplyUniform));
-    renderer.DrawIndexedPrimitives(6, 1, 0, 0, 0);
+    // Top-left, top-right, bottom-left, bottom-right
+    const QuadDrawConstants quads[QUAD_COUNT] {
+        {
+            Mat4::CreateRotationZ(time) * Mat4::CreateTranslation(-0.5f, -0.5f, 0),
+            { 1.0f, 0.5f + SDL_sinf(time) * 0.5f, 1.0f, 1.0f }
+        }, {
+            Mat4::CreateRotationZ((2.0f * SDL_PI_F) - time) * Mat4::CreateTranslation(0.5f, -0.5f, 0),
+            { 1.0f, 0.5f + SDL_cosf(time) * 0.5f, 1.0f, 1.0f }
+        }, {
+            Mat4::CreateRotationZ(time) * Mat4::CreateTranslation(-0.5f, 0.5f, 0),
+            { 1.0f, 0.5f + SDL_sinf(time) * 0.2f, 1.0f, 1.0f }
+        }, {
+            Mat4::CreateRotationZ(time) * Mat4::CreateTranslation(0.5f, 0.5f, 0),
+            { 1.0f, 0.5f + SDL_cosf(time) * 1.0f, 1.0f, 1.0f }
+        }
+    };
 
+    // The quads share the pipeline, mesh and texture: the queue only binds them once
+    DrawPacket quad {
+        .pipeline = isArenaEnabled ? arenaPipeline : pipeline,
+        .vertexBuffer = { .buffer = vertexBuffer, .offset = 0 },
+        .indexBuffer = { .buffer = indexBuffer, .offset = 0 },
+        .indexElementSize = SDL_GPU_INDEXELEMENTSIZE_16BIT,
+        .fragmentSampler = { .texture = texture, .sampler = sampler },
+        .indexCount = 6,
+    };
+    drawQueue.Clear();
+    if (isArenaEnabled) {
+        // Constants are uploaded in bulk, each draw only gives its draw id
+        uniformArena.Begin(renderer);
+        for (const QuadDrawConstants& constants : quads) {
+            quad.firstInstance = uniformArena.Push(&constants, sizeof(QuadDrawConstants));
+            drawQueue.Add(0, 0, quad);
+        }
+        uniformArena.Upload(renderer);
+    } else {
+        for (const QuadDrawConstants& constants : quads) {
+            drawQueue.Add(0, 0, quad, &constants.transform, sizeof(Mat4),
+                          &constants.multiplyColor, sizeof(FragMultiplyUniform));
+        }
+    }
+
+    renderer.Begin();
+    if (isArenaEnabled) {
+        uniformArena.Bind(renderer, 0, 1);
+    }
+    drawQueue.Submit(renderer);
     renderer.End();
 }
 
 void Scene08TextureQuadMoving::Unload(Renderer& renderer) {
+    uniformArena.Unload(renderer);
     renderer.ReleaseSampler(sampler);
     renderer.ReleaseBuffer(vertexBuffer);
     renderer.ReleaseBuffer(indexBuffer);
 	renderer.ReleaseTexture(texture);
+    renderer.ReleaseGraphicsPipeline(arenaPipeline);
     renderer.ReleaseGraphicsPipeline(pipeline);
 }
\ No newline at end of file
@@ -7,6 +7,9 @@
 
 #include <SDL3/SDL_gpu.h>
 #include "Scene.hpp"
+#include "DrawQueue.hpp"
+#include "UniformArena.hpp"
+#include "Mat4.hpp"
 #include <array>
 #include <string>
 
@@ -18,6 +21,12 @@ typedef struct FragMultiplyUniform
     float r, g, b, a;
 } fragMultiplyUniform;
 
+// Matches DrawConstants in TexturedQuadArena.vert
+struct QuadDrawConstants {
+    Mat4 transform;
+    FragMultiplyUniform multiplyColor;
+};
+
 class Scene08TextureQuadMoving : public Scene {
 public:
     void Load(Renderer& renderer) override;
@@ -25,6 +34,8 @@ public:
     void Draw(Renderer& renderer) override;
     void Unload(Renderer& renderer) override;
 
+    static constexpr Uint32 QUAD_COUNT = 4;
+
 private:
     InputState inputState;
     const char* basePath {nullptr};
@@ -32,11 +43,17 @@ private:
     SDL_GPUShader* fragmentShader {nullptr};
 
     SDL_GPUGraphicsPipeline* pipeline {nullptr};
+    SDL_GPUGraphicsPipeline* arenaPipeline {nullptr};
     SDL_GPUBuffer* vertexBuffer {nullptr};
     SDL_GPUBuffer* indexBuffer {nullptr};
     SDL_GPUTexture* texture {nullptr};
     SDL_GPUSampler* sampler {nullptr};
+    DrawQueue drawQueue;
+    UniformArena uniformArena;
+    bool isArenaEnabled {true};
     float time {0};
+    float timeSinceLastLog {0};
+    bool logStats {false};
 };
 
 #endif //SCENE08TEXTUREQUADMOVING_HPP
@@ -72,35 +72,16 @@ void Scene09BasicCompute::Load(Renderer& renderer) {
     // Screen texture
     int w, h;
     SDL_GetWindowSizeInPixels(renderer.renderWindow, &w, &h);
-
-    screenTexture = renderer.CreateTexture(SDL_GPUTextureCreateInfo {
-        .type = SDL_GPU_TEXTURETYPE_2D,
-        .format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM,
-        .usage = SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_WRITE | SDL_GPU_TEXTUREUSAGE_SAMPLER,
-        .width = static_cast<Uint32>(w),
-        .height = static_cast<Uint32>(h),
-        .layer_count_or_depth = 1,
-        .num_levels = 1,
-    });
+    CreateScreenTexture(renderer, static_cast<Uint32>(w), static_cast<Uint32>(h));
     sampler = renderer.CreateSampler(SDL_GPUSamplerCreateInfo {
         .address_mode_u = SDL_GPU_SAMPLERADDRESSMODE_REPEAT,
         .address_mode_v = SDL_GPU_SAMPLERADDRESSMODE_REPEAT
     });
 
     // Set the buffer data
-    // Create the vertex buffer
-    SDL_GPUBufferCreateInfo vertexBufferCreateInfo = {
-        .usage = SDL_GPU_BUFFERUSAGE_VERTEX,
-        .size = sizeof(PositionTextureVertex) * 4
-    };
-    vertexBuffer = renderer.CreateBuffer(vertexBufferCreateInfo);
-
-    // Create the index buffer
-    SDL_GPUBufferCreateInfo indexBufferCreateInfo = {
-        .usage = SDL_GPU_BUFFERUSAGE_INDEX,
-        .size = sizeof(Uint16) * 6
-    };
-    indexBuffer = renderer.CreateBuffer(indexBufferCreateInfo);
+    // Sub-allocate the vertex and index data from the renderer shared buffers
+    vertexAllocation = renderer.AllocateBuffer(BufferUsageClass::Vertex, sizeof(PositionTextureVertex) * 4);
+    indexAllocation = renderer.AllocateBuffer(BufferUsageClass::Index, sizeof(Uint16) * 6);
 
     SDL_GPUTransferBufferCreateInfo transferBufferCreateInfo = {
         .usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
@@ -132,24 +113,31 @@ void Scene09BasicCompute::Load(Renderer& renderer) {
         .transfer_buffer = transferBuffer,
         .offset = 0
     };
-    SDL_GPUBufferRegion vertexBufferRegion {
-        .buffer = vertexBuffer,
-        .offset = 0,
-        .size = sizeof(PositionTextureVertex) * 4
-    };
     SDL_GPUTransferBufferLocation transferIndexBufferLocation {
         .transfer_buffer = transferBuffer,
         .offset = sizeof(PositionTextureVertex) * 4
     };
-    SDL_GPUBufferRegion indexBufferRegion {
-        .buffer = indexBuffer,
-        .offset = 0,
-        .size = sizeof(Uint16) * 6
-    };
 
-    renderer.UploadToBuffer(transferVertexBufferLocation, vertexBufferRegion, false);
-    renderer.UploadToBuffer(transferIndexBufferLocation, indexBufferRegion, false);
+    renderer.UploadToBuffer(transferVertexBufferLocation, vertexAllocation);
+    renderer.UploadToBuffer(transferIndexBufferLocation, indexAllocation);
     renderer.EndUploadToBuffer(transferBuffer);
+}
+
+void Scene09BasicCompute::CreateScreenTexture(Renderer& renderer, Uint32 width, Uint32 height) {
+    if (screenTexture != nullptr) {
+        renderer.ReleaseTexture(screenTexture);
+    }
+    screenTexture = renderer.CreateTexture(SDL_GPUTextureCreateInfo {
+        .type = SDL_GPU_TEXTURETYPE_2D,
+        .format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM,
+        .usage = SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_WRITE | SDL_GPU_TEXTUREUSAGE_SAMPLER,
+        .width = width,
+        .height = height,
+        .layer_count_or_depth = 1,
+        .num_levels = 1,
+    });
+    screenWidth = width;
+    screenHeight = height;
 
     // Execute compute shader to fill the texture
     SDL_GPUStorageTextureReadWriteBinding storageTexture {
@@ -157,9 +145,9 @@ void Scene09BasicCompute::Load(Renderer& renderer) {
     };
     renderer.BeginCompute(&storageTexture, 1, nullptr, 0);
     renderer.BindComputePipeline(computePipeline);
-    renderer.DispatchCompute(w / 8, h / 8, 1);
+    // Whole groups only, until FillTexture.comp is rebuilt with its bounds check
+    renderer.DispatchCompute(width / 8, height / 8, 1);
     renderer.EndCompute();
-    renderer.ReleaseComputePipeline(computePipeline);
 }
 
 bool Scene09BasicCompute::Update(float dt) {
@@ -169,13 +157,18 @@ bool Scene09BasicCompute::Update(float dt) {
 }
 
 void Scene09BasicCompute::Draw(Renderer& renderer) {
+    // The texture follows the window size. It is refilled lazily, before the frame render pass.
+    int w, h;
+    SDL_GetWindowSizeInPixels(renderer.renderWindow, &w, &h);
+    if (w > 0 && h > 0 && (static_cast<Uint32>(w) != screenWidth || static_cast<Uint32>(h) != screenHeight)) {
+        CreateScreenTexture(renderer, static_cast<Uint32>(w), static_cast<Uint32>(h));
+    }
+
     renderer.Begin();
 
     renderer.BindGraphicsPipeline(graphicsPipeline);
-    SDL_GPUBufferBinding vertexBindings { .buffer = vertexBuffer, .offset = 0 };
-    renderer.BindVertexBuffers(0, vertexBindings, 1);
-    SDL_GPUBufferBinding indexBindings { .buffer = indexBuffer, .offset = 0 };
-    renderer.BindIndexBuffer(indexBindings, SDL_GPU_INDEXELEMENTSIZE_16BIT);
+    renderer.BindVertexBuffer(0, vertexAllocation);
+    renderer.BindIndexBuffer(indexAllocation, SDL_GPU_INDEXELEMENTSIZE_16BIT);
     renderer.BindFragmentSamplers(0, SDL_GPUTextureSamplerBinding { .texture = screenTexture, .sampler = sampler }, 1);
     renderer.DrawIndexedPrimitives(6, 1, 0, 0, 0);
 
@@ -183,9 +176,10 @@ void Scene09BasicCompute::Draw(Renderer& renderer) {
 }
 
 void Scene09BasicCompute::Unload(Renderer& renderer) {
-    renderer.ReleaseBuffer(vertexBuffer);
-    renderer.ReleaseBuffer(indexBuffer);
+    renderer.FreeBuffer(vertexAllocation);
+    renderer.FreeBuffer(indexAllocation);
     renderer.ReleaseSampler(sampler);
     renderer.ReleaseTexture(screenTexture);
+    renderer.ReleaseComputePipeline(computePipeline);
     renderer.ReleaseGraphicsPipeline(graphicsPipeline);
 }
\ No newline at end of file
@@ -7,6 +7,7 @@
 
 #include <SDL3/SDL_gpu.h>
 #include "Scene.hpp"
+#include "BufferAllocator.hpp"
 
 class Scene09BasicCompute : public Scene {
 public:
@@ -16,6 +17,9 @@ public:
     void Unload(Renderer& renderer) override;
 
 private:
+    // (Re)create the screen texture at the window size and fill it
+    void CreateScreenTexture(Renderer& renderer, Uint32 width, Uint32 height);
+
     InputState inputState;
     const char* basePath {nullptr};
     SDL_GPUShader* vertexShader {nullptr};
@@ -24,9 +28,11 @@ private:
 
     SDL_GPUComputePipeline* computePipeline {nullptr};
     SDL_GPUTexture* screenTexture {nullptr};
+    Uint32 screenWidth {0};
+    Uint32 screenHeight {0};
     SDL_GPUSampler* sampler {nullptr};
-    SDL_GPUBuffer* vertexBuffer {nullptr};
-    SDL_GPUBuffer* indexBuffer {nullptr};
+    BufferAllocation vertexAllocation;
+    BufferAllocation indexAllocation;
 };
 
 
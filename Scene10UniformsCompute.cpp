@@ -25,50 +25,91 @@ void Scene10UniformsCompute::Load(Renderer& renderer) {
     computePipeline = renderer.CreateComputePipelineFromShader(basePath, "GradientTexture.comp",
                                                                &computePipelineCreateInfo);
 
-    // Screen texture
-    SDL_GetWindowSizeInPixels(renderer.renderWindow, &w, &h);
-
-    gradientTexture = renderer.CreateTexture(SDL_GPUTextureCreateInfo {
-            .type = SDL_GPU_TEXTURETYPE_2D,
-            .format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM,
-            .usage = SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_WRITE | SDL_GPU_TEXTUREUSAGE_SAMPLER,
-            .width = static_cast<Uint32>(w),
-            .height = static_cast<Uint32>(h),
-            .layer_count_or_depth = 1,
-            .num_levels = 1,
-    });
+    // The gradient texture is a transient of the render graph, sized from the swapchain every frame
     gradientUniformValues.time = 0;
+    dynamicResolution.SetScaleRange(0.25f, 1.0f);
+
+    SDL_Log("Press Up/Down to increase/decrease the GPU load");
+    SDL_Log("Press Left/Right to disable/enable dynamic resolution");
 }
 
 bool Scene10UniformsCompute::Update(float dt) {
     const bool isRunning = ManageInput(inputState);
     gradientUniformValues.time += 0.01f;
 
+    if (inputState.IsPressed(DirectionalKey::Up)) {
+        loadFactor = SDL_min(loadFactor * 2, MAX_LOAD_FACTOR);
+        SDL_Log("Load factor: %u", loadFactor);
+    }
+    if (inputState.IsPressed(DirectionalKey::Down)) {
+        loadFactor = SDL_max(loadFactor / 2, 1u);
+        SDL_Log("Load factor: %u", loadFactor);
+    }
+    if (inputState.IsPressed(DirectionalKey::Left)) {
+        dynamicResolution.SetEnabled(false);
+        SDL_Log("Dynamic resolution disabled");
+    }
+    if (inputState.IsPressed(DirectionalKey::Right)) {
+        dynamicResolution.SetEnabled(true);
+        SDL_Log("Dynamic resolution enabled");
+    }
+
     return isRunning;
 }
 
 void Scene10UniformsCompute::Draw(Renderer& renderer) {
+    if (dynamicResolution.Update(renderer.GetLastFrameTime())) {
+        SDL_Log("Render scale: %.2f", dynamicResolution.GetScale());
+    }
 
-    renderer.AcquireCmdBufferAndSwapchainTexture(w, h);
+    renderer.AcquireCmdBufferAndSwapchainTexture();
 
     if (renderer.IsSwapchainTextureValid()) {
-        SDL_GPUStorageTextureReadWriteBinding storageTexture {
-                .texture = gradientTexture,
-                .cycle = true
-        };
-        renderer.BeginCompute(&storageTexture, 1, nullptr, 0);
-        renderer.BindComputePipeline(computePipeline);
-        renderer.PushComputeUniformData(0, &gradientUniformValues, sizeof(GradientUniforms));
-        renderer.DispatchCompute(w / 8, h / 8, 1);
-        renderer.EndCompute();
-
-        renderer.BlitSwapchainTexture(w, h, gradientTexture, w, h, SDL_GPU_FILTER_LINEAR);
+        // Render below the swapchain size, the blit upscales. Window resizes are picked up here too.
+        const Uint32 outputWidth = renderer.swapchainWidth;
+        const Uint32 outputHeight = renderer.swapchainHeight;
+        dynamicResolution.GetRenderSize(outputWidth, outputHeight, renderWidth, renderHeight);
+
+        RenderGraphTexture swapchain = graph.ImportTexture("Swapchain", renderer.swapchainTexture,
+                                                           RenderGraphTextureDescription { outputWidth, outputHeight });
+        RenderGraphTexture gradient = graph.CreateTexture("Gradient", RenderGraphTextureDescription {
+                .width = renderWidth,
+                .height = renderHeight,
+                .format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM,
+                .usage = SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_WRITE | SDL_GPU_TEXTUREUSAGE_SAMPLER,
+        });
+
+        graph.AddPass(RenderGraphPassDescription {
+                .name = "Gradient",
+                .type = RenderGraphPassType::Compute,
+                .textureWrites = { gradient },
+                .execute = [this](Renderer& renderer, const RenderGraph&) {
+                    renderer.BindComputePipeline(computePipeline);
+                    renderer.PushComputeUniformData(0, &gradientUniformValues, sizeof(GradientUniforms));
+                    for (Uint32 i = 0; i < loadFactor; ++i) {
+                        // Whole groups only, until GradientTexture.comp is rebuilt with its bounds check
+                        renderer.DispatchCompute(renderWidth / 8, renderHeight / 8, 1);
+                    }
+                }
+        });
+        graph.AddPass(RenderGraphPassDescription {
+                .name = "Upscale",
+                .type = RenderGraphPassType::Transfer,
+                .textureReads = { gradient },
+                .textureWrites = { swapchain },
+                .execute = [this, gradient, outputWidth, outputHeight](Renderer& renderer,
+                                                                       const RenderGraph& frameGraph) {
+                    renderer.BlitSwapchainTexture(renderWidth, renderHeight, frameGraph.GetTexture(gradient),
+                                                  outputWidth, outputHeight, SDL_GPU_FILTER_LINEAR);
+                }
+        });
+        graph.Execute(renderer);
     }
 
     renderer.SubmitCommandBuffer();
 }
 
 void Scene10UniformsCompute::Unload(Renderer& renderer) {
-    renderer.ReleaseTexture(gradientTexture);
+    graph.Release(renderer);
     renderer.ReleaseComputePipeline(computePipeline);
 }
\ No newline at end of file
@@ -7,6 +7,8 @@
 
 #include <SDL3/SDL_gpu.h>
 #include "Scene.hpp"
+#include "RenderGraph.hpp"
+#include "DynamicResolution.hpp"
 
 struct GradientUniforms
 {
@@ -27,8 +29,14 @@ private:
     const char* basePath {nullptr};
 
     SDL_GPUComputePipeline* computePipeline {nullptr};
-    SDL_GPUTexture* gradientTexture {nullptr};
-    int w, h;
+    RenderGraph graph;
+    DynamicResolution dynamicResolution;
+    // Times the gradient is computed per frame, to put the GPU under load
+    Uint32 loadFactor {1};
+    Uint32 renderWidth {0};
+    Uint32 renderHeight {0};
+
+    static constexpr Uint32 MAX_LOAD_FACTOR = 256;
 };
 
 
@@ -4,6 +4,8 @@
 
 #include "Scene11SpriteBatchCompute.hpp"
 #include "Renderer.hpp"
+#include "Random.hpp"
+#include "TaskScheduler.hpp"
 #include <SDL3/SDL.h>
 
 #include "PositionTextureVertex.hpp"
@@ -13,7 +15,6 @@ void Scene11SpriteBatchCompute::Load(Renderer& renderer) {
     vertexShader = renderer.LoadShader(basePath, "TexturedQuadColorWithMatrix.vert", 0, 1, 0, 0);
     fragmentShader = renderer.LoadShader(basePath, "TexturedQuadColor.frag", 1, 0, 0, 0);
     viewProj = Mat4::CreateOrthographicOffCenter(0, 640, 480, 0, 0, -1);
-    std::srand(0);
 
     // Create the pipelines
     // -- Graphics pipeline
@@ -70,6 +71,7 @@ void Scene11SpriteBatchCompute::Load(Renderer& renderer) {
             .num_readonly_storage_buffers = 1,
             .num_readwrite_storage_textures = 0,
             .num_readwrite_storage_buffers = 1,
+            .num_uniform_buffers = 1,
             .threadcount_x = 64,
             .threadcount_y = 1,
             .threadcount_z = 1,
@@ -216,20 +218,36 @@ void Scene11SpriteBatchCompute::Draw(Renderer& renderer) {
     auto dataPtr = static_cast<ComputeSpriteInstance *>(
             renderer.MapTransferBuffer(spriteComputeTransferBuffer, true)
     );
-    for (Uint32 i = 0; i < SPRITE_COUNT; i += 1)
-    {
-        dataPtr[i].x = (float)(std::rand() % 640);
-        dataPtr[i].y = (float)(std::rand() % 480);
-        dataPtr[i].z = 0;
-        dataPtr[i].w = 1;
-        dataPtr[i].rotation = ((float)std::rand())/(RAND_MAX/(SDL_PI_F * 2));
-        dataPtr[i].w = 32;
-        dataPtr[i].h = 32;
-        dataPtr[i].r = 1.0f;
-        dataPtr[i].g = 1.0f;
-        dataPtr[i].b = 1.0f;
-        dataPtr[i].a = 1.0f;
-    }
+    // Sprites are generated in parallel, by chunks of SPRITE_GRAIN_SIZE. Each chunk has its own random stream, so
+    // the sprites do not depend on the thread count. SPRITE_COUNT is a power of two multiple of the grain size,
+    // so the ranges of the parallel for are whole chunks.
+    const Uint64 frame = frameNumber++;
+    TaskScheduler::ParallelFor(SPRITE_COUNT, SPRITE_GRAIN_SIZE, [dataPtr, frame](Uint32 begin, Uint32 end) {
+        float xs[SPRITE_GRAIN_SIZE];
+        float ys[SPRITE_GRAIN_SIZE];
+        float rotations[SPRITE_GRAIN_SIZE];
+        for (Uint32 chunk = begin; chunk < end; chunk += SPRITE_GRAIN_SIZE) {
+            const Uint32 count = SDL_min(SPRITE_GRAIN_SIZE, end - chunk);
+            Random random { SPRITE_SEED, (frame * SPRITE_COUNT + chunk) / SPRITE_GRAIN_SIZE };
+            random.FillFloat(xs, count, 0, 640);
+            random.FillFloat(ys, count, 0, 480);
+            random.FillAngle(rotations, count);
+            for (Uint32 i = 0; i < count; i += 1)
+            {
+                ComputeSpriteInstance& sprite = dataPtr[chunk + i];
+                sprite.x = xs[i];
+                sprite.y = ys[i];
+                sprite.z = 0;
+                sprite.rotation = rotations[i];
+                sprite.w = 32;
+                sprite.h = 32;
+                sprite.r = 1.0f;
+                sprite.g = 1.0f;
+                sprite.b = 1.0f;
+                sprite.a = 1.0f;
+            }
+        }
+    });
     renderer.UnmapTransferBuffer(spriteComputeTransferBuffer);
     // -- Upload instance data
     renderer.BeginUploadToBuffer();
@@ -253,7 +271,7 @@ void Scene11SpriteBatchCompute::Draw(Renderer& renderer) {
     renderer.BeginCompute(nullptr, 0, &bufferBinding, 1);
     renderer.BindComputePipeline(computePipeline);
     renderer.BindComputeStorageBuffers(0, spriteComputeBuffer, 1);
-    renderer.DispatchCompute(SPRITE_COUNT / 64, 1, 1);
+    renderer.DispatchComputeForSize(SPRITE_COUNT, 1, 1, 0);
     renderer.EndCompute();
 
     // Passes cannot be mingled, so we need to end the compute pass before starting the graphics pass
@@ -8,23 +8,13 @@
 #include <SDL3/SDL_gpu.h>
 #include "Scene.hpp"
 #include "Mat4.hpp"
-
-struct PositionTextureColorVertex
-{
-    float x, y, z, w;
-    float u, v, padding_a, padding_b;
-    float r, g, b, a;
-};
-
-struct ComputeSpriteInstance
-{
-    float x, y, z;
-    float rotation;
-    float w, h, padding_a, padding_b;
-    float r, g, b, a;
-};
+#include "PositionTextureVertex.hpp"
 
 const Uint32 SPRITE_COUNT = 8192;
+// Sprites generated per task
+const Uint32 SPRITE_GRAIN_SIZE = 512;
+// Same sprites on every run
+const Uint64 SPRITE_SEED = 0;
 
 class Scene11SpriteBatchCompute : public Scene {
 public:
@@ -49,6 +39,7 @@ private:
     SDL_GPUBuffer* vertexBuffer {nullptr};
     SDL_GPUBuffer* indexBuffer {nullptr};
     SDL_GPUTransferBuffer* spriteComputeTransferBuffer {nullptr};
+    Uint64 frameNumber {0};
 };
 
 
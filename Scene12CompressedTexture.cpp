@@ -0,0 +1,209 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#include "Scene12CompressedTexture.hpp"
+#include "Renderer.hpp"
+#include "PositionTextureVertex.hpp"
+#include "AssetPackage.hpp"
+#include <SDL3/SDL.h>
+
+void Scene12CompressedTexture::Load(Renderer& renderer) {
+    basePath = SDL_GetBasePath();
+    vertexShader = renderer.LoadShader(basePath, "TexturedQuad.vert", 0, 0, 0, 0);
+    fragmentShader = renderer.LoadShader(basePath, "TexturedQuad.frag", 1, 0, 0, 0);
+
+    // Create the pipeline
+    SDL_GPUGraphicsPipelineCreateInfo pipelineCreateInfo = {
+        .vertex_shader = vertexShader,
+        .fragment_shader = fragmentShader,
+        // This is set up to match the vertex shader layout!
+        .vertex_input_state = SDL_GPUVertexInputState {
+            .vertex_buffer_descriptions = new SDL_GPUVertexBufferDescription[1] {{
+                .slot = 0,
+                .pitch = sizeof(PositionTextureVertex),
+                .input_rate = SDL_GPU_VERTEXINPUTRATE_VERTEX,
+                .instance_step_rate = 0,
+            }},
+            .num_vertex_buffers = 1,
+            .vertex_attributes = new SDL_GPUVertexAttribute[2] {{
+                .location = 0,
+                .buffer_slot = 0,
+                .format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT3,
+                .offset = 0
+            }, {
+                .location = 1,
+                .buffer_slot = 0,
+                .format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT2,
+                .offset = sizeof(float) * 3
+            }},
+            .num_vertex_attributes = 2,
+        },
+        .primitive_type = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST,
+        .target_info = {
+            .color_target_descriptions = new SDL_GPUColorTargetDescription[1] {{
+               .format = SDL_GetGPUSwapchainTextureFormat(renderer.device, renderer.renderWindow)
+            }},
+            .num_color_targets = 1,
+        },
+    };
+    pipeline = renderer.CreateGPUGraphicsPipeline(pipelineCreateInfo);
+
+    // Clean up shader resources
+    renderer.ReleaseShader(vertexShader);
+    renderer.ReleaseShader(fragmentShader);
+
+    sampler = renderer.CreateSampler(SDL_GPUSamplerCreateInfo {
+        .min_filter = SDL_GPU_FILTER_LINEAR,
+        .mag_filter = SDL_GPU_FILTER_LINEAR,
+        .mipmap_mode = SDL_GPU_SAMPLERMIPMAPMODE_LINEAR,
+        .address_mode_u = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
+        .address_mode_v = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
+        .address_mode_w = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
+    });
+
+    // Compressed textures: native upload when supported, CPU decode otherwise.
+    // The cooked package is used when it exists (cook-assets target), else the .astc files are loaded.
+    char packagePath[256];
+    SDL_snprintf(packagePath, sizeof(packagePath), "%sContent/Assets.pak", basePath);
+    AssetPackage package;
+    const bool hasPackage = package.Open(packagePath);
+    for (size_t i = 0; i < textures.size(); ++i) {
+        if (hasPackage) {
+            textures[i] = renderer.CreateTextureFromPackage(package, textureNames[i].c_str());
+            const AssetEntry* entry = package.Find(textureNames[i].c_str());
+            isTextureNative[i] = entry != nullptr && renderer.DoesTextureSupportFormat(
+                    static_cast<SDL_GPUTextureFormat>(entry->format), SDL_GPU_TEXTURETYPE_2D,
+                    SDL_GPU_TEXTUREUSAGE_SAMPLER);
+        } else {
+            textures[i] = renderer.LoadCompressedTexture(basePath, textureNames[i].c_str(), &isTextureNative[i]);
+        }
+        if (textures[i] == nullptr) {
+            SDL_Log("Could not load texture %s!", textureNames[i].c_str());
+        }
+    }
+    package.Close();
+
+    // Create the vertex buffer
+    SDL_GPUBufferCreateInfo vertexBufferCreateInfo = {
+        .usage = SDL_GPU_BUFFERUSAGE_VERTEX,
+        .size = sizeof(PositionTextureVertex) * 4
+    };
+    vertexBuffer = renderer.CreateBuffer(vertexBufferCreateInfo);
+    renderer.SetBufferName(vertexBuffer, "Compressed Texture Vertex Buffer");
+
+    // Create the index buffer
+    SDL_GPUBufferCreateInfo indexBufferCreateInfo = {
+        .usage = SDL_GPU_BUFFERUSAGE_INDEX,
+        .size = sizeof(Uint16) * 6
+    };
+    indexBuffer = renderer.CreateBuffer(indexBufferCreateInfo);
+
+    // Set the transfer buffer
+    SDL_GPUTransferBufferCreateInfo transferBufferCreateInfo = {
+        .usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+        .size = (sizeof(PositionTextureVertex) * 4) + (sizeof(Uint16) * 6),
+    };
+    SDL_GPUTransferBuffer* transferBuffer = renderer.CreateTransferBuffer(transferBufferCreateInfo);
+
+    auto transferData = static_cast<PositionTextureVertex *>(
+        renderer.MapTransferBuffer(transferBuffer, false)
+    );
+    transferData[0] = PositionTextureVertex { -1,  1, 0, 0, 0 };
+    transferData[1] = PositionTextureVertex {  1,  1, 0, 1, 0 };
+    transferData[2] = PositionTextureVertex {  1, -1, 0, 1, 1 };
+    transferData[3] = PositionTextureVertex { -1, -1, 0, 0, 1 };
+    auto indexData = reinterpret_cast<Uint16*>(&transferData[4]);
+    indexData[0] = 0;
+    indexData[1] = 1;
+    indexData[2] = 2;
+    indexData[3] = 0;
+    indexData[4] = 2;
+    indexData[5] = 3;
+    renderer.UnmapTransferBuffer(transferBuffer);
+
+    renderer.BeginUploadToBuffer();
+    SDL_GPUTransferBufferLocation transferVertexBufferLocation {
+        .transfer_buffer = transferBuffer,
+        .offset = 0
+    };
+    SDL_GPUBufferRegion vertexBufferRegion {
+        .buffer = vertexBuffer,
+        .offset = 0,
+        .size = sizeof(PositionTextureVertex) * 4
+    };
+    SDL_GPUTransferBufferLocation transferIndexBufferLocation {
+        .transfer_buffer = transferBuffer,
+        .offset = sizeof(PositionTextureVertex) * 4
+    };
+    SDL_GPUBufferRegion indexBufferRegion {
+        .buffer = indexBuffer,
+        .offset = 0,
+        .size = sizeof(Uint16) * 6
+    };
+    renderer.UploadToBuffer(transferVertexBufferLocation, vertexBufferRegion, false);
+    renderer.UploadToBuffer(transferIndexBufferLocation, indexBufferRegion, false);
+    renderer.EndUploadToBuffer(transferBuffer);
+
+    // Finally, print instructions!
+    SDL_Log("Press Left/Right to switch between ASTC block sizes");
+    LogCurrentTexture();
+}
+
+bool Scene12CompressedTexture::Update(float dt) {
+    const bool isRunning = ManageInput(inputState);
+
+    if (inputState.IsPressed(DirectionalKey::Left)) {
+        currentTextureIndex -= 1;
+        if (currentTextureIndex < 0) {
+            currentTextureIndex = textures.size() - 1;
+        }
+        LogCurrentTexture();
+    }
+
+    if (inputState.IsPressed(DirectionalKey::Right)) {
+        currentTextureIndex = (currentTextureIndex + 1) % textures.size();
+        LogCurrentTexture();
+    }
+
+    return isRunning;
+}
+
+void Scene12CompressedTexture::Draw(Renderer& renderer) {
+    renderer.Begin();
+
+    if (textures[currentTextureIndex] != nullptr) {
+        renderer.BindGraphicsPipeline(pipeline);
+        SDL_GPUBufferBinding vertexBindings { .buffer = vertexBuffer, .offset = 0 };
+        renderer.BindVertexBuffers(0, vertexBindings, 1);
+        SDL_GPUBufferBinding indexBindings { .buffer = indexBuffer, .offset = 0 };
+        renderer.BindIndexBuffer(indexBindings, SDL_GPU_INDEXELEMENTSIZE_16BIT);
+
+        SDL_GPUTextureSamplerBinding textureSamplerBinding {
+            .texture = textures[currentTextureIndex],
+            .sampler = sampler
+        };
+        renderer.BindFragmentSamplers(0, textureSamplerBinding, 1);
+
+        renderer.DrawIndexedPrimitives(6, 1, 0, 0, 0);
+    }
+
+    renderer.End();
+}
+
+void Scene12CompressedTexture::Unload(Renderer& renderer) {
+    for (SDL_GPUTexture* texture : textures) {
+        if (texture != nullptr) { renderer.ReleaseTexture(texture); }
+    }
+    textures = {};
+    currentTextureIndex = 0;
+    renderer.ReleaseSampler(sampler);
+    renderer.ReleaseBuffer(vertexBuffer);
+    renderer.ReleaseBuffer(indexBuffer);
+    renderer.ReleaseGraphicsPipeline(pipeline);
+}
+
+void Scene12CompressedTexture::LogCurrentTexture() const {
+    SDL_Log("Texture: %s (%s)", textureNames[currentTextureIndex].c_str(),
+            isTextureNative[currentTextureIndex] ? "native ASTC" : "decoded to RGBA8 on the CPU");
+}
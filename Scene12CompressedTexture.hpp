@@ -0,0 +1,57 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef SCENE12COMPRESSEDTEXTURE_HPP
+#define SCENE12COMPRESSEDTEXTURE_HPP
+
+#include <SDL3/SDL_gpu.h>
+#include "Scene.hpp"
+#include <array>
+#include <string>
+
+using std::array;
+using std::string;
+
+class Scene12CompressedTexture : public Scene {
+public:
+    void Load(Renderer& renderer) override;
+    bool Update(float dt) override;
+    void Draw(Renderer& renderer) override;
+    void Unload(Renderer& renderer) override;
+
+private:
+    array<string, 14> textureNames {
+        "astc/4x4.astc",
+        "astc/5x4.astc",
+        "astc/5x5.astc",
+        "astc/6x5.astc",
+        "astc/6x6.astc",
+        "astc/8x5.astc",
+        "astc/8x6.astc",
+        "astc/8x8.astc",
+        "astc/10x5.astc",
+        "astc/10x6.astc",
+        "astc/10x8.astc",
+        "astc/10x10.astc",
+        "astc/12x10.astc",
+        "astc/12x12.astc"
+    };
+
+    InputState inputState;
+    const char* basePath {nullptr};
+    SDL_GPUShader* vertexShader {nullptr};
+    SDL_GPUShader* fragmentShader {nullptr};
+
+    SDL_GPUGraphicsPipeline* pipeline {nullptr};
+    SDL_GPUBuffer* vertexBuffer {nullptr};
+    SDL_GPUBuffer* indexBuffer {nullptr};
+    array<SDL_GPUTexture*, 14> textures {};
+    array<bool, 14> isTextureNative {};
+    SDL_GPUSampler* sampler {nullptr};
+    int currentTextureIndex {0};
+
+    void LogCurrentTexture() const;
+};
+
+#endif //SCENE12COMPRESSEDTEXTURE_HPP
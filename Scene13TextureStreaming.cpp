@@ -0,0 +1,197 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#include "Scene13TextureStreaming.hpp"
+#include "Renderer.hpp"
+#include "PositionTextureVertex.hpp"
+#include "TextureCompression.hpp"
+#include "MipChain.hpp"
+#include "Mat4.hpp"
+#include <SDL3/SDL.h>
+
+void Scene13TextureStreaming::Load(Renderer& renderer) {
+    basePath = SDL_GetBasePath();
+    vertexShader = renderer.LoadShader(basePath, "TexturedQuadWithMatrix.vert", 0, 1, 0, 0);
+    fragmentShader = renderer.LoadShader(basePath, "TexturedQuad.frag", 1, 0, 0, 0);
+
+    // Create the pipeline
+    SDL_GPUGraphicsPipelineCreateInfo pipelineCreateInfo = {
+        .vertex_shader = vertexShader,
+        .fragment_shader = fragmentShader,
+        // This is set up to match the vertex shader layout!
+        .vertex_input_state = SDL_GPUVertexInputState {
+            .vertex_buffer_descriptions = new SDL_GPUVertexBufferDescription[1] {{
+                .slot = 0,
+                .pitch = sizeof(PositionTextureVertex),
+                .input_rate = SDL_GPU_VERTEXINPUTRATE_VERTEX,
+                .instance_step_rate = 0,
+            }},
+            .num_vertex_buffers = 1,
+            .vertex_attributes = new SDL_GPUVertexAttribute[2] {{
+                .location = 0,
+                .buffer_slot = 0,
+                .format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT3,
+                .offset = 0
+            }, {
+                .location = 1,
+                .buffer_slot = 0,
+                .format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT2,
+                .offset = sizeof(float) * 3
+            }},
+            .num_vertex_attributes = 2,
+        },
+        .primitive_type = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST,
+        .target_info = {
+            .color_target_descriptions = new SDL_GPUColorTargetDescription[1] {{
+               .format = SDL_GetGPUSwapchainTextureFormat(renderer.device, renderer.renderWindow)
+            }},
+            .num_color_targets = 1,
+        },
+    };
+    pipeline = renderer.CreateGPUGraphicsPipeline(pipelineCreateInfo);
+
+    // Clean up shader resources
+    renderer.ReleaseShader(vertexShader);
+    renderer.ReleaseShader(fragmentShader);
+
+    // Create the vertex buffer
+    SDL_GPUBufferCreateInfo vertexBufferCreateInfo = {
+        .usage = SDL_GPU_BUFFERUSAGE_VERTEX,
+        .size = sizeof(PositionTextureVertex) * 4
+    };
+    vertexBuffer = renderer.CreateBuffer(vertexBufferCreateInfo);
+    renderer.SetBufferName(vertexBuffer, "Streamed Quad Vertex Buffer");
+
+    // Create the index buffer
+    SDL_GPUBufferCreateInfo indexBufferCreateInfo = {
+        .usage = SDL_GPU_BUFFERUSAGE_INDEX,
+        .size = sizeof(Uint16) * 6
+    };
+    indexBuffer = renderer.CreateBuffer(indexBufferCreateInfo);
+
+    // Set the transfer buffer
+    SDL_GPUTransferBufferCreateInfo transferBufferCreateInfo = {
+        .usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+        .size = (sizeof(PositionTextureVertex) * 4) + (sizeof(Uint16) * 6),
+    };
+    SDL_GPUTransferBuffer* transferBuffer = renderer.CreateTransferBuffer(transferBufferCreateInfo);
+
+    auto transferData = static_cast<PositionTextureVertex *>(
+        renderer.MapTransferBuffer(transferBuffer, false)
+    );
+    transferData[0] = PositionTextureVertex { -0.5f,  0.5f, 0, 0, 0 };
+    transferData[1] = PositionTextureVertex {  0.5f,  0.5f, 0, 1, 0 };
+    transferData[2] = PositionTextureVertex {  0.5f, -0.5f, 0, 1, 1 };
+    transferData[3] = PositionTextureVertex { -0.5f, -0.5f, 0, 0, 1 };
+    auto indexData = reinterpret_cast<Uint16*>(&transferData[4]);
+    indexData[0] = 0;
+    indexData[1] = 1;
+    indexData[2] = 2;
+    indexData[3] = 0;
+    indexData[4] = 2;
+    indexData[5] = 3;
+    renderer.UnmapTransferBuffer(transferBuffer);
+
+    renderer.BeginUploadToBuffer();
+    SDL_GPUTransferBufferLocation transferVertexBufferLocation {
+        .transfer_buffer = transferBuffer,
+        .offset = 0
+    };
+    SDL_GPUBufferRegion vertexBufferRegion {
+        .buffer = vertexBuffer,
+        .offset = 0,
+        .size = sizeof(PositionTextureVertex) * 4
+    };
+    SDL_GPUTransferBufferLocation transferIndexBufferLocation {
+        .transfer_buffer = transferBuffer,
+        .offset = sizeof(PositionTextureVertex) * 4
+    };
+    SDL_GPUBufferRegion indexBufferRegion {
+        .buffer = indexBuffer,
+        .offset = 0,
+        .size = sizeof(Uint16) * 6
+    };
+    renderer.UploadToBuffer(transferVertexBufferLocation, vertexBufferRegion, false);
+    renderer.UploadToBuffer(transferIndexBufferLocation, indexBufferRegion, false);
+    renderer.EndUploadToBuffer(transferBuffer);
+
+    StartStreaming(renderer);
+
+    // Finally, print instructions!
+    SDL_Log("Press Up to stream the texture again");
+}
+
+void Scene13TextureStreaming::StartStreaming(Renderer& renderer) {
+    // The mip chain is built on the CPU from a decoded image, then streamed from the coarsest level
+    char fullPath[256];
+    SDL_snprintf(fullPath, sizeof(fullPath), "%sContent/Images/astc/4x4.astc", basePath);
+    CompressedImage image;
+    vector<Uint8> pixels;
+    if (!TextureCompression::LoadASTC(fullPath, image) || !TextureCompression::DecodeToRGBA8(image, pixels)) {
+        SDL_Log("Could not load image data!");
+        return;
+    }
+    vector<MipLevel> levels;
+    MipChain::Build(pixels.data(), image.width, image.height, levels);
+
+    streamer.Load(renderer, std::move(levels), "Streamed Texture", INITIAL_UPLOAD_BUDGET);
+    timeSinceLastUpload = 0;
+    SDL_Log("Finest resident mip level: %u", streamer.GetFinestResidentLevel());
+}
+
+bool Scene13TextureStreaming::Update(float dt) {
+    const bool isRunning = ManageInput(inputState);
+    time += dt;
+    timeSinceLastUpload += dt;
+
+    if (inputState.IsPressed(DirectionalKey::Up)) {
+        isRestartRequested = true;
+    }
+
+    return isRunning;
+}
+
+void Scene13TextureStreaming::Draw(Renderer& renderer) {
+    // Uploads must happen outside of the render pass
+    if (isRestartRequested) {
+        streamer.Unload(renderer);
+        StartStreaming(renderer);
+        isRestartRequested = false;
+    } else if (!streamer.IsComplete() && timeSinceLastUpload >= UPLOAD_INTERVAL) {
+        streamer.Update(renderer, FRAME_UPLOAD_BUDGET);
+        timeSinceLastUpload = 0;
+        SDL_Log("Finest resident mip level: %u", streamer.GetFinestResidentLevel());
+    }
+
+    renderer.Begin();
+
+    SDL_GPUTexture* texture = renderer.GetTexture(streamer.GetTexture());
+    if (texture != nullptr) {
+        renderer.BindGraphicsPipeline(pipeline);
+        SDL_GPUBufferBinding vertexBindings { .buffer = vertexBuffer, .offset = 0 };
+        renderer.BindVertexBuffers(0, vertexBindings, 1);
+        SDL_GPUBufferBinding indexBindings { .buffer = indexBuffer, .offset = 0 };
+        renderer.BindIndexBuffer(indexBindings, SDL_GPU_INDEXELEMENTSIZE_16BIT);
+        SDL_GPUTextureSamplerBinding textureSamplerBinding {
+            .texture = texture,
+            .sampler = streamer.GetSampler()
+        };
+        renderer.BindFragmentSamplers(0, textureSamplerBinding, 1);
+
+        // The quad shrinks and grows so that every mip level gets sampled
+        const float scale = 0.1f + 0.9f * (0.5f + 0.5f * SDL_sinf(time * 0.5f));
+        Mat4 matrixUniform = Mat4::CreateScale(scale * 2.0f, scale * 2.0f, 1.0f);
+        renderer.PushVertexUniformData(0, &matrixUniform, sizeof(matrixUniform));
+        renderer.DrawIndexedPrimitives(6, 1, 0, 0, 0);
+    }
+
+    renderer.End();
+}
+
+void Scene13TextureStreaming::Unload(Renderer& renderer) {
+    streamer.Unload(renderer);
+    renderer.ReleaseBuffer(vertexBuffer);
+    renderer.ReleaseBuffer(indexBuffer);
+    renderer.ReleaseGraphicsPipeline(pipeline);
+}
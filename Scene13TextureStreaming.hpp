@@ -0,0 +1,41 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef SCENE13TEXTURESTREAMING_HPP
+#define SCENE13TEXTURESTREAMING_HPP
+
+#include <SDL3/SDL_gpu.h>
+#include "Scene.hpp"
+#include "TextureStreamer.hpp"
+
+class Scene13TextureStreaming : public Scene {
+public:
+    void Load(Renderer& renderer) override;
+    bool Update(float dt) override;
+    void Draw(Renderer& renderer) override;
+    void Unload(Renderer& renderer) override;
+
+private:
+    void StartStreaming(Renderer& renderer);
+
+    InputState inputState;
+    const char* basePath {nullptr};
+    SDL_GPUShader* vertexShader {nullptr};
+    SDL_GPUShader* fragmentShader {nullptr};
+
+    SDL_GPUGraphicsPipeline* pipeline {nullptr};
+    SDL_GPUBuffer* vertexBuffer {nullptr};
+    SDL_GPUBuffer* indexBuffer {nullptr};
+    TextureStreamer streamer;
+    float time {0};
+    float timeSinceLastUpload {0};
+    bool isRestartRequested {false};
+
+    // Upload budgets, small enough to see the texture refine level after level
+    static constexpr Uint32 INITIAL_UPLOAD_BUDGET = 1024;
+    static constexpr Uint32 FRAME_UPLOAD_BUDGET = 16 * 1024;
+    static constexpr float UPLOAD_INTERVAL = 0.5f;
+};
+
+#endif //SCENE13TEXTURESTREAMING_HPP
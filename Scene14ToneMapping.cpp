@@ -0,0 +1,190 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#include "Scene14ToneMapping.hpp"
+#include "Renderer.hpp"
+#include "HDRImage.hpp"
+#include <SDL3/SDL.h>
+
+void Scene14ToneMapping::Load(Renderer& renderer) {
+    basePath = SDL_GetBasePath();
+    vertexShader = renderer.LoadShader(basePath, "Fullscreen.vert", 0, 0, 0, 0);
+    fragmentShader = renderer.LoadShader(basePath, "TexturedQuad.frag", 1, 0, 0, 0);
+
+    // The image is drawn with a fullscreen triangle into the float16 target
+    SDL_GPUGraphicsPipelineCreateInfo pipelineCreateInfo = {
+        .vertex_shader = vertexShader,
+        .fragment_shader = fragmentShader,
+        .primitive_type = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST,
+        .target_info = {
+            .color_target_descriptions = new SDL_GPUColorTargetDescription[1] {{
+                .format = ToneMapper::HDR_FORMAT
+            }},
+            .num_color_targets = 1,
+        },
+    };
+    pipeline = renderer.CreateGPUGraphicsPipeline(pipelineCreateInfo);
+
+    renderer.ReleaseShader(vertexShader);
+    renderer.ReleaseShader(fragmentShader);
+
+    // Load the image, stored as float16
+    char fullPath[256];
+    SDL_snprintf(fullPath, sizeof(fullPath), "%sContent/Images/memorial.hdr", basePath);
+    HDRImage image;
+    if (!HDRImageLoader::Load(fullPath, image)) {
+        SDL_Log("Could not load image data!");
+        return;
+    }
+    imageWidth = image.width;
+    imageHeight = image.height;
+
+    hdrImage = renderer.CreateTexture(SDL_GPUTextureCreateInfo {
+        .type = SDL_GPU_TEXTURETYPE_2D,
+        .format = SDL_GPU_TEXTUREFORMAT_R16G16B16A16_FLOAT,
+        .usage = SDL_GPU_TEXTUREUSAGE_SAMPLER,
+        .width = image.width,
+        .height = image.height,
+        .layer_count_or_depth = 1,
+        .num_levels = 1,
+    });
+    renderer.SetTextureName(hdrImage, "memorial.hdr");
+
+    const Uint32 imageSize = image.width * image.height * 4 * sizeof(Uint16);
+    SDL_GPUTransferBuffer* transferBuffer = renderer.CreateTransferBuffer(SDL_GPUTransferBufferCreateInfo {
+        .usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+        .size = imageSize
+    });
+    auto transferData = static_cast<Uint16*>(renderer.MapTransferBuffer(transferBuffer, false));
+    HDRImageLoader::ToHalf(image.pixels.data(), image.pixels.size(), transferData);
+    renderer.UnmapTransferBuffer(transferBuffer);
+
+    renderer.BeginUploadToBuffer();
+    SDL_GPUTextureTransferInfo textureBufferLocation {
+        .transfer_buffer = transferBuffer,
+        .offset = 0
+    };
+    SDL_GPUTextureRegion textureBufferRegion {
+        .texture = hdrImage,
+        .w = image.width,
+        .h = image.height,
+        .d = 1
+    };
+    renderer.UploadToTexture(textureBufferLocation, textureBufferRegion, false);
+    renderer.EndUploadToBuffer(transferBuffer);
+
+    sampler = renderer.CreateSampler(SDL_GPUSamplerCreateInfo {
+        .min_filter = SDL_GPU_FILTER_LINEAR,
+        .mag_filter = SDL_GPU_FILTER_LINEAR,
+        .mipmap_mode = SDL_GPU_SAMPLERMIPMAPMODE_NEAREST,
+        .address_mode_u = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
+        .address_mode_v = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
+        .address_mode_w = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
+    });
+
+    toneMapper.Load(renderer, basePath);
+
+    // Use HDR10 output when the display can show it
+    if (renderer.SetSwapchainComposition(SDL_GPU_SWAPCHAINCOMPOSITION_HDR10_ST2084)) {
+        transferFunction = TransferFunction::ST2084;
+    }
+
+    // The fused dispatch saves the float16 intermediate image write and read back. tone-map-benchmark measures both.
+    const Uint32 resolutions[2][2] = { { 1920, 1080 }, { 3840, 2160 } };
+    for (const auto& resolution : resolutions) {
+        SDL_Log("Estimated tone map traffic per frame at %ux%u: %.1f MB in two passes, %.1f MB fused",
+                resolution[0], resolution[1],
+                ToneMapping::EstimateMemoryTraffic(resolution[0], resolution[1], false) / (1024.0 * 1024.0),
+                ToneMapping::EstimateMemoryTraffic(resolution[0], resolution[1], true) / (1024.0 * 1024.0));
+    }
+
+    // Finally, print instructions!
+    SDL_Log("Press Left/Right to switch between tone map operators");
+    SDL_Log("Press Up/Down to change the exposure");
+    LogSettings();
+}
+
+void Scene14ToneMapping::LogSettings() const {
+    SDL_Log("Operator: %s, transfer: %s, exposure: %.2f",
+            ToneMapping::GetOperatorName(toneMapOperator),
+            ToneMapping::GetTransferFunctionName(transferFunction),
+            exposure);
+}
+
+bool Scene14ToneMapping::Update(float dt) {
+    const bool isRunning = ManageInput(inputState);
+    const int operatorCount = static_cast<int>(ToneMapOperator::Count);
+
+    if (inputState.IsPressed(DirectionalKey::Left)) {
+        toneMapOperator = static_cast<ToneMapOperator>(
+                (static_cast<int>(toneMapOperator) + operatorCount - 1) % operatorCount);
+        LogSettings();
+    }
+    if (inputState.IsPressed(DirectionalKey::Right)) {
+        toneMapOperator = static_cast<ToneMapOperator>((static_cast<int>(toneMapOperator) + 1) % operatorCount);
+        LogSettings();
+    }
+    if (inputState.IsPressed(DirectionalKey::Up)) {
+        exposure *= 1.5f;
+        LogSettings();
+    }
+    if (inputState.IsPressed(DirectionalKey::Down)) {
+        exposure /= 1.5f;
+        LogSettings();
+    }
+
+    return isRunning;
+}
+
+void Scene14ToneMapping::Draw(Renderer& renderer) {
+    renderer.AcquireCmdBufferAndSwapchainTexture();
+    const Uint32 w = renderer.swapchainWidth;
+    const Uint32 h = renderer.swapchainHeight;
+
+    if (renderer.IsSwapchainTextureValid() && hdrImage != nullptr) {
+        // Intermediate textures are renderer sized targets, they follow the window size
+        toneMapper.SetSize(w, h);
+
+        SDL_GPUColorTargetInfo colorTargetInfo {
+            .texture = toneMapper.GetHDRTarget(renderer),
+            .clear_color = SDL_FColor { 0.0f, 0.0f, 0.0f, 1.0f },
+            .load_op = SDL_GPU_LOADOP_CLEAR,
+            .store_op = SDL_GPU_STOREOP_STORE,
+            .cycle = true
+        };
+        renderer.BeginRenderPass(colorTargetInfo);
+
+        // Keep the image aspect ratio
+        const float scale = SDL_min(static_cast<float>(w) / imageWidth, static_cast<float>(h) / imageHeight);
+        const float viewportWidth = imageWidth * scale;
+        const float viewportHeight = imageHeight * scale;
+        renderer.SetViewport(SDL_GPUViewport {
+            .x = (w - viewportWidth) * 0.5f,
+            .y = (h - viewportHeight) * 0.5f,
+            .w = viewportWidth,
+            .h = viewportHeight,
+            .min_depth = 0.0f,
+            .max_depth = 1.0f
+        });
+
+        renderer.BindGraphicsPipeline(pipeline);
+        renderer.BindFragmentSamplers(0, SDL_GPUTextureSamplerBinding { .texture = hdrImage, .sampler = sampler }, 1);
+        renderer.DrawPrimitives(3, 1, 0, 0);
+        renderer.EndRenderPass();
+
+        // Exposure, tone map and transfer in one dispatch
+        SDL_GPUTexture* output = toneMapper.ApplyFused(renderer, toneMapOperator, transferFunction, exposure);
+        renderer.BlitSwapchainTexture(w, h, output, w, h, SDL_GPU_FILTER_NEAREST);
+    }
+
+    renderer.SubmitCommandBuffer();
+}
+
+void Scene14ToneMapping::Unload(Renderer& renderer) {
+    toneMapper.Unload(renderer);
+    renderer.ReleaseTexture(hdrImage);
+    renderer.ReleaseSampler(sampler);
+    renderer.ReleaseGraphicsPipeline(pipeline);
+    renderer.SetSwapchainComposition(SDL_GPU_SWAPCHAINCOMPOSITION_SDR);
+}
@@ -0,0 +1,39 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef SCENE14TONEMAPPING_HPP
+#define SCENE14TONEMAPPING_HPP
+
+#include <SDL3/SDL_gpu.h>
+#include "Scene.hpp"
+#include "ToneMapper.hpp"
+
+class Scene14ToneMapping : public Scene {
+public:
+    void Load(Renderer& renderer) override;
+    bool Update(float dt) override;
+    void Draw(Renderer& renderer) override;
+    void Unload(Renderer& renderer) override;
+
+private:
+    void LogSettings() const;
+
+    InputState inputState;
+    const char* basePath {nullptr};
+    SDL_GPUShader* vertexShader {nullptr};
+    SDL_GPUShader* fragmentShader {nullptr};
+
+    SDL_GPUGraphicsPipeline* pipeline {nullptr};
+    SDL_GPUTexture* hdrImage {nullptr};
+    SDL_GPUSampler* sampler {nullptr};
+    Uint32 imageWidth {0};
+    Uint32 imageHeight {0};
+
+    ToneMapper toneMapper;
+    ToneMapOperator toneMapOperator {ToneMapOperator::ACES};
+    TransferFunction transferFunction {TransferFunction::SRGB};
+    float exposure {1.0f};
+};
+
+#endif //SCENE14TONEMAPPING_HPP
@@ -0,0 +1,248 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#include "Scene15InstancedQuads.hpp"
+#include "Renderer.hpp"
+#include "PositionTextureVertex.hpp"
+#include "FrustumCulling.hpp"
+#include "TaskScheduler.hpp"
+#include <SDL3/SDL.h>
+
+void Scene15InstancedQuads::Load(Renderer& renderer) {
+    basePath = SDL_GetBasePath();
+    // One storage buffer and one uniform buffer in the vertex shader
+    vertexShader = renderer.LoadShader(basePath, "InstancedTransform.vert", 0, 1, 1, 0);
+    fragmentShader = renderer.LoadShader(basePath, "TexturedQuadColor.frag", 1, 0, 0, 0);
+
+    // Create the pipeline. Vertices only hold the quad, the instance data comes from the storage buffer.
+    SDL_GPUGraphicsPipelineCreateInfo pipelineCreateInfo = {
+        .vertex_shader = vertexShader,
+        .fragment_shader = fragmentShader,
+        .vertex_input_state = SDL_GPUVertexInputState {
+            .vertex_buffer_descriptions = new SDL_GPUVertexBufferDescription[1] {{
+                .slot = 0,
+                .pitch = sizeof(PositionTextureVertex),
+                .input_rate = SDL_GPU_VERTEXINPUTRATE_VERTEX,
+                .instance_step_rate = 0,
+            }},
+            .num_vertex_buffers = 1,
+            .vertex_attributes = new SDL_GPUVertexAttribute[2] {{
+                .location = 0,
+                .buffer_slot = 0,
+                .format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT3,
+                .offset = 0
+            }, {
+                .location = 1,
+                .buffer_slot = 0,
+                .format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT2,
+                .offset = sizeof(float) * 3
+            }},
+            .num_vertex_attributes = 2,
+        },
+        .primitive_type = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST,
+        .target_info = {
+            .color_target_descriptions = new SDL_GPUColorTargetDescription[1] {{
+                .format = SDL_GetGPUSwapchainTextureFormat(renderer.device, renderer.renderWindow)
+            }},
+            .num_color_targets = 1,
+        },
+    };
+    pipeline = renderer.CreateGPUGraphicsPipeline(pipelineCreateInfo);
+    renderer.ReleaseShader(vertexShader);
+
+    // Same pipeline, reading the instances through the visible list written by the culling pass
+    vertexShader = renderer.LoadShader(basePath, "InstancedCulled.vert", 0, 1, 2, 0);
+    pipelineCreateInfo.vertex_shader = vertexShader;
+    culledPipeline = renderer.CreateGPUGraphicsPipeline(pipelineCreateInfo);
+
+    renderer.ReleaseShader(vertexShader);
+    renderer.ReleaseShader(fragmentShader);
+
+    // Texture
+    SDL_Surface* imageData = renderer.LoadBMPImage(basePath, "ravioli.bmp", 4);
+    if (imageData == nullptr) {
+        SDL_Log("Could not load image data!");
+        return;
+    }
+    texture = renderer.CreateTexture(SDL_GPUTextureCreateInfo {
+        .type = SDL_GPU_TEXTURETYPE_2D,
+        .format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM,
+        .usage = SDL_GPU_TEXTUREUSAGE_SAMPLER,
+        .width = static_cast<Uint32>(imageData->w),
+        .height = static_cast<Uint32>(imageData->h),
+        .layer_count_or_depth = 1,
+        .num_levels = 1,
+    });
+    renderer.SetTextureName(texture, "Ravioli Texture");
+    sampler = renderer.CreateSampler(SDL_GPUSamplerCreateInfo {
+        .min_filter = SDL_GPU_FILTER_LINEAR,
+        .mag_filter = SDL_GPU_FILTER_LINEAR,
+        .mipmap_mode = SDL_GPU_SAMPLERMIPMAPMODE_NEAREST,
+        .address_mode_u = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
+        .address_mode_v = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
+        .address_mode_w = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
+    });
+
+    // Quad mesh, centered so that instances rotate around their position
+    vertexAllocation = renderer.AllocateBuffer(BufferUsageClass::Vertex, sizeof(PositionTextureVertex) * 4);
+    indexAllocation = renderer.AllocateBuffer(BufferUsageClass::Index, sizeof(Uint16) * 6);
+
+    const Uint32 textureSize = imageData->w * imageData->h * 4;
+    const Uint32 meshSize = sizeof(PositionTextureVertex) * 4 + sizeof(Uint16) * 6;
+    SDL_GPUTransferBuffer* transferBuffer = renderer.CreateTransferBuffer(SDL_GPUTransferBufferCreateInfo {
+        .usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+        .size = meshSize + textureSize
+    });
+    // The texture goes first, texture copies from a transfer buffer are happiest at offset 0
+    auto transferBytes = static_cast<Uint8*>(renderer.MapTransferBuffer(transferBuffer, false));
+    SDL_memcpy(transferBytes, imageData->pixels, textureSize);
+    auto vertexData = reinterpret_cast<PositionTextureVertex*>(transferBytes + textureSize);
+    vertexData[0] = PositionTextureVertex { -0.5f, -0.5f, 0, 0, 0 };
+    vertexData[1] = PositionTextureVertex {  0.5f, -0.5f, 0, 1, 0 };
+    vertexData[2] = PositionTextureVertex {  0.5f,  0.5f, 0, 1, 1 };
+    vertexData[3] = PositionTextureVertex { -0.5f,  0.5f, 0, 0, 1 };
+    auto indexData = reinterpret_cast<Uint16*>(&vertexData[4]);
+    indexData[0] = 0;
+    indexData[1] = 1;
+    indexData[2] = 2;
+    indexData[3] = 0;
+    indexData[4] = 2;
+    indexData[5] = 3;
+    renderer.UnmapTransferBuffer(transferBuffer);
+
+    renderer.BeginUploadToBuffer();
+    renderer.UploadToBuffer(SDL_GPUTransferBufferLocation {
+                                .transfer_buffer = transferBuffer,
+                                .offset = textureSize
+                            }, vertexAllocation);
+    renderer.UploadToBuffer(SDL_GPUTransferBufferLocation {
+                                .transfer_buffer = transferBuffer,
+                                .offset = textureSize + static_cast<Uint32>(sizeof(PositionTextureVertex)) * 4
+                            }, indexAllocation);
+    SDL_GPUTextureTransferInfo textureBufferLocation {
+        .transfer_buffer = transferBuffer,
+        .offset = 0
+    };
+    SDL_GPUTextureRegion textureBufferRegion {
+        .texture = texture,
+        .w = static_cast<Uint32>(imageData->w),
+        .h = static_cast<Uint32>(imageData->h),
+        .d = 1
+    };
+    renderer.UploadToTexture(textureBufferLocation, textureBufferRegion, false);
+    renderer.EndUploadToBuffer(transferBuffer);
+    renderer.ReleaseSurface(imageData);
+
+    instancedRenderer.Load(renderer, MAX_INSTANCE_COUNT, "Quad Instances");
+    for (InstancedQuadsPacket& packet : packets) {
+        packet.instances.reserve(MAX_INSTANCE_COUNT);
+    }
+    culler.Load(renderer, basePath, MAX_INSTANCE_COUNT);
+
+    SDL_Log("Press Up/Down to double/halve the instance count");
+    SDL_Log("Press Left/Right to disable/enable GPU culling");
+    SDL_Log("Instances: %u, in a single draw call", instanceCount);
+}
+
+void Scene15InstancedQuads::Simulate(float dt, const InputState& input, Uint32 packet) {
+    InstancedQuadsPacket& frame = packets[packet];
+    time += dt;
+
+    if (input.IsPressed(DirectionalKey::Up)) {
+        instanceCount = SDL_min(instanceCount * 2, MAX_INSTANCE_COUNT);
+        SDL_Log("Instances: %u, in a single draw call", instanceCount);
+    }
+    if (input.IsPressed(DirectionalKey::Down)) {
+        instanceCount = SDL_max(instanceCount / 2, 1u);
+        SDL_Log("Instances: %u, in a single draw call", instanceCount);
+    }
+
+    if (input.IsPressed(DirectionalKey::Left)) {
+        isCullingEnabled = false;
+        SDL_Log("GPU culling disabled");
+    }
+    if (input.IsPressed(DirectionalKey::Right)) {
+        isCullingEnabled = true;
+        SDL_Log("GPU culling enabled");
+    }
+
+    // Instances fill a square grid of fixed cells, larger than the screen with many instances
+    const Uint32 columns = SDL_max(1u, static_cast<Uint32>(SDL_ceilf(SDL_sqrtf(static_cast<float>(instanceCount)))));
+    const float size = CELL_SIZE * 0.8f;
+
+    frame.instances.resize(instanceCount);
+    InstanceData* instances = frame.instances.data();
+    const float currentTime = time;
+    TaskScheduler::ParallelFor(instanceCount, INSTANCE_GRAIN_SIZE, [=](Uint32 begin, Uint32 end) {
+        for (Uint32 i = begin; i < end; ++i) {
+            const float column = static_cast<float>(i % columns);
+            const float row = static_cast<float>(i / columns);
+            const float phase = (column + row) * 0.15f;
+            const Mat4 transform = Mat4::CreateScale(size, size, 1.0f)
+                    * Mat4::CreateRotationZ(currentTime + phase)
+                    * Mat4::CreateTranslation((column + 0.5f) * CELL_SIZE, (row + 0.5f) * CELL_SIZE, 0.0f);
+            const SDL_FColor color {
+                0.5f + 0.5f * SDL_sinf(phase),
+                0.5f + 0.5f * SDL_cosf(phase + currentTime),
+                1.0f,
+                1.0f
+            };
+            instances[i] = InstanceData { transform, color };
+        }
+    });
+
+    // The camera circles around the grid center, so that instances enter and leave the view
+    const float gridExtent = static_cast<float>(columns) * CELL_SIZE;
+    const float orbit = SDL_max(0.0f, gridExtent * 0.5f - 320.0f);
+    const float cameraX = gridExtent * 0.5f + orbit * SDL_cosf(time * 0.25f);
+    const float cameraY = gridExtent * 0.5f + orbit * SDL_sinf(time * 0.25f);
+    frame.viewProj = Mat4::CreateOrthographicOffCenter(cameraX - 320.0f, cameraX + 320.0f,
+                                                       cameraY + 240.0f, cameraY - 240.0f, 0, -1);
+    frame.isCullingEnabled = isCullingEnabled;
+
+    // The CPU reference count, to compare with what is on screen
+    timeSinceLastLog += dt;
+    if (timeSinceLastLog >= 1.0f) {
+        vector<Uint32> visibleIndices;
+        FrustumCulling::CullInstances(FrustumCulling::ExtractFrustum(frame.viewProj), frame.instances.data(),
+                                      instanceCount, QUAD_RADIUS, visibleIndices);
+        SDL_Log("Visible instances: %u / %u", static_cast<Uint32>(visibleIndices.size()), instanceCount);
+        timeSinceLastLog = 0;
+    }
+}
+
+void Scene15InstancedQuads::Render(Renderer& renderer, Uint32 packet) {
+    const InstancedQuadsPacket& frame = packets[packet];
+
+    // Bulk upload of every instance, then culling, both before the render pass
+    instancedRenderer.Upload(renderer, frame.instances.data(), static_cast<Uint32>(frame.instances.size()));
+    if (frame.isCullingEnabled) {
+        culler.Cull(renderer, instancedRenderer.GetInstanceBuffer(), instancedRenderer.GetUploadedCount(),
+                    frame.viewProj, QUAD_RADIUS, 6);
+    }
+
+    renderer.Begin();
+    renderer.BindGraphicsPipeline(frame.isCullingEnabled ? culledPipeline : pipeline);
+    renderer.BindVertexBuffer(0, vertexAllocation);
+    renderer.BindIndexBuffer(indexAllocation, SDL_GPU_INDEXELEMENTSIZE_16BIT);
+    renderer.BindFragmentSamplers(0, SDL_GPUTextureSamplerBinding { .texture = texture, .sampler = sampler }, 1);
+    if (frame.isCullingEnabled) {
+        // The instance count comes from the draw command written by the culling pass
+        culler.Draw(renderer, instancedRenderer.GetInstanceBuffer(), frame.viewProj);
+    } else {
+        instancedRenderer.Draw(renderer, 6, frame.viewProj);
+    }
+    renderer.End();
+}
+
+void Scene15InstancedQuads::Unload(Renderer& renderer) {
+    culler.Unload(renderer);
+    instancedRenderer.Unload(renderer);
+    renderer.FreeBuffer(vertexAllocation);
+    renderer.FreeBuffer(indexAllocation);
+    renderer.ReleaseSampler(sampler);
+    renderer.ReleaseTexture(texture);
+    renderer.ReleaseGraphicsPipeline(culledPipeline);
+    renderer.ReleaseGraphicsPipeline(pipeline);
+}
@@ -0,0 +1,61 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef SCENE15INSTANCEDQUADS_HPP
+#define SCENE15INSTANCEDQUADS_HPP
+
+#include <SDL3/SDL_gpu.h>
+#include "ThreadedScene.hpp"
+#include "Mat4.hpp"
+#include "BufferAllocator.hpp"
+#include "InstancedRenderer.hpp"
+#include "InstanceCuller.hpp"
+
+// Everything Render needs from a simulated frame
+struct InstancedQuadsPacket {
+    vector<InstanceData> instances;
+    Mat4 viewProj;
+    bool isCullingEnabled { true };
+};
+
+class Scene15InstancedQuads : public ThreadedScene {
+public:
+    void Load(Renderer& renderer) override;
+    void Simulate(float dt, const InputState& input, Uint32 packet) override;
+    void Render(Renderer& renderer, Uint32 packet) override;
+    void Unload(Renderer& renderer) override;
+
+    static constexpr Uint32 GRID_SIZE = 128;
+    static constexpr Uint32 MAX_INSTANCE_COUNT = GRID_SIZE * GRID_SIZE;
+    // Instances are laid out on a fixed grid, so the world grows past the screen with the instance count
+    static constexpr float CELL_SIZE = 32.0f;
+    // Radius of the sphere around the unit quad
+    static constexpr float QUAD_RADIUS = 0.7071f;
+    // Instances filled per task
+    static constexpr Uint32 INSTANCE_GRAIN_SIZE = 256;
+
+private:
+    const char* basePath {nullptr};
+    SDL_GPUShader* vertexShader {nullptr};
+    SDL_GPUShader* fragmentShader {nullptr};
+
+    SDL_GPUGraphicsPipeline* pipeline {nullptr};
+    SDL_GPUGraphicsPipeline* culledPipeline {nullptr};
+    SDL_GPUTexture* texture {nullptr};
+    SDL_GPUSampler* sampler {nullptr};
+    BufferAllocation vertexAllocation;
+    BufferAllocation indexAllocation;
+
+    InstancedRenderer instancedRenderer;
+    InstanceCuller culler;
+    InstancedQuadsPacket packets[PACKET_COUNT];
+
+    // Simulation state
+    Uint32 instanceCount {MAX_INSTANCE_COUNT / 4};
+    bool isCullingEnabled {true};
+    float time {0};
+    float timeSinceLastLog {0};
+};
+
+#endif //SCENE15INSTANCEDQUADS_HPP
@@ -0,0 +1,153 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#include "Scene16GpuParticles.hpp"
+#include "Renderer.hpp"
+#include <SDL3/SDL.h>
+
+void Scene16GpuParticles::Load(Renderer& renderer) {
+    basePath = SDL_GetBasePath();
+    // Two storage buffers and one uniform buffer in the vertex shader, no vertex buffer
+    SDL_GPUShader* vertexShader = renderer.LoadShader(basePath, "ParticleSprite.vert", 0, 1, 2, 0);
+    SDL_GPUShader* fragmentShader = renderer.LoadShader(basePath, "TexturedQuadColor.frag", 1, 0, 0, 0);
+    viewProj = Mat4::CreateOrthographicOffCenter(0, 640, 480, 0, 0, -1);
+
+    // Additive blending: overlapping particles glow, and their draw order does not matter
+    SDL_GPUGraphicsPipelineCreateInfo pipelineCreateInfo = {
+        .vertex_shader = vertexShader,
+        .fragment_shader = fragmentShader,
+        .primitive_type = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST,
+        .target_info = {
+            .color_target_descriptions = new SDL_GPUColorTargetDescription[1] {{
+                .format = SDL_GetGPUSwapchainTextureFormat(renderer.device, renderer.renderWindow),
+                .blend_state = {
+                    .src_color_blendfactor = SDL_GPU_BLENDFACTOR_SRC_ALPHA,
+                    .dst_color_blendfactor = SDL_GPU_BLENDFACTOR_ONE,
+                    .color_blend_op = SDL_GPU_BLENDOP_ADD,
+                    .src_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ONE,
+                    .dst_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ONE,
+                    .alpha_blend_op = SDL_GPU_BLENDOP_ADD,
+                    .enable_blend = true,
+                }
+            }},
+            .num_color_targets = 1,
+        },
+    };
+    pipeline = renderer.CreateGPUGraphicsPipeline(pipelineCreateInfo);
+    renderer.ReleaseShader(vertexShader);
+    renderer.ReleaseShader(fragmentShader);
+
+    // Texture
+    SDL_Surface* imageData = renderer.LoadBMPImage(basePath, "ravioli.bmp", 4);
+    if (imageData == nullptr) {
+        SDL_Log("Could not load image data!");
+        return;
+    }
+    texture = renderer.CreateTexture(SDL_GPUTextureCreateInfo {
+        .type = SDL_GPU_TEXTURETYPE_2D,
+        .format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM,
+        .usage = SDL_GPU_TEXTUREUSAGE_SAMPLER,
+        .width = static_cast<Uint32>(imageData->w),
+        .height = static_cast<Uint32>(imageData->h),
+        .layer_count_or_depth = 1,
+        .num_levels = 1,
+    });
+    renderer.SetTextureName(texture, "Ravioli Texture");
+    sampler = renderer.CreateSampler(SDL_GPUSamplerCreateInfo {
+        .min_filter = SDL_GPU_FILTER_LINEAR,
+        .mag_filter = SDL_GPU_FILTER_LINEAR,
+        .mipmap_mode = SDL_GPU_SAMPLERMIPMAPMODE_NEAREST,
+        .address_mode_u = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
+        .address_mode_v = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
+        .address_mode_w = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
+    });
+
+    const Uint32 textureSize = imageData->w * imageData->h * 4;
+    SDL_GPUTransferBuffer* transferBuffer = renderer.CreateTransferBuffer(SDL_GPUTransferBufferCreateInfo {
+        .usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+        .size = textureSize
+    });
+    SDL_memcpy(renderer.MapTransferBuffer(transferBuffer, false), imageData->pixels, textureSize);
+    renderer.UnmapTransferBuffer(transferBuffer);
+    renderer.BeginUploadToBuffer();
+    SDL_GPUTextureTransferInfo textureBufferLocation {
+        .transfer_buffer = transferBuffer,
+        .offset = 0
+    };
+    SDL_GPUTextureRegion textureBufferRegion {
+        .texture = texture,
+        .w = static_cast<Uint32>(imageData->w),
+        .h = static_cast<Uint32>(imageData->h),
+        .d = 1
+    };
+    renderer.UploadToTexture(textureBufferLocation, textureBufferRegion, false);
+    renderer.EndUploadToBuffer(transferBuffer);
+    renderer.ReleaseSurface(imageData);
+
+    particles.Load(renderer, basePath, PARTICLE_CAPACITY);
+
+    SDL_Log("Press Up/Down to double/halve the emission rate");
+    SDL_Log("Emitting %u particles per second", emissionRate);
+}
+
+bool Scene16GpuParticles::Update(float dt_) {
+    const bool isRunning = ManageInput(inputState);
+    dt = dt_;
+    time += dt;
+
+    if (inputState.IsPressed(DirectionalKey::Up)) {
+        emissionRate = SDL_min(emissionRate * 2, PARTICLE_CAPACITY);
+        SDL_Log("Emitting %u particles per second", emissionRate);
+    }
+    if (inputState.IsPressed(DirectionalKey::Down)) {
+        emissionRate = SDL_max(emissionRate / 2, MIN_EMISSION_RATE);
+        SDL_Log("Emitting %u particles per second", emissionRate);
+    }
+
+    // Whole particles only, the fraction carries over to the next frame
+    const float emission = static_cast<float>(emissionRate) * dt + emissionRemainder;
+    emitCount = static_cast<Uint32>(emission);
+    emissionRemainder = emission - static_cast<float>(emitCount);
+
+    return isRunning;
+}
+
+void Scene16GpuParticles::Draw(Renderer& renderer) {
+    // A fountain that sweeps left and right, from the bottom of the screen
+    const ParticleEmitUniforms emitUniforms {
+        .positionX = 320.0f,
+        .positionY = 440.0f,
+        .direction = -SDL_PI_F * 0.5f + 0.4f * SDL_sinf(time * 0.5f),
+        .spread = 0.3f,
+        .speedMin = 200.0f,
+        .speedMax = 350.0f,
+        .lifetimeMin = LIFETIME_MIN,
+        .lifetimeMax = LIFETIME_MAX,
+        .size = 6.0f,
+        .angularSpeedMax = 4.0f,
+        .emitCount = emitCount,
+        .seed = random.NextUint32(),
+        .r = 1.0f,
+        .g = 0.6f,
+        .b = 0.3f,
+        .a = 0.5f,
+    };
+
+    // Compute passes, before the render pass
+    particles.Emit(renderer, emitUniforms);
+    particles.Simulate(renderer, dt, 0.0f, 150.0f, 0.2f);
+
+    renderer.Begin();
+    renderer.BindGraphicsPipeline(pipeline);
+    renderer.BindFragmentSamplers(0, SDL_GPUTextureSamplerBinding { .texture = texture, .sampler = sampler }, 1);
+    particles.Draw(renderer, viewProj);
+    renderer.End();
+}
+
+void Scene16GpuParticles::Unload(Renderer& renderer) {
+    particles.Unload(renderer);
+    renderer.ReleaseSampler(sampler);
+    renderer.ReleaseTexture(texture);
+    renderer.ReleaseGraphicsPipeline(pipeline);
+}
@@ -0,0 +1,47 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef SCENE16GPUPARTICLES_HPP
+#define SCENE16GPUPARTICLES_HPP
+
+#include <SDL3/SDL_gpu.h>
+#include "Scene.hpp"
+#include "Mat4.hpp"
+#include "ParticleSystem.hpp"
+#include "Random.hpp"
+
+class Scene16GpuParticles : public Scene {
+public:
+    void Load(Renderer& renderer) override;
+    bool Update(float dt) override;
+    void Draw(Renderer& renderer) override;
+    void Unload(Renderer& renderer) override;
+
+    static constexpr Uint32 PARTICLE_CAPACITY = 1 << 20;
+    static constexpr Uint32 MIN_EMISSION_RATE = 1024;
+    static constexpr float LIFETIME_MIN = 2.0f;
+    static constexpr float LIFETIME_MAX = 4.0f;
+    // Same particles on every run
+    static constexpr Uint64 PARTICLE_SEED = 0;
+
+private:
+    InputState inputState;
+    const char* basePath {nullptr};
+    SDL_GPUGraphicsPipeline* pipeline {nullptr};
+    SDL_GPUTexture* texture {nullptr};
+    SDL_GPUSampler* sampler {nullptr};
+    Mat4 viewProj;
+
+    ParticleSystem particles;
+    Random random {PARTICLE_SEED};
+
+    // Particles per second
+    Uint32 emissionRate {PARTICLE_CAPACITY / 4};
+    float emissionRemainder {0};
+    Uint32 emitCount {0};
+    float time {0};
+    float dt {0};
+};
+
+#endif //SCENE16GPUPARTICLES_HPP
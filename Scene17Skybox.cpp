@@ -0,0 +1,220 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#include "Scene17Skybox.hpp"
+#include "Renderer.hpp"
+#include <SDL3/SDL.h>
+
+#include "PositionColorVertex.hpp"
+
+namespace {
+    // Counter clockwise seen from outside, in +X, -X, +Y, -Y, +Z, -Z order like the cubemap faces
+    constexpr float FACE_CORNERS[6][4][3] = {
+        {{  1, -1,  1 }, {  1, -1, -1 }, {  1,  1, -1 }, {  1,  1,  1 }},
+        {{ -1, -1, -1 }, { -1, -1,  1 }, { -1,  1,  1 }, { -1,  1, -1 }},
+        {{ -1,  1,  1 }, {  1,  1,  1 }, {  1,  1, -1 }, { -1,  1, -1 }},
+        {{ -1, -1, -1 }, {  1, -1, -1 }, {  1, -1,  1 }, { -1, -1,  1 }},
+        {{ -1, -1,  1 }, {  1, -1,  1 }, {  1,  1,  1 }, { -1,  1,  1 }},
+        {{  1, -1, -1 }, { -1, -1, -1 }, { -1,  1, -1 }, {  1,  1, -1 }},
+    };
+
+    constexpr Uint8 FACE_COLORS[6][3] = {
+        { 255,  80,  80 }, {  80, 255, 255 }, {  80, 255,  80 },
+        { 255,  80, 255 }, {  80,  80, 255 }, { 255, 255,  80 },
+    };
+
+    constexpr const char* CUBEMAP_FACES[Renderer::CUBE_FACE_COUNT] = {
+        "cube0.bmp", "cube1.bmp", "cube2.bmp", "cube3.bmp", "cube4.bmp", "cube5.bmp"
+    };
+}
+
+void Scene17Skybox::Load(Renderer& renderer) {
+    basePath = SDL_GetBasePath();
+    SDL_GPUShader* cubeVertexShader = renderer.LoadShader(basePath, "PositionColorTransform.vert", 0, 1, 0, 0);
+    SDL_GPUShader* cubeFragmentShader = renderer.LoadShader(basePath, "SolidColor.frag", 0, 0, 0, 0);
+    SDL_GPUShader* skyboxVertexShader = renderer.LoadShader(basePath, "Skybox.vert", 0, 1, 0, 0);
+    SDL_GPUShader* skyboxFragmentShader = renderer.LoadShader(basePath, "Skybox.frag", 1, 0, 0, 0);
+
+    SDL_GPUGraphicsPipelineCreateInfo pipelineCreateInfo = {
+        .vertex_shader = cubeVertexShader,
+        .fragment_shader = cubeFragmentShader,
+        .vertex_input_state = SDL_GPUVertexInputState {
+            .vertex_buffer_descriptions = new SDL_GPUVertexBufferDescription[1] {{
+                .slot = 0,
+                .pitch = sizeof(PositionColorVertex),
+                .input_rate = SDL_GPU_VERTEXINPUTRATE_VERTEX,
+                .instance_step_rate = 0,
+            }},
+            .num_vertex_buffers = 1,
+            .vertex_attributes = new SDL_GPUVertexAttribute[2] {{
+                .location = 0,
+                .buffer_slot = 0,
+                .format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT3,
+                .offset = 0
+            }, {
+                .location = 1,
+                .buffer_slot = 0,
+                .format = SDL_GPU_VERTEXELEMENTFORMAT_UBYTE4_NORM,
+                .offset = sizeof(float) * 3
+            }},
+            .num_vertex_attributes = 2,
+        },
+        .primitive_type = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST,
+        .rasterizer_state = SDL_GPURasterizerState {
+            .fill_mode = SDL_GPU_FILLMODE_FILL,
+            .cull_mode = SDL_GPU_CULLMODE_BACK,
+            .front_face = SDL_GPU_FRONTFACE_COUNTER_CLOCKWISE
+        },
+        .depth_stencil_state = SDL_GPUDepthStencilState {
+            .compare_op = SDL_GPU_COMPAREOP_LESS,
+            .enable_depth_test = true,
+            .enable_depth_write = true,
+        },
+        .target_info = {
+            .color_target_descriptions = new SDL_GPUColorTargetDescription[1] {{
+                .format = SDL_GetGPUSwapchainTextureFormat(renderer.device, renderer.renderWindow)
+            }},
+            .num_color_targets = 1,
+            .depth_stencil_format = renderer.GetDepthFormat(),
+            .has_depth_stencil_target = true,
+        },
+    };
+    cubePipeline = renderer.CreateGPUGraphicsPipeline(pipelineCreateInfo);
+
+    // The sky reads the positions only. It is seen from inside, and sits on the far plane where the cleared
+    // depth is 1, so it passes with LESS_OR_EQUAL and must not write depth.
+    pipelineCreateInfo.vertex_shader = skyboxVertexShader;
+    pipelineCreateInfo.fragment_shader = skyboxFragmentShader;
+    pipelineCreateInfo.vertex_input_state.num_vertex_attributes = 1;
+    pipelineCreateInfo.rasterizer_state.cull_mode = SDL_GPU_CULLMODE_NONE;
+    pipelineCreateInfo.depth_stencil_state = SDL_GPUDepthStencilState {
+        .compare_op = SDL_GPU_COMPAREOP_LESS_OR_EQUAL,
+        .enable_depth_test = true,
+        .enable_depth_write = false,
+    };
+    skyboxPipeline = renderer.CreateGPUGraphicsPipeline(pipelineCreateInfo);
+
+    renderer.ReleaseShader(cubeVertexShader);
+    renderer.ReleaseShader(cubeFragmentShader);
+    renderer.ReleaseShader(skyboxVertexShader);
+    renderer.ReleaseShader(skyboxFragmentShader);
+
+    // Textures
+    cubemap = renderer.LoadCubemap(basePath, CUBEMAP_FACES);
+    if (cubemap == nullptr) {
+        SDL_Log("Could not load the cubemap!");
+        return;
+    }
+    sampler = renderer.CreateSampler(SDL_GPUSamplerCreateInfo {
+        .min_filter = SDL_GPU_FILTER_LINEAR,
+        .mag_filter = SDL_GPU_FILTER_LINEAR,
+        .mipmap_mode = SDL_GPU_SAMPLERMIPMAPMODE_NEAREST,
+        .address_mode_u = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
+        .address_mode_v = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
+        .address_mode_w = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
+    });
+
+    // Geometry
+    constexpr Uint32 vertexSize = sizeof(PositionColorVertex) * VERTEX_COUNT;
+    constexpr Uint32 indexSize = sizeof(Uint16) * INDEX_COUNT;
+    vertexBuffer = renderer.CreateBuffer(SDL_GPUBufferCreateInfo {
+        .usage = SDL_GPU_BUFFERUSAGE_VERTEX,
+        .size = vertexSize
+    });
+    renderer.SetBufferName(vertexBuffer, "Skybox Cube Vertices");
+    indexBuffer = renderer.CreateBuffer(SDL_GPUBufferCreateInfo {
+        .usage = SDL_GPU_BUFFERUSAGE_INDEX,
+        .size = indexSize
+    });
+    renderer.SetBufferName(indexBuffer, "Skybox Cube Indices");
+
+    SDL_GPUTransferBuffer* transferBuffer = renderer.CreateTransferBuffer(SDL_GPUTransferBufferCreateInfo {
+        .usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+        .size = vertexSize + indexSize
+    });
+    auto* transferData = static_cast<PositionColorVertex*>(renderer.MapTransferBuffer(transferBuffer, false));
+    auto* indexData = reinterpret_cast<Uint16*>(&transferData[VERTEX_COUNT]);
+    for (Uint16 face = 0; face < 6; ++face) {
+        for (Uint16 corner = 0; corner < 4; ++corner) {
+            const float* position = FACE_CORNERS[face][corner];
+            transferData[face * 4 + corner] = PositionColorVertex {
+                position[0], position[1], position[2],
+                FACE_COLORS[face][0], FACE_COLORS[face][1], FACE_COLORS[face][2], 255
+            };
+        }
+        const Uint16 first = face * 4;
+        const Uint16 faceIndices[6] = { first, static_cast<Uint16>(first + 1), static_cast<Uint16>(first + 2),
+                                        first, static_cast<Uint16>(first + 2), static_cast<Uint16>(first + 3) };
+        SDL_memcpy(&indexData[face * 6], faceIndices, sizeof(faceIndices));
+    }
+    renderer.UnmapTransferBuffer(transferBuffer);
+
+    renderer.BeginUploadToBuffer();
+    renderer.UploadToBuffer(SDL_GPUTransferBufferLocation { .transfer_buffer = transferBuffer, .offset = 0 },
+                            SDL_GPUBufferRegion { .buffer = vertexBuffer, .offset = 0, .size = vertexSize }, false);
+    renderer.UploadToBuffer(SDL_GPUTransferBufferLocation { .transfer_buffer = transferBuffer, .offset = vertexSize },
+                            SDL_GPUBufferRegion { .buffer = indexBuffer, .offset = 0, .size = indexSize }, false);
+    renderer.EndUploadToBuffer(transferBuffer);
+
+    SDL_Log("Press Left/Right to turn the camera");
+}
+
+bool Scene17Skybox::Update(float dt) {
+    const bool isRunning = ManageInput(inputState);
+    time += dt;
+
+    if (inputState.IsDown(DirectionalKey::Left)) { cameraYaw += CAMERA_TURN_SPEED * dt; }
+    if (inputState.IsDown(DirectionalKey::Right)) { cameraYaw -= CAMERA_TURN_SPEED * dt; }
+
+    return isRunning;
+}
+
+void Scene17Skybox::Draw(Renderer& renderer) {
+    // Size of the last acquired swapchain texture, 4:3 before the first frame
+    const float aspectRatio = renderer.swapchainHeight > 0
+                              ? static_cast<float>(renderer.swapchainWidth)
+                                / static_cast<float>(renderer.swapchainHeight)
+                              : 4.0f / 3.0f;
+    const Mat4 projection = Mat4::CreatePerspectiveFieldOfView(FIELD_OF_VIEW, aspectRatio, 0.1f, 100.0f);
+    // The camera stays at the origin: the sky only rotates with it, it never gets closer
+    const Mat4 view = Mat4::CreateRotationMatrix(0.0f, 1.0f, 0.0f, cameraYaw)
+                      * Mat4::CreateRotationMatrix(1.0f, 0.0f, 0.0f, 0.15f * SDL_sinf(time * 0.3f));
+    // Copying the w column into the z column gives z = w, which puts the sky on the far plane after the perspective
+    // divide: the depth test against the opaque geometry drawn before only shades the sky pixels left visible
+    Mat4 skyboxMatrix = view * projection;
+    skyboxMatrix.m8 = skyboxMatrix.m12;
+    skyboxMatrix.m9 = skyboxMatrix.m13;
+    skyboxMatrix.m10 = skyboxMatrix.m14;
+    skyboxMatrix.m11 = skyboxMatrix.m15;
+    const Mat4 cubeMatrix = Mat4::CreateRotationMatrix(1.0f, 1.0f, 0.0f, time)
+                            * Mat4::CreateTranslation(0.0f, 0.0f, -4.0f) * view * projection;
+
+    renderer.BeginWithDepth();
+    if (renderer.IsSwapchainTextureValid()) {
+        renderer.BindVertexBuffers(0, SDL_GPUBufferBinding { .buffer = vertexBuffer, .offset = 0 }, 1);
+        renderer.BindIndexBuffer(SDL_GPUBufferBinding { .buffer = indexBuffer, .offset = 0 },
+                                 SDL_GPU_INDEXELEMENTSIZE_16BIT);
+
+        // Opaque geometry first, so that its depth hides the sky behind it
+        renderer.BindGraphicsPipeline(cubePipeline);
+        renderer.PushVertexUniformData(0, &cubeMatrix, sizeof(Mat4));
+        renderer.DrawIndexedPrimitives(INDEX_COUNT, 1, 0, 0, 0);
+
+        // Sky last: the early depth test rejects the covered pixels before they sample the cubemap
+        renderer.BindGraphicsPipeline(skyboxPipeline);
+        renderer.BindFragmentSamplers(0, SDL_GPUTextureSamplerBinding { .texture = cubemap, .sampler = sampler }, 1);
+        renderer.PushVertexUniformData(0, &skyboxMatrix, sizeof(Mat4));
+        renderer.DrawIndexedPrimitives(INDEX_COUNT, 1, 0, 0, 0);
+    }
+    renderer.End();
+}
+
+void Scene17Skybox::Unload(Renderer& renderer) {
+    renderer.ReleaseSampler(sampler);
+    renderer.ReleaseTexture(cubemap);
+    renderer.ReleaseBuffer(vertexBuffer);
+    renderer.ReleaseBuffer(indexBuffer);
+    renderer.ReleaseGraphicsPipeline(cubePipeline);
+    renderer.ReleaseGraphicsPipeline(skyboxPipeline);
+}
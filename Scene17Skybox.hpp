@@ -0,0 +1,39 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef SCENE17SKYBOX_HPP
+#define SCENE17SKYBOX_HPP
+
+#include <SDL3/SDL_gpu.h>
+#include "Scene.hpp"
+#include "Mat4.hpp"
+
+class Scene17Skybox : public Scene {
+public:
+    void Load(Renderer& renderer) override;
+    bool Update(float dt) override;
+    void Draw(Renderer& renderer) override;
+    void Unload(Renderer& renderer) override;
+
+    // Shared by the cube and the skybox: the sky uses the positions as cube texture coordinates
+    static constexpr Uint32 VERTEX_COUNT = 24;
+    static constexpr Uint32 INDEX_COUNT = 36;
+    static constexpr float CAMERA_TURN_SPEED = 1.5f; // Radians per second
+    static constexpr float FIELD_OF_VIEW = 75.0f * SDL_PI_F / 180.0f;
+
+private:
+    InputState inputState;
+    const char* basePath {nullptr};
+    SDL_GPUGraphicsPipeline* cubePipeline {nullptr};
+    SDL_GPUGraphicsPipeline* skyboxPipeline {nullptr};
+    SDL_GPUBuffer* vertexBuffer {nullptr};
+    SDL_GPUBuffer* indexBuffer {nullptr};
+    SDL_GPUTexture* cubemap {nullptr};
+    SDL_GPUSampler* sampler {nullptr};
+
+    float cameraYaw {0};
+    float time {0};
+};
+
+#endif //SCENE17SKYBOX_HPP
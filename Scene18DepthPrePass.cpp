@@ -0,0 +1,241 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#include "Scene18DepthPrePass.hpp"
+#include "Renderer.hpp"
+#include "Random.hpp"
+#include <SDL3/SDL.h>
+
+#include "PositionColorVertex.hpp"
+
+void Scene18DepthPrePass::Load(Renderer& renderer) {
+    basePath = SDL_GetBasePath();
+    SDL_GPUShader* vertexShader = renderer.LoadShader(basePath, "PositionColorTransform.vert", 0, 1, 0, 0);
+    SDL_GPUShader* fragmentShader = renderer.LoadShader(basePath, "NoiseColor.frag", 0, 1, 0, 0);
+    SDL_GPUShader* depthFragmentShader = renderer.LoadShader(basePath, "SolidColor.frag", 0, 0, 0, 0);
+
+    SDL_GPUGraphicsPipelineCreateInfo pipelineCreateInfo = {
+        .vertex_shader = vertexShader,
+        .fragment_shader = fragmentShader,
+        .vertex_input_state = SDL_GPUVertexInputState {
+            .vertex_buffer_descriptions = new SDL_GPUVertexBufferDescription[1] {{
+                .slot = 0,
+                .pitch = sizeof(PositionColorVertex),
+                .input_rate = SDL_GPU_VERTEXINPUTRATE_VERTEX,
+                .instance_step_rate = 0,
+            }},
+            .num_vertex_buffers = 1,
+            .vertex_attributes = new SDL_GPUVertexAttribute[2] {{
+                .location = 0,
+                .buffer_slot = 0,
+                .format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT3,
+                .offset = 0
+            }, {
+                .location = 1,
+                .buffer_slot = 0,
+                .format = SDL_GPU_VERTEXELEMENTFORMAT_UBYTE4_NORM,
+                .offset = sizeof(float) * 3
+            }},
+            .num_vertex_attributes = 2,
+        },
+        .primitive_type = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST,
+        .depth_stencil_state = SDL_GPUDepthStencilState {
+            .compare_op = SDL_GPU_COMPAREOP_LESS,
+            .enable_depth_test = true,
+            .enable_depth_write = true,
+        },
+        .target_info = {
+            .color_target_descriptions = new SDL_GPUColorTargetDescription[1] {{
+                .format = SDL_GetGPUSwapchainTextureFormat(renderer.device, renderer.renderWindow)
+            }},
+            .num_color_targets = 1,
+            .depth_stencil_format = renderer.GetDepthFormat(),
+            .has_depth_stencil_target = true,
+        },
+    };
+    colorPipeline = renderer.CreateGPUGraphicsPipeline(pipelineCreateInfo);
+
+    // Same vertex shader and transforms as the pre-pass, so the depths match exactly
+    pipelineCreateInfo.depth_stencil_state = SDL_GPUDepthStencilState {
+        .compare_op = SDL_GPU_COMPAREOP_LESS_OR_EQUAL,
+        .enable_depth_test = true,
+        .enable_depth_write = false,
+    };
+    colorPipelineAfterPrePass = renderer.CreateGPUGraphicsPipeline(pipelineCreateInfo);
+
+    // Depth only: the cheapest fragment shader, and no color write
+    SDL_GPUColorTargetDescription depthOnlyTarget {
+        .format = SDL_GetGPUSwapchainTextureFormat(renderer.device, renderer.renderWindow),
+        .blend_state = SDL_GPUColorTargetBlendState {
+            .color_write_mask = 0,
+            .enable_color_write_mask = true,
+        }
+    };
+    pipelineCreateInfo.fragment_shader = depthFragmentShader;
+    pipelineCreateInfo.target_info.color_target_descriptions = &depthOnlyTarget;
+    pipelineCreateInfo.depth_stencil_state = SDL_GPUDepthStencilState {
+        .compare_op = SDL_GPU_COMPAREOP_LESS,
+        .enable_depth_test = true,
+        .enable_depth_write = true,
+    };
+    depthPipeline = renderer.CreateGPUGraphicsPipeline(pipelineCreateInfo);
+
+    renderer.ReleaseShader(vertexShader);
+    renderer.ReleaseShader(fragmentShader);
+    renderer.ReleaseShader(depthFragmentShader);
+
+    // One unit quad, facing the camera
+    vertexBuffer = renderer.CreateBuffer(SDL_GPUBufferCreateInfo {
+        .usage = SDL_GPU_BUFFERUSAGE_VERTEX,
+        .size = sizeof(PositionColorVertex) * 4
+    });
+    renderer.SetBufferName(vertexBuffer, "Pre-pass Quad Vertices");
+    indexBuffer = renderer.CreateBuffer(SDL_GPUBufferCreateInfo {
+        .usage = SDL_GPU_BUFFERUSAGE_INDEX,
+        .size = sizeof(Uint16) * 6
+    });
+    renderer.SetBufferName(indexBuffer, "Pre-pass Quad Indices");
+
+    SDL_GPUTransferBuffer* transferBuffer = renderer.CreateTransferBuffer(SDL_GPUTransferBufferCreateInfo {
+        .usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+        .size = sizeof(PositionColorVertex) * 4 + sizeof(Uint16) * 6
+    });
+    auto* transferData = static_cast<PositionColorVertex*>(renderer.MapTransferBuffer(transferBuffer, false));
+    transferData[0] = PositionColorVertex { -0.5f, -0.5f, 0, 255, 255, 255, 255 };
+    transferData[1] = PositionColorVertex {  0.5f, -0.5f, 0, 255, 200, 200, 255 };
+    transferData[2] = PositionColorVertex {  0.5f,  0.5f, 0, 200, 255, 200, 255 };
+    transferData[3] = PositionColorVertex { -0.5f,  0.5f, 0, 200, 200, 255, 255 };
+    auto* indexData = reinterpret_cast<Uint16*>(&transferData[4]);
+    const Uint16 indices[6] = { 0, 1, 2, 0, 2, 3 };
+    SDL_memcpy(indexData, indices, sizeof(indices));
+    renderer.UnmapTransferBuffer(transferBuffer);
+
+    renderer.BeginUploadToBuffer();
+    renderer.UploadToBuffer(SDL_GPUTransferBufferLocation { .transfer_buffer = transferBuffer, .offset = 0 },
+                            SDL_GPUBufferRegion {
+                                .buffer = vertexBuffer,
+                                .offset = 0,
+                                .size = sizeof(PositionColorVertex) * 4
+                            }, false);
+    renderer.UploadToBuffer(SDL_GPUTransferBufferLocation {
+                                .transfer_buffer = transferBuffer,
+                                .offset = sizeof(PositionColorVertex) * 4
+                            },
+                            SDL_GPUBufferRegion { .buffer = indexBuffer, .offset = 0, .size = sizeof(Uint16) * 6 },
+                            false);
+    renderer.EndUploadToBuffer(transferBuffer);
+
+    // Large quads spread in depth, most of the screen is covered several times
+    Random random { QUAD_SEED };
+    for (Quad& quad : quads) {
+        quad.z = -random.NextFloat(2.0f, 20.0f);
+        quad.x = random.NextFloat(-0.6f, 0.6f) * -quad.z;
+        quad.y = random.NextFloat(-0.4f, 0.4f) * -quad.z;
+        quad.size = random.NextFloat(0.4f, 1.0f) * -quad.z;
+        quad.tint[0] = random.NextFloat(0.3f, 1.0f);
+        quad.tint[1] = random.NextFloat(0.3f, 1.0f);
+        quad.tint[2] = random.NextFloat(0.3f, 1.0f);
+        quad.tint[3] = 1.0f;
+    }
+
+    SDL_Log("Press Up to toggle the depth pre-pass, Down to toggle the draw order");
+}
+
+bool Scene18DepthPrePass::Update(float dt) {
+    const bool isRunning = ManageInput(inputState);
+    time += dt;
+
+    if (inputState.IsPressed(DirectionalKey::Up)) {
+        isDepthPrePassEnabled = !isDepthPrePassEnabled;
+        SDL_Log("Depth pre-pass %s", isDepthPrePassEnabled ? "on" : "off");
+    }
+    if (inputState.IsPressed(DirectionalKey::Down)) {
+        isFrontToBack = !isFrontToBack;
+        SDL_Log("Draw order: %s", isFrontToBack ? "front to back" : "back to front");
+    }
+
+    timeSinceLastLog += dt;
+    if (timeSinceLastLog >= 1.0f) {
+        timeSinceLastLog = 0;
+        logStats = true;
+    }
+
+    return isRunning;
+}
+
+void Scene18DepthPrePass::Draw(Renderer& renderer) {
+    if (logStats) {
+        // Stats of the previous frame
+        const RendererStats& stats = renderer.GetFrameStats();
+        SDL_Log("Frame: %.2f ms, draws: %u (pre-pass: %u), overdraw: %.2f", renderer.GetLastFrameTime() * 1000.0f,
+                stats.drawCalls, stats.depthPrePassDraws, stats.Overdraw());
+        logStats = false;
+    }
+
+    // Size of the last acquired swapchain texture, the window size before the first frame
+    float width = static_cast<float>(renderer.swapchainWidth);
+    float height = static_cast<float>(renderer.swapchainHeight);
+    if (width == 0 || height == 0) {
+        int w, h;
+        SDL_GetWindowSizeInPixels(renderer.renderWindow, &w, &h);
+        width = static_cast<float>(SDL_max(w, 1));
+        height = static_cast<float>(SDL_max(h, 1));
+    }
+    const Mat4 projection = Mat4::CreatePerspectiveFieldOfView(FIELD_OF_VIEW, width / height, NEAR_PLANE,
+                                                               FAR_PLANE);
+
+    drawQueue.Clear();
+    drawQueue.SetDepthOrder(0, isFrontToBack ? DepthOrder::FrontToBack : DepthOrder::BackToFront);
+    drawQueue.SetDepthPrePass(0, isDepthPrePassEnabled);
+    const DrawPacket quadPacket {
+        .pipeline = isDepthPrePassEnabled ? colorPipelineAfterPrePass : colorPipeline,
+        .vertexBuffer = SDL_GPUBufferBinding { .buffer = vertexBuffer, .offset = 0 },
+        .indexBuffer = SDL_GPUBufferBinding { .buffer = indexBuffer, .offset = 0 },
+        .indexElementSize = SDL_GPU_INDEXELEMENTSIZE_16BIT,
+        .indexCount = 6,
+        .depthPipeline = depthPipeline,
+    };
+    for (Uint32 i = 0; i < QUAD_COUNT; ++i) {
+        // Sway sideways, so that the overlaps change
+        Quad quad = quads[i];
+        quad.x += 0.1f * -quad.z * SDL_sinf(time * 0.5f + static_cast<float>(i));
+
+        DrawPacket packet = quadPacket;
+        packet.coverage = ComputeCoverage(quad, projection, width, height);
+        const Mat4 transform = Mat4::CreateScale(quad.size, quad.size, 1.0f)
+                               * Mat4::CreateTranslation(quad.x, quad.y, quad.z) * projection;
+        const NoiseUniforms noiseUniforms {
+            .tint = { quad.tint[0], quad.tint[1], quad.tint[2], quad.tint[3] },
+            .time = time * 0.2f,
+        };
+        drawQueue.Add(0, -quad.z, packet, &transform, sizeof(Mat4), &noiseUniforms, sizeof(NoiseUniforms));
+    }
+
+    renderer.BeginWithDepth();
+    if (renderer.IsSwapchainTextureValid()) {
+        drawQueue.Submit(renderer);
+    }
+    renderer.End();
+}
+
+void Scene18DepthPrePass::Unload(Renderer& renderer) {
+    renderer.ReleaseBuffer(vertexBuffer);
+    renderer.ReleaseBuffer(indexBuffer);
+    renderer.ReleaseGraphicsPipeline(colorPipeline);
+    renderer.ReleaseGraphicsPipeline(colorPipelineAfterPrePass);
+    renderer.ReleaseGraphicsPipeline(depthPipeline);
+}
+
+float Scene18DepthPrePass::ComputeCoverage(const Quad& quad, const Mat4& projection, float width, float height) {
+    const float distance = -quad.z;
+    if (distance <= NEAR_PLANE) { return 0; }
+    const float halfSize = quad.size * 0.5f;
+    const float left = SDL_max((quad.x - halfSize) * projection.m0 / distance, -1.0f);
+    const float right = SDL_min((quad.x + halfSize) * projection.m0 / distance, 1.0f);
+    const float bottom = SDL_max((quad.y - halfSize) * projection.m5 / distance, -1.0f);
+    const float top = SDL_min((quad.y + halfSize) * projection.m5 / distance, 1.0f);
+    if (left >= right || bottom >= top) { return 0; }
+    // Normalized device coordinates span 2 units across the viewport
+    return (right - left) * (top - bottom) * 0.25f * width * height;
+}
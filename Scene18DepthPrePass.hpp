@@ -0,0 +1,65 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef SCENE18DEPTHPREPASS_HPP
+#define SCENE18DEPTHPREPASS_HPP
+
+#include <SDL3/SDL_gpu.h>
+#include "Scene.hpp"
+#include "Mat4.hpp"
+#include "DrawQueue.hpp"
+
+/*
+ * Overlapping opaque quads with an expensive fragment shader, drawn through the renderer depth buffer.
+ * Up toggles the depth pre-pass, Down toggles between front to back and back to front order, the worst case
+ * without a pre-pass. Overdraw and frame time are logged every second.
+ */
+class Scene18DepthPrePass : public Scene {
+public:
+    void Load(Renderer& renderer) override;
+    bool Update(float dt) override;
+    void Draw(Renderer& renderer) override;
+    void Unload(Renderer& renderer) override;
+
+    static constexpr Uint32 QUAD_COUNT = 48;
+    static constexpr Uint64 QUAD_SEED = 0;
+    static constexpr float NEAR_PLANE = 0.1f;
+    static constexpr float FAR_PLANE = 100.0f;
+    static constexpr float FIELD_OF_VIEW = 60.0f * SDL_PI_F / 180.0f;
+
+private:
+    struct Quad {
+        float x, y, z;
+        float size;
+        float tint[4];
+    };
+
+    struct NoiseUniforms {
+        float tint[4];
+        float time;
+        float padding[3];
+    };
+
+    // Pixels covered by a camera facing square: it projects to a rectangle, clipped by the viewport
+    static float ComputeCoverage(const Quad& quad, const Mat4& projection, float width, float height);
+
+    InputState inputState;
+    const char* basePath {nullptr};
+    SDL_GPUGraphicsPipeline* colorPipeline {nullptr};
+    // Color pipeline after a pre-pass: the depth is already written, only the closest fragment passes
+    SDL_GPUGraphicsPipeline* colorPipelineAfterPrePass {nullptr};
+    SDL_GPUGraphicsPipeline* depthPipeline {nullptr};
+    SDL_GPUBuffer* vertexBuffer {nullptr};
+    SDL_GPUBuffer* indexBuffer {nullptr};
+
+    DrawQueue drawQueue;
+    Quad quads[QUAD_COUNT] {};
+    bool isDepthPrePassEnabled {true};
+    bool isFrontToBack {true};
+    float time {0};
+    float timeSinceLastLog {0};
+    bool logStats {false};
+};
+
+#endif //SCENE18DEPTHPREPASS_HPP
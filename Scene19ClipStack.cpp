@@ -0,0 +1,132 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#include "Scene19ClipStack.hpp"
+#include "Renderer.hpp"
+#include <SDL3/SDL.h>
+
+void Scene19ClipStack::Load(Renderer& renderer) {
+    basePath = SDL_GetBasePath();
+    const SDL_GPUTextureFormat colorFormat = SDL_GetGPUSwapchainTextureFormat(renderer.device,
+                                                                              renderer.renderWindow);
+    clipStack.Load(renderer, basePath, colorFormat);
+
+    SDL_GPUShader* vertexShader = renderer.LoadShader(basePath, "RoundedRect.vert", 0, 1, 0, 0);
+    SDL_GPUShader* fragmentShader = renderer.LoadShader(basePath, "RoundedRect.frag", 0, 1, 0, 0);
+    SDL_GPUGraphicsPipelineCreateInfo pipelineCreateInfo = {
+        .vertex_shader = vertexShader,
+        .fragment_shader = fragmentShader,
+        .primitive_type = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST,
+        .depth_stencil_state = ClipStack::GetContentStencilState(),
+        .target_info = {
+            .color_target_descriptions = new SDL_GPUColorTargetDescription[1] {{
+                .format = colorFormat
+            }},
+            .num_color_targets = 1,
+            .depth_stencil_format = renderer.GetDepthStencilFormat(),
+            .has_depth_stencil_target = true,
+        },
+    };
+    contentPipeline = renderer.CreateGPUGraphicsPipeline(pipelineCreateInfo);
+    renderer.ReleaseShader(vertexShader);
+    renderer.ReleaseShader(fragmentShader);
+
+    viewProj = Mat4::CreateOrthographicOffCenter(0, 640, 480, 0, 0, -1);
+
+    SDL_Log("Press Left/Right to rotate the card, Up/Down to round or square its corners");
+}
+
+bool Scene19ClipStack::Update(float dt) {
+    const bool isRunning = ManageInput(inputState);
+    time += dt;
+
+    if (inputState.IsDown(DirectionalKey::Left)) { cardRotation -= CARD_TURN_SPEED * dt; }
+    if (inputState.IsDown(DirectionalKey::Right)) { cardRotation += CARD_TURN_SPEED * dt; }
+    if (inputState.IsPressed(DirectionalKey::Up)) { cardCornerRadius = CARD_CORNER_RADIUS; }
+    if (inputState.IsPressed(DirectionalKey::Down)) {
+        // Back to an axis aligned square card: the scissor rect clips it
+        cardCornerRadius = 0;
+        cardRotation = 0;
+    }
+
+    timeSinceLastLog += dt;
+    if (timeSinceLastLog >= 1.0f) {
+        timeSinceLastLog = 0;
+        logStats = true;
+    }
+
+    return isRunning;
+}
+
+void Scene19ClipStack::Draw(Renderer& renderer) {
+    if (logStats) {
+        // Stats of the previous frame
+        const RendererStats& stats = renderer.GetFrameStats();
+        SDL_Log("Draws: %u, pipeline binds: %u, scissor changes: %u",
+                stats.drawCalls, stats.pipelineBinds, stats.scissorChanges);
+        logStats = false;
+    }
+
+    renderer.BeginWithDepthStencil();
+    if (renderer.IsSwapchainTextureValid()) {
+        clipStack.Begin(renderer, viewProj);
+        renderer.BindGraphicsPipeline(contentPipeline);
+        ClipStack::DrawShape(renderer, viewProj, ClipShape { 320, 240, 320, 240 },
+                             SDL_FColor { 0.08f, 0.08f, 0.1f, 1.0f });
+
+        // Scrolling list: axis aligned, only the scissor rect changes
+        const ClipShape list { 160, 240, 120, 180 };
+        clipStack.Push(renderer, list);
+        ClipStack::DrawShape(renderer, viewProj, list, SDL_FColor { 0.15f, 0.15f, 0.2f, 1.0f });
+        const float listHeight = ROW_COUNT * ROW_HEIGHT;
+        const float scroll = SDL_fmodf(time * 40.0f, listHeight);
+        for (Uint32 row = 0; row < ROW_COUNT; ++row) {
+            // Wrap around, rows leaving the top come back at the bottom, half clipped on the way
+            float y = 60.0f + static_cast<float>(row) * ROW_HEIGHT - scroll;
+            if (y < 60.0f - ROW_HEIGHT) { y += listHeight; }
+            const float shade = row % 2 == 0 ? 0.35f : 0.25f;
+            ClipStack::DrawShape(renderer, viewProj,
+                                 ClipShape { 160, y + ROW_HEIGHT * 0.5f, 110, ROW_HEIGHT * 0.4f, 0, 8 },
+                                 SDL_FColor { shade, shade + 0.1f, 0.6f, 1.0f });
+        }
+        clipStack.Pop(renderer);
+
+        // Card: a rotated rounded rectangle, clipped by a stencil mask
+        const ClipShape card { 470, 240, 130, 170, cardRotation, cardCornerRadius };
+        if (clipStack.Push(renderer, card)) { renderer.BindGraphicsPipeline(contentPipeline); }
+        ClipStack::DrawShape(renderer, viewProj, card, SDL_FColor { 0.6f, 0.3f, 0.2f, 1.0f });
+        for (int stripe = -6; stripe <= 6; ++stripe) {
+            const float x = 470.0f + static_cast<float>(stripe) * 40.0f + 20.0f * SDL_sinf(time);
+            ClipStack::DrawShape(renderer, viewProj, ClipShape { x, 240, 8, 260, 0.5f },
+                                 SDL_FColor { 0.8f, 0.5f, 0.3f, 1.0f });
+        }
+
+        // Round window in the card: a second mask level, intersected with the card
+        const ClipShape window { 470 + 60 * SDL_cosf(time), 170, 70, 70, 0, 70 };
+        if (clipStack.Push(renderer, window)) { renderer.BindGraphicsPipeline(contentPipeline); }
+        ClipStack::DrawShape(renderer, viewProj, window, SDL_FColor { 0.2f, 0.5f, 0.8f, 1.0f });
+        for (int stripe = -4; stripe <= 4; ++stripe) {
+            const float y = 170.0f + static_cast<float>(stripe) * 24.0f + 12.0f * SDL_sinf(time * 2.0f);
+            ClipStack::DrawShape(renderer, viewProj, ClipShape { 470, y, 200, 6 },
+                                 SDL_FColor { 0.9f, 0.9f, 1.0f, 1.0f });
+        }
+        if (clipStack.Pop(renderer)) { renderer.BindGraphicsPipeline(contentPipeline); }
+
+        // Axis aligned footer in the card: a scissor rect inside the card mask
+        const ClipShape footer { 470, 330, 150, 40 };
+        clipStack.Push(renderer, footer);
+        ClipStack::DrawShape(renderer, viewProj, footer, SDL_FColor { 0.3f, 0.6f, 0.3f, 1.0f });
+        ClipStack::DrawShape(renderer, viewProj, ClipShape { 470 + 150 * SDL_sinf(time), 330, 40, 60, 0, 20 },
+                             SDL_FColor { 0.9f, 0.9f, 0.4f, 1.0f });
+        clipStack.Pop(renderer);
+
+        clipStack.Pop(renderer);
+    }
+    renderer.End();
+}
+
+void Scene19ClipStack::Unload(Renderer& renderer) {
+    clipStack.Unload(renderer);
+    renderer.ReleaseGraphicsPipeline(contentPipeline);
+}
@@ -0,0 +1,44 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef SCENE19CLIPSTACK_HPP
+#define SCENE19CLIPSTACK_HPP
+
+#include <SDL3/SDL_gpu.h>
+#include "Scene.hpp"
+#include "Mat4.hpp"
+#include "ClipStack.hpp"
+
+/*
+ * Nested UI clipping: a scrolling list clipped by the scissor rect, and a card clipped by a stencil mask, with a
+ * round mask and a scissor rect nested inside. Left/Right rotate the card, Up/Down round or square its corners:
+ * square and unrotated, it is clipped by the scissor rect only.
+ */
+class Scene19ClipStack : public Scene {
+public:
+    void Load(Renderer& renderer) override;
+    bool Update(float dt) override;
+    void Draw(Renderer& renderer) override;
+    void Unload(Renderer& renderer) override;
+
+    static constexpr Uint32 ROW_COUNT = 12;
+    static constexpr float ROW_HEIGHT = 50.0f;
+    static constexpr float CARD_CORNER_RADIUS = 24.0f;
+    static constexpr float CARD_TURN_SPEED = 0.8f; // Radians per second
+
+private:
+    InputState inputState;
+    const char* basePath {nullptr};
+    SDL_GPUGraphicsPipeline* contentPipeline {nullptr};
+    ClipStack clipStack;
+    Mat4 viewProj;
+
+    float cardRotation {0};
+    float cardCornerRadius {CARD_CORNER_RADIUS};
+    float time {0};
+    float timeSinceLastLog {0};
+    bool logStats {false};
+};
+
+#endif //SCENE19CLIPSTACK_HPP
@@ -0,0 +1,78 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#include "Scene20Text.hpp"
+#include "Renderer.hpp"
+#include "GlyphAtlas.hpp"
+#include <SDL3/SDL.h>
+
+void Scene20Text::Load(Renderer& renderer) {
+    basePath = SDL_GetBasePath();
+    textRenderer.Load(renderer, basePath, MAX_GLYPHS,
+                      SDL_GetGPUSwapchainTextureFormat(renderer.device, renderer.renderWindow));
+    viewProj = Mat4::CreateOrthographicOffCenter(0, 640, 480, 0, 0, -1);
+
+    // One string, laid out once
+    char line[128];
+    for (Uint32 i = 0; i < PAGE_LINE_COUNT; ++i) {
+        SDL_snprintf(line, sizeof(line), "%02u The quick brown fox jumps over the lazy dog. 0123456789 ()[]!?\n", i);
+        pageText += line;
+    }
+
+    SDL_Log("Press Left/Right to scale the title, Up/Down for SDF or bitmap page text");
+}
+
+bool Scene20Text::Update(float dt) {
+    const bool isRunning = ManageInput(inputState);
+
+    if (inputState.IsDown(DirectionalKey::Left)) {
+        titleScale = SDL_max(titleScale - TITLE_ZOOM_SPEED * dt, TITLE_SCALE_MIN);
+    }
+    if (inputState.IsDown(DirectionalKey::Right)) {
+        titleScale = SDL_min(titleScale + TITLE_ZOOM_SPEED * dt, TITLE_SCALE_MAX);
+    }
+    if (inputState.IsPressed(DirectionalKey::Up)) { pageMode = FontMode::Sdf; }
+    if (inputState.IsPressed(DirectionalKey::Down)) { pageMode = FontMode::Bitmap; }
+
+    timeSinceLastStats += dt;
+    ++framesSinceLastStats;
+    if (timeSinceLastStats >= 1.0f) {
+        updateStats = true;
+    }
+
+    return isRunning;
+}
+
+void Scene20Text::Draw(Renderer& renderer) {
+    if (updateStats) {
+        // Stats of the previous frame
+        const RendererStats& stats = renderer.GetFrameStats();
+        const float fps = timeSinceLastStats > 0 ? static_cast<float>(framesSinceLastStats) / timeSinceLastStats : 0;
+        SDL_snprintf(statsText, sizeof(statsText), "%.1f fps - %u glyphs - %u draws - %llu uploads - %u layouts",
+                     fps, textRenderer.GetGlyphCount(), stats.drawCalls,
+                     static_cast<unsigned long long>(textRenderer.GetUploadCount()),
+                     textRenderer.GetCachedLayoutCount());
+        timeSinceLastStats = 0;
+        framesSinceLastStats = 0;
+        updateStats = false;
+    }
+
+    textRenderer.Begin();
+    textRenderer.AddText("SDL3 GPU text", 16, 8, titleScale, SDL_FColor { 1.0f, 0.8f, 0.3f, 1.0f });
+    textRenderer.AddText(pageText, 16, 80, PAGE_SCALE, SDL_FColor { 0.85f, 0.9f, 1.0f, 1.0f }, pageMode);
+    textRenderer.AddText(statsText, 16, 470 - GlyphAtlas::LINE_HEIGHT * 0.25f, 0.25f,
+                         SDL_FColor { 0.5f, 1.0f, 0.5f, 1.0f }, FontMode::Bitmap);
+    // Skipped unless some text changed
+    textRenderer.Upload(renderer);
+
+    renderer.Begin();
+    if (renderer.IsSwapchainTextureValid()) {
+        textRenderer.Draw(renderer, viewProj);
+    }
+    renderer.End();
+}
+
+void Scene20Text::Unload(Renderer& renderer) {
+    textRenderer.Unload(renderer);
+}
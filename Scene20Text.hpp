@@ -0,0 +1,48 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef SCENE20TEXT_HPP
+#define SCENE20TEXT_HPP
+
+#include <SDL3/SDL_gpu.h>
+#include "Scene.hpp"
+#include "Mat4.hpp"
+#include "TextRenderer.hpp"
+
+/*
+ * A page of static text and a stats line refreshed every second, all drawn with one draw call. The stats line shows
+ * how many frames uploaded their glyphs: only the frames where some text changed do.
+ * Left/Right scale the SDF title, Up/Down switch the page between SDF and bitmap glyphs.
+ */
+class Scene20Text : public Scene {
+public:
+    void Load(Renderer& renderer) override;
+    bool Update(float dt) override;
+    void Draw(Renderer& renderer) override;
+    void Unload(Renderer& renderer) override;
+
+    static constexpr Uint32 MAX_GLYPHS = 16384;
+    static constexpr Uint32 PAGE_LINE_COUNT = 28;
+    // 6 x 13 pixel glyphs, from the second mip level of the atlas in bitmap mode
+    static constexpr float PAGE_SCALE = 0.25f;
+    static constexpr float TITLE_SCALE_MIN = 0.25f;
+    static constexpr float TITLE_SCALE_MAX = 3.0f;
+    static constexpr float TITLE_ZOOM_SPEED = 1.5f; // Scale per second
+
+private:
+    InputState inputState;
+    const char* basePath {nullptr};
+    TextRenderer textRenderer;
+    Mat4 viewProj;
+
+    string pageText;
+    char statsText[128] {};
+    FontMode pageMode {FontMode::Sdf};
+    float titleScale {1.0f};
+    float timeSinceLastStats {0};
+    Uint32 framesSinceLastStats {0};
+    bool updateStats {true};
+};
+
+#endif //SCENE20TEXT_HPP
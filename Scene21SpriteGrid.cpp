@@ -0,0 +1,316 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#include "Scene21SpriteGrid.hpp"
+#include "Renderer.hpp"
+#include "Random.hpp"
+#include "TaskScheduler.hpp"
+#include <SDL3/SDL.h>
+
+void Scene21SpriteGrid::Load(Renderer& renderer) {
+    basePath = SDL_GetBasePath();
+    vertexShader = renderer.LoadShader(basePath, "TexturedQuadColorWithMatrix.vert", 0, 1, 0, 0);
+    fragmentShader = renderer.LoadShader(basePath, "TexturedQuadColor.frag", 1, 0, 0, 0);
+
+    // Create the pipelines
+    // -- Graphics pipeline, same as the sprite batch of Scene11
+    SDL_GPUVertexBufferDescription vertexBufferDescription {
+        .slot = 0,
+        .pitch = sizeof(PositionTextureColorVertex),
+        .input_rate = SDL_GPU_VERTEXINPUTRATE_VERTEX,
+        .instance_step_rate = 0,
+    };
+    SDL_GPUVertexAttribute vertexAttributes[3] {
+        { .location = 0, .buffer_slot = 0, .format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT4, .offset = 0 },
+        { .location = 1, .buffer_slot = 0, .format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT2, .offset = 16 },
+        { .location = 2, .buffer_slot = 0, .format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT4, .offset = 32 },
+    };
+    SDL_GPUColorTargetDescription colorTargetDescription {
+        .format = SDL_GetGPUSwapchainTextureFormat(renderer.device, renderer.renderWindow)
+    };
+    SDL_GPUGraphicsPipelineCreateInfo graphicsPipelineCreateInfo = {
+        .vertex_shader = vertexShader,
+        .fragment_shader = fragmentShader,
+        .vertex_input_state = {
+            .vertex_buffer_descriptions = &vertexBufferDescription,
+            .num_vertex_buffers = 1,
+            .vertex_attributes = vertexAttributes,
+            .num_vertex_attributes = 3,
+        },
+        .primitive_type = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST,
+        .target_info = {
+            .color_target_descriptions = &colorTargetDescription,
+            .num_color_targets = 1,
+        },
+    };
+    graphicsPipeline = SDL_CreateGPUGraphicsPipeline(renderer.device, &graphicsPipelineCreateInfo);
+    if (graphicsPipeline == nullptr) {
+        SDL_Log("Failed to create sprite grid pipeline!");
+    }
+    SDL_ReleaseGPUShader(renderer.device, vertexShader);
+    SDL_ReleaseGPUShader(renderer.device, fragmentShader);
+
+    // -- Compute pipeline
+    SDL_GPUComputePipelineCreateInfo computePipelineCreateInfo = {
+        .num_readonly_storage_buffers = 1,
+        .num_readwrite_storage_textures = 0,
+        .num_readwrite_storage_buffers = 1,
+        .num_uniform_buffers = 1,
+        .threadcount_x = 64,
+        .threadcount_y = 1,
+        .threadcount_z = 1,
+    };
+    computePipeline = renderer.CreateComputePipelineFromShader(basePath, "SpriteBatch.comp",
+                                                               &computePipelineCreateInfo);
+
+    // Texture resources
+    SDL_Surface* imageData = renderer.LoadBMPImage(basePath, "ravioli.bmp", 4);
+    if (imageData == nullptr) {
+        SDL_Log("Could not load image data!");
+        return;
+    }
+    sampler = renderer.CreateSampler(SDL_GPUSamplerCreateInfo {
+        .min_filter = SDL_GPU_FILTER_NEAREST,
+        .mag_filter = SDL_GPU_FILTER_NEAREST,
+        .mipmap_mode = SDL_GPU_SAMPLERMIPMAPMODE_NEAREST,
+        .address_mode_u = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
+        .address_mode_v = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
+        .address_mode_w = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
+    });
+    SDL_GPUTextureCreateInfo textureInfo {
+        .type = SDL_GPU_TEXTURETYPE_2D,
+        .format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM,
+        .usage = SDL_GPU_TEXTUREUSAGE_SAMPLER,
+        .width = static_cast<Uint32>(imageData->w),
+        .height = static_cast<Uint32>(imageData->h),
+        .layer_count_or_depth = 1,
+        .num_levels = 1,
+    };
+    texture = renderer.CreateTexture(textureInfo);
+    renderer.SetTextureName(texture, "Ravioli Texture");
+
+    const Uint32 textureSize = imageData->w * imageData->h * 4;
+    SDL_GPUTransferBuffer* textureTransferBuffer = renderer.CreateTransferBuffer(SDL_GPUTransferBufferCreateInfo {
+        .usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+        .size = textureSize
+    });
+    SDL_memcpy(renderer.MapTransferBuffer(textureTransferBuffer, false), imageData->pixels, textureSize);
+    renderer.UnmapTransferBuffer(textureTransferBuffer);
+
+    // Buffer resources, for the visible sprites only
+    spriteComputeBuffer = renderer.CreateBuffer(SDL_GPUBufferCreateInfo {
+        .usage = SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_READ,
+        .size = MAX_VISIBLE_SPRITES * sizeof(ComputeSpriteInstance)
+    });
+    vertexBuffer = renderer.CreateBuffer(SDL_GPUBufferCreateInfo {
+        .usage = SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_WRITE | SDL_GPU_BUFFERUSAGE_VERTEX,
+        .size = MAX_VISIBLE_SPRITES * 4 * sizeof(PositionTextureColorVertex)
+    });
+    const Uint32 indexSize = MAX_VISIBLE_SPRITES * 6 * sizeof(Uint32);
+    indexBuffer = renderer.CreateBuffer(SDL_GPUBufferCreateInfo {
+        .usage = SDL_GPU_BUFFERUSAGE_INDEX,
+        .size = indexSize
+    });
+    SDL_GPUTransferBuffer* indexTransferBuffer = renderer.CreateTransferBuffer(SDL_GPUTransferBufferCreateInfo {
+        .usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+        .size = indexSize
+    });
+    auto indices = static_cast<Uint32*>(renderer.MapTransferBuffer(indexTransferBuffer, false));
+    for (Uint32 i = 0, j = 0; i < MAX_VISIBLE_SPRITES * 6; i += 6, j += 4) {
+        indices[i]     = j;
+        indices[i + 1] = j + 1;
+        indices[i + 2] = j + 2;
+        indices[i + 3] = j + 3;
+        indices[i + 4] = j + 2;
+        indices[i + 5] = j + 1;
+    }
+    renderer.UnmapTransferBuffer(indexTransferBuffer);
+
+    renderer.BeginUploadToBuffer();
+    SDL_GPUTextureTransferInfo textureLocation { .transfer_buffer = textureTransferBuffer, .offset = 0 };
+    SDL_GPUTextureRegion textureRegion {
+        .texture = texture,
+        .w = static_cast<Uint32>(imageData->w),
+        .h = static_cast<Uint32>(imageData->h),
+        .d = 1
+    };
+    renderer.UploadToTexture(textureLocation, textureRegion, false);
+    SDL_GPUTransferBufferLocation indexLocation { .transfer_buffer = indexTransferBuffer, .offset = 0 };
+    SDL_GPUBufferRegion indexRegion { .buffer = indexBuffer, .offset = 0, .size = indexSize };
+    renderer.UploadToBuffer(indexLocation, indexRegion, false);
+    renderer.EndUploadToBuffer(indexTransferBuffer);
+    renderer.ReleaseTransferBuffer(textureTransferBuffer);
+    renderer.ReleaseSurface(imageData);
+
+    spriteComputeTransferBuffer = renderer.CreateTransferBuffer(SDL_GPUTransferBufferCreateInfo {
+        .usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+        .size = MAX_VISIBLE_SPRITES * sizeof(ComputeSpriteInstance)
+    });
+
+    // Sprites
+    positionX.resize(MOVING_SPRITE_COUNT);
+    positionY.resize(MOVING_SPRITE_COUNT);
+    velocityX.resize(MOVING_SPRITE_COUNT);
+    velocityY.resize(MOVING_SPRITE_COUNT);
+    rotations.resize(MOVING_SPRITE_COUNT);
+    Random random { SPRITE_SEED };
+    random.FillFloat(positionX.data(), MOVING_SPRITE_COUNT, 0, WORLD_SIZE - SPRITE_SIZE);
+    random.FillFloat(positionY.data(), MOVING_SPRITE_COUNT, 0, WORLD_SIZE - SPRITE_SIZE);
+    random.FillAngle(rotations.data(), MOVING_SPRITE_COUNT);
+    for (Uint32 i = 0; i < MOVING_SPRITE_COUNT; ++i) {
+        const float direction = random.NextAngle();
+        const float speed = random.NextFloat(SPEED_MIN, SPEED_MAX);
+        velocityX[i] = SDL_cosf(direction) * speed;
+        velocityY[i] = SDL_sinf(direction) * speed;
+    }
+    grid.Init(0, 0, WORLD_SIZE, WORLD_SIZE, GRID_CELL_SIZE);
+    visibleSprites.reserve(MOVING_SPRITE_COUNT);
+    cameraX = (WORLD_SIZE - 640) * 0.5f;
+    cameraY = (WORLD_SIZE - 480) * 0.5f;
+
+    SDL_Log("Press arrows to move the view over %u sprites", MOVING_SPRITE_COUNT);
+}
+
+bool Scene21SpriteGrid::Update(float dt) {
+    const bool isRunning = ManageInput(inputState);
+
+    if (inputState.IsDown(DirectionalKey::Left)) { cameraX -= CAMERA_SPEED * dt; }
+    if (inputState.IsDown(DirectionalKey::Right)) { cameraX += CAMERA_SPEED * dt; }
+    if (inputState.IsDown(DirectionalKey::Up)) { cameraY -= CAMERA_SPEED * dt; }
+    if (inputState.IsDown(DirectionalKey::Down)) { cameraY += CAMERA_SPEED * dt; }
+    cameraX = SDL_clamp(cameraX, 0.0f, WORLD_SIZE - 640);
+    cameraY = SDL_clamp(cameraY, 0.0f, WORLD_SIZE - 480);
+
+    // Bounce on the world borders
+    float* xs = positionX.data();
+    float* ys = positionY.data();
+    float* vxs = velocityX.data();
+    float* vys = velocityY.data();
+    TaskScheduler::ParallelFor(MOVING_SPRITE_COUNT, MOVE_GRAIN_SIZE, [=](Uint32 begin, Uint32 end) {
+        const float maxPosition = WORLD_SIZE - SPRITE_SIZE;
+        for (Uint32 i = begin; i < end; ++i) {
+            xs[i] += vxs[i] * dt;
+            ys[i] += vys[i] * dt;
+            if (xs[i] < 0 || xs[i] > maxPosition) {
+                vxs[i] = -vxs[i];
+                xs[i] = SDL_clamp(xs[i], 0.0f, maxPosition);
+            }
+            if (ys[i] < 0 || ys[i] > maxPosition) {
+                vys[i] = -vys[i];
+                ys[i] = SDL_clamp(ys[i], 0.0f, maxPosition);
+            }
+        }
+    });
+
+    // Grid of this frame's positions, then the viewport and the view center queries
+    Uint64 start = SDL_GetPerformanceCounter();
+    grid.Build(xs, ys, MOVING_SPRITE_COUNT);
+    const Uint64 built = SDL_GetPerformanceCounter();
+    visibleSprites.clear();
+    grid.QueryRange(cameraX - SPRITE_REACH, cameraY - SPRITE_REACH, cameraX + 640 + SPRITE_REACH,
+                    cameraY + 480 + SPRITE_REACH, visibleSprites);
+    nearestSprite = grid.QueryNearest(cameraX + 320, cameraY + 240, NEAREST_MAX_DISTANCE);
+    buildTicks += built - start;
+    queryTicks += SDL_GetPerformanceCounter() - built;
+    viewProj = Mat4::CreateOrthographicOffCenter(cameraX, cameraX + 640, cameraY + 480, cameraY, 0, -1);
+
+    timeSinceLastLog += dt;
+    ++framesSinceLastLog;
+    if (timeSinceLastLog >= 1.0f) {
+        const double tickMs = 1000.0 / static_cast<double>(SDL_GetPerformanceFrequency()) / framesSinceLastLog;
+        SDL_Log("%u sprites, %u visible (%u drawn), grid build %.3f ms, queries %.3f ms", MOVING_SPRITE_COUNT,
+                static_cast<Uint32>(visibleSprites.size()),
+                SDL_min(static_cast<Uint32>(visibleSprites.size()), MAX_VISIBLE_SPRITES),
+                static_cast<double>(buildTicks) * tickMs, static_cast<double>(queryTicks) * tickMs);
+        timeSinceLastLog = 0;
+        framesSinceLastLog = 0;
+        buildTicks = 0;
+        queryTicks = 0;
+    }
+
+    return isRunning;
+}
+
+void Scene21SpriteGrid::Draw(Renderer& renderer) {
+    const Uint32 visibleCount = SDL_min(static_cast<Uint32>(visibleSprites.size()), MAX_VISIBLE_SPRITES);
+    if (visibleCount > 0) {
+        UploadVisibleSprites(renderer);
+    }
+
+    renderer.Begin();
+    if (visibleCount > 0) {
+        renderer.BindGraphicsPipeline(graphicsPipeline);
+        SDL_GPUBufferBinding vertexBindings { .buffer = vertexBuffer, .offset = 0 };
+        renderer.BindVertexBuffers(0, vertexBindings, 1);
+        SDL_GPUBufferBinding indexBindings { .buffer = indexBuffer, .offset = 0 };
+        renderer.BindIndexBuffer(indexBindings, SDL_GPU_INDEXELEMENTSIZE_32BIT);
+        renderer.BindFragmentSamplers(0, SDL_GPUTextureSamplerBinding { .texture = texture, .sampler = sampler }, 1);
+        renderer.PushVertexUniformData(0, &viewProj, sizeof(Mat4));
+        renderer.DrawIndexedPrimitives(static_cast<int>(visibleCount * 6), 1, 0, 0, 0);
+    }
+    renderer.End();
+}
+
+void Scene21SpriteGrid::UploadVisibleSprites(Renderer& renderer) {
+    const Uint32 visibleCount = SDL_min(static_cast<Uint32>(visibleSprites.size()), MAX_VISIBLE_SPRITES);
+    auto instances = static_cast<ComputeSpriteInstance*>(
+            renderer.MapTransferBuffer(spriteComputeTransferBuffer, true)
+    );
+    const Uint32* visible = visibleSprites.data();
+    const float* xs = positionX.data();
+    const float* ys = positionY.data();
+    const float* spriteRotations = rotations.data();
+    const Uint32 nearest = nearestSprite;
+    const float centerX = cameraX + 320;
+    const float centerY = cameraY + 240;
+    TaskScheduler::ParallelFor(visibleCount, MOVE_GRAIN_SIZE / 4, [=](Uint32 begin, Uint32 end) {
+        for (Uint32 i = begin; i < end; ++i) {
+            const Uint32 sprite = visible[i];
+            const float dx = xs[sprite] - centerX;
+            const float dy = ys[sprite] - centerY;
+            const bool isNeighbour = dx * dx + dy * dy <= NEIGHBOUR_RADIUS * NEIGHBOUR_RADIUS;
+            instances[i] = ComputeSpriteInstance {
+                .x = xs[sprite],
+                .y = ys[sprite],
+                .z = 0,
+                .rotation = spriteRotations[sprite],
+                .w = SPRITE_SIZE,
+                .h = SPRITE_SIZE,
+                .r = 1.0f,
+                .g = sprite == nearest ? 0.2f : 1.0f,
+                .b = sprite == nearest || isNeighbour ? 0.2f : 1.0f,
+                .a = 1.0f,
+            };
+        }
+    });
+    renderer.UnmapTransferBuffer(spriteComputeTransferBuffer);
+
+    renderer.BeginUploadToBuffer();
+    SDL_GPUTransferBufferLocation transferLocation { .transfer_buffer = spriteComputeTransferBuffer, .offset = 0 };
+    SDL_GPUBufferRegion bufferRegion {
+        .buffer = spriteComputeBuffer,
+        .offset = 0,
+        .size = static_cast<Uint32>(visibleCount * sizeof(ComputeSpriteInstance))
+    };
+    renderer.UploadToBuffer(transferLocation, bufferRegion, true);
+    renderer.EndUploadToBuffer(spriteComputeTransferBuffer, false);
+
+    SDL_GPUStorageBufferReadWriteBinding bufferBinding { .buffer = vertexBuffer, .cycle = true };
+    renderer.BeginCompute(nullptr, 0, &bufferBinding, 1);
+    renderer.BindComputePipeline(computePipeline);
+    renderer.BindComputeStorageBuffers(0, spriteComputeBuffer, 1);
+    renderer.DispatchComputeForSize(visibleCount, 1, 1, 0);
+    renderer.EndCompute();
+}
+
+void Scene21SpriteGrid::Unload(Renderer& renderer) {
+    renderer.ReleaseBuffer(vertexBuffer);
+    renderer.ReleaseBuffer(indexBuffer);
+    renderer.ReleaseBuffer(spriteComputeBuffer);
+    renderer.ReleaseTransferBuffer(spriteComputeTransferBuffer);
+    renderer.ReleaseSampler(sampler);
+    renderer.ReleaseTexture(texture);
+    renderer.ReleaseGraphicsPipeline(graphicsPipeline);
+    renderer.ReleaseComputePipeline(computePipeline);
+}
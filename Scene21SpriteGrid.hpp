@@ -0,0 +1,82 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef SCENE21SPRITEGRID_HPP
+#define SCENE21SPRITEGRID_HPP
+
+#include <SDL3/SDL_gpu.h>
+#include "Scene.hpp"
+#include "Mat4.hpp"
+#include "SpatialGrid.hpp"
+#include "PositionTextureVertex.hpp"
+
+/*
+ * Sprites bouncing in a world much larger than the screen. A SpatialGrid of the sprites is rebuilt every frame, and
+ * only the sprites it finds in the viewport are uploaded to the sprite batch. The sprite nearest to the view center
+ * is red, the ones around it yellow. Arrows move the view.
+ */
+class Scene21SpriteGrid : public Scene {
+public:
+    void Load(Renderer& renderer) override;
+    bool Update(float dt) override;
+    void Draw(Renderer& renderer) override;
+    void Unload(Renderer& renderer) override;
+
+    static constexpr Uint32 MOVING_SPRITE_COUNT = 65536;
+    // Size of the sprite batch buffers: visible sprites past it are not drawn
+    static constexpr Uint32 MAX_VISIBLE_SPRITES = 8192;
+    // Sprites moved per task
+    static constexpr Uint32 MOVE_GRAIN_SIZE = 4096;
+    static constexpr float WORLD_SIZE = 4096.0f;
+    static constexpr float SPRITE_SIZE = 32.0f;
+    // Sprites rotate around their top left corner, which is their grid point: they reach their diagonal away from it
+    static constexpr float SPRITE_REACH = SPRITE_SIZE * 1.4143f;
+    static constexpr float GRID_CELL_SIZE = 64.0f;
+    static constexpr float SPEED_MIN = 20.0f;
+    static constexpr float SPEED_MAX = 120.0f;
+    static constexpr float CAMERA_SPEED = 800.0f;
+    static constexpr float NEAREST_MAX_DISTANCE = 256.0f;
+    static constexpr float NEIGHBOUR_RADIUS = 96.0f;
+    static constexpr Uint64 SPRITE_SEED = 21;
+
+private:
+    // Visible sprites to the transfer buffer, then through the sprite batch compute to the screen
+    void UploadVisibleSprites(Renderer& renderer);
+
+    InputState inputState;
+    const char* basePath {nullptr};
+    SDL_GPUShader* vertexShader {nullptr};
+    SDL_GPUShader* fragmentShader {nullptr};
+    SDL_GPUGraphicsPipeline* graphicsPipeline {nullptr};
+
+    SDL_GPUComputePipeline* computePipeline {nullptr};
+    SDL_GPUTexture* texture {nullptr};
+    SDL_GPUSampler* sampler {nullptr};
+
+    Mat4 viewProj;
+    SDL_GPUBuffer* spriteComputeBuffer {nullptr};
+    SDL_GPUBuffer* vertexBuffer {nullptr};
+    SDL_GPUBuffer* indexBuffer {nullptr};
+    SDL_GPUTransferBuffer* spriteComputeTransferBuffer {nullptr};
+
+    // Sprites, top left corners
+    vector<float> positionX;
+    vector<float> positionY;
+    vector<float> velocityX;
+    vector<float> velocityY;
+    vector<float> rotations;
+
+    SpatialGrid grid;
+    vector<Uint32> visibleSprites;
+    Uint32 nearestSprite {SpatialGrid::NONE};
+    float cameraX {0};
+    float cameraY {0};
+
+    float timeSinceLastLog {0};
+    Uint32 framesSinceLastLog {0};
+    Uint64 buildTicks {0};
+    Uint64 queryTicks {0};
+};
+
+#endif //SCENE21SPRITEGRID_HPP
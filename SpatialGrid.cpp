@@ -0,0 +1,174 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#include "SpatialGrid.hpp"
+#include "TaskScheduler.hpp"
+#include <SDL3/SDL.h>
+
+void SpatialGrid::Init(float minX, float minY, float width, float height, float cellSize_) {
+    originX = minX;
+    originY = minY;
+    cellSize = cellSize_;
+    inverseCellSize = 1.0f / cellSize;
+    columnCount = SDL_max(static_cast<Uint32>(SDL_ceilf(width * inverseCellSize)), 1u);
+    rowCount = SDL_max(static_cast<Uint32>(SDL_ceilf(height * inverseCellSize)), 1u);
+    cellStarts.assign(columnCount * rowCount + 1, 0);
+    sortedItems.clear();
+    sortedX.clear();
+    sortedY.clear();
+}
+
+void SpatialGrid::Build(const float* xs, const float* ys, Uint32 count) {
+    const Uint32 cellCount = columnCount * rowCount;
+    // A chunk per thread at most: every chunk adds a count per cell to clear and to sum
+    const Uint32 maxChunkCount = SDL_clamp(TaskScheduler::GetThreadCount(), 1u, MAX_CHUNK_COUNT);
+    const Uint32 chunkSize = SDL_max(MIN_CHUNK_SIZE, (count + maxChunkCount - 1) / maxChunkCount);
+    const Uint32 chunkCount = (count + chunkSize - 1) / chunkSize;
+    // Items are visited in the order of the previous build. Most items stay in their cell from a frame to the next,
+    // so the scatter writes almost in order, and only the reads of the item positions are random.
+    if (sortedItems.size() != count) {
+        sortedItems.resize(count);
+        for (Uint32 i = 0; i < count; ++i) {
+            sortedItems[i] = i;
+        }
+    }
+    // Sizes only change with the item count or the grid, after the first frames nothing is allocated
+    previousItems.swap(sortedItems);
+    sortedItems.resize(count);
+    sortedX.resize(count);
+    sortedY.resize(count);
+    itemCells.resize(count);
+    itemX.resize(count);
+    itemY.resize(count);
+    chunkCells.assign(static_cast<size_t>(chunkCount) * cellCount, 0);
+
+    // Count the items of each cell, per chunk
+    TaskScheduler::ParallelFor(chunkCount, 1, [=, this](Uint32 beginChunk, Uint32 endChunk) {
+        for (Uint32 chunk = beginChunk; chunk < endChunk; ++chunk) {
+            Uint32* counts = chunkCells.data() + static_cast<size_t>(chunk) * cellCount;
+            const Uint32 end = SDL_min((chunk + 1) * chunkSize, count);
+            for (Uint32 k = chunk * chunkSize; k < end; ++k) {
+                const Uint32 item = previousItems[k];
+                const float x = xs[item];
+                const float y = ys[item];
+                const Uint32 cell = GetRow(y) * columnCount + GetColumn(x);
+                itemCells[k] = cell;
+                itemX[k] = x;
+                itemY[k] = y;
+                ++counts[cell];
+            }
+        }
+    });
+
+    // Exclusive prefix sum, cell major then chunk: each chunk gets its range in each cell, in chunk order, so the
+    // sort is stable
+    Uint32 slot = 0;
+    for (Uint32 cell = 0; cell < cellCount; ++cell) {
+        cellStarts[cell] = slot;
+        for (Uint32 chunk = 0; chunk < chunkCount; ++chunk) {
+            Uint32& chunkCell = chunkCells[static_cast<size_t>(chunk) * cellCount + cell];
+            const Uint32 cellCountInChunk = chunkCell;
+            chunkCell = slot;
+            slot += cellCountInChunk;
+        }
+    }
+    cellStarts[cellCount] = slot;
+
+    // Scatter, each chunk into its own slots
+    TaskScheduler::ParallelFor(chunkCount, 1, [=, this](Uint32 beginChunk, Uint32 endChunk) {
+        for (Uint32 chunk = beginChunk; chunk < endChunk; ++chunk) {
+            Uint32* slots = chunkCells.data() + static_cast<size_t>(chunk) * cellCount;
+            const Uint32 end = SDL_min((chunk + 1) * chunkSize, count);
+            for (Uint32 k = chunk * chunkSize; k < end; ++k) {
+                const Uint32 destination = slots[itemCells[k]]++;
+                sortedItems[destination] = previousItems[k];
+                sortedX[destination] = itemX[k];
+                sortedY[destination] = itemY[k];
+            }
+        }
+    });
+}
+
+void SpatialGrid::QueryRange(float minX, float minY, float maxX, float maxY, vector<Uint32>& outItems) const {
+    if (minX > maxX || minY > maxY) { return; }
+    const Uint32 firstColumn = GetColumn(minX);
+    const Uint32 lastColumn = GetColumn(maxX);
+    const Uint32 firstRow = GetRow(minY);
+    const Uint32 lastRow = GetRow(maxY);
+    for (Uint32 row = firstRow; row <= lastRow; ++row) {
+        // The cells of a row are contiguous
+        const Uint32 begin = cellStarts[row * columnCount + firstColumn];
+        const Uint32 end = cellStarts[row * columnCount + lastColumn + 1];
+        for (Uint32 i = begin; i < end; ++i) {
+            if (sortedX[i] >= minX && sortedX[i] <= maxX && sortedY[i] >= minY && sortedY[i] <= maxY) {
+                outItems.push_back(sortedItems[i]);
+            }
+        }
+    }
+}
+
+Uint32 SpatialGrid::QueryNearest(float x, float y, float maxDistance) const {
+    const Uint32 column = GetColumn(x);
+    const Uint32 row = GetRow(y);
+    float bestDistanceSquared = maxDistance * maxDistance;
+    Uint32 bestItem = NONE;
+    const Uint32 maxRing = SDL_max(columnCount, rowCount);
+    for (Uint32 ring = 0; ring <= maxRing; ++ring) {
+        // Items of this ring, and of the next ones, are at least ring - 1 cells away on one axis
+        if (ring > 1) {
+            const float ringDistance = static_cast<float>(ring - 1) * cellSize;
+            if (ringDistance * ringDistance >= bestDistanceSquared) { break; }
+        }
+
+        const Uint32 firstColumn = column >= ring ? column - ring : 0;
+        const Uint32 lastColumn = SDL_min(column + ring, columnCount - 1);
+        // Top and bottom sides whole, left and right sides without their corners
+        if (row >= ring) {
+            FindNearestInRow(row - ring, firstColumn, lastColumn, x, y, bestDistanceSquared, bestItem);
+        }
+        if (ring > 0 && row + ring < rowCount) {
+            FindNearestInRow(row + ring, firstColumn, lastColumn, x, y, bestDistanceSquared, bestItem);
+        }
+        if (ring == 0) { continue; }
+        const Uint32 firstRow = row >= ring - 1 ? row - (ring - 1) : 0;
+        const Uint32 lastRow = SDL_min(row + ring - 1, rowCount - 1);
+        for (Uint32 sideRow = firstRow; sideRow <= lastRow; ++sideRow) {
+            if (column >= ring) {
+                FindNearestInRow(sideRow, column - ring, column - ring, x, y, bestDistanceSquared, bestItem);
+            }
+            if (column + ring < columnCount) {
+                FindNearestInRow(sideRow, column + ring, column + ring, x, y, bestDistanceSquared, bestItem);
+            }
+        }
+    }
+    return bestItem;
+}
+
+void SpatialGrid::FindNearestInRow(Uint32 row, Uint32 firstColumn, Uint32 lastColumn, float x, float y,
+                                   float& bestDistanceSquared, Uint32& bestItem) const {
+    const Uint32 begin = cellStarts[row * columnCount + firstColumn];
+    const Uint32 end = cellStarts[row * columnCount + lastColumn + 1];
+    for (Uint32 i = begin; i < end; ++i) {
+        const float dx = sortedX[i] - x;
+        const float dy = sortedY[i] - y;
+        const float distanceSquared = dx * dx + dy * dy;
+        // Ties go to the lowest index, so that the result does not depend on the cell order
+        if (distanceSquared < bestDistanceSquared
+            || (distanceSquared == bestDistanceSquared && bestItem != NONE && sortedItems[i] < bestItem)) {
+            bestDistanceSquared = distanceSquared;
+            bestItem = sortedItems[i];
+        }
+    }
+}
+
+Uint32 SpatialGrid::GetColumn(float x) const {
+    // Clamped as a float, the cast of far away points would overflow
+    const float column = SDL_clamp((x - originX) * inverseCellSize, 0.0f, static_cast<float>(columnCount - 1));
+    return static_cast<Uint32>(column);
+}
+
+Uint32 SpatialGrid::GetRow(float y) const {
+    const float row = SDL_clamp((y - originY) * inverseCellSize, 0.0f, static_cast<float>(rowCount - 1));
+    return static_cast<Uint32>(row);
+}
@@ -0,0 +1,79 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef SPATIALGRID_HPP
+#define SPATIALGRID_HPP
+
+#include <SDL3/SDL_stdinc.h>
+#include <vector>
+
+using std::vector;
+
+/*
+ * Uniform grid over 2D points, e.g. sprite centers, rebuilt from scratch every frame.
+ * Build is a counting sort of the items by cell, on the task scheduler: each chunk of items counts its cells, a
+ * prefix sum gives every chunk its ranges, then the chunks scatter their items. The items of a cell, and of a row of
+ * cells, are contiguous, with their positions copied next to their indices, so queries read memory in order.
+ * Each build walks the items in the order of the previous one, so that moving items are scattered almost in order.
+ * Items outside of the grid bounds go to the border cells: queries stay exact, only slower for them.
+ */
+class SpatialGrid {
+public:
+    static constexpr Uint32 NONE = 0xFFFFFFFF;
+    // Items are split in chunks of at least MIN_CHUNK_SIZE, at most one per thread and MAX_CHUNK_COUNT. Each chunk
+    // keeps its cell counts for the scatter.
+    static constexpr Uint32 MIN_CHUNK_SIZE = 16384;
+    static constexpr Uint32 MAX_CHUNK_COUNT = 32;
+
+    // Square cells of cellSize over [minX, minX + width) x [minY, minY + height). A cell size around the query size,
+    // e.g. a few sprite sizes, keeps the cells visited per query and the items per cell low.
+    void Init(float minX, float minY, float width, float height, float cellSize);
+
+    // Replace the items with count points. Item i is at (xs[i], ys[i]).
+    void Build(const float* xs, const float* ys, Uint32 count);
+
+    // Append the items in [minX, maxX] x [minY, maxY] to outItems, in cell order. For items with a size, e.g.
+    // viewport culling of sprites, grow the rectangle by their largest extent from their point.
+    void QueryRange(float minX, float minY, float maxX, float maxY, vector<Uint32>& outItems) const;
+
+    // Nearest item to (x, y), at most maxDistance away, NONE when there is none. Rings of cells are searched
+    // outwards until no closer item can remain.
+    Uint32 QueryNearest(float x, float y, float maxDistance) const;
+
+    Uint32 GetColumnCount() const { return columnCount; }
+    Uint32 GetRowCount() const { return rowCount; }
+    Uint32 GetItemCount() const { return static_cast<Uint32>(sortedItems.size()); }
+
+private:
+    // Cell coordinates, clamped to the grid
+    Uint32 GetColumn(float x) const;
+    Uint32 GetRow(float y) const;
+
+    // Nearest item of the cells [firstColumn, lastColumn] of a row, if closer than bestDistanceSquared
+    void FindNearestInRow(Uint32 row, Uint32 firstColumn, Uint32 lastColumn, float x, float y,
+                          float& bestDistanceSquared, Uint32& bestItem) const;
+
+    float originX { 0 };
+    float originY { 0 };
+    float cellSize { 1 };
+    float inverseCellSize { 1 };
+    Uint32 columnCount { 1 };
+    Uint32 rowCount { 1 };
+
+    // Items of cell c, row major, are in [cellStarts[c], cellStarts[c + 1])
+    vector<Uint32> cellStarts;
+    vector<Uint32> sortedItems;
+    vector<float> sortedX;
+    vector<float> sortedY;
+
+    // Build scratch, kept to not allocate every frame. Item k of the walk is previousItems[k].
+    vector<Uint32> previousItems;
+    vector<Uint32> itemCells;
+    vector<float> itemX;
+    vector<float> itemY;
+    // Cell counts, then first slots, of each chunk, chunk major
+    vector<Uint32> chunkCells;
+};
+
+#endif //SPATIALGRID_HPP
@@ -0,0 +1,364 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#include "TaskScheduler.hpp"
+#include <SDL3/SDL.h>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using std::unique_ptr;
+using std::vector;
+
+namespace {
+    /*
+     * Chase-Lev deque, with the memory orders of Le et al., "Correct and Efficient Work-Stealing for Weak Memory
+     * Models". Only the owner pushes and pops, at the bottom. Any thread steals, at the top. Fixed capacity.
+     */
+    class WorkStealingDeque {
+    public:
+        bool Push(Task* task) {
+            const Sint64 b = bottom.load(std::memory_order_relaxed);
+            const Sint64 t = top.load(std::memory_order_acquire);
+            if (b - t >= static_cast<Sint64>(TaskScheduler::DEQUE_CAPACITY)) { return false; }
+            buffer[b & MASK].store(task, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return true;
+        }
+
+        Task* Pop() {
+            const Sint64 b = bottom.load(std::memory_order_relaxed) - 1;
+            bottom.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            Sint64 t = top.load(std::memory_order_relaxed);
+            if (t > b) {
+                bottom.store(b + 1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            Task* task = buffer[b & MASK].load(std::memory_order_relaxed);
+            if (t == b) {
+                // Last task: race the thieves for it
+                if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                    task = nullptr;
+                }
+                bottom.store(b + 1, std::memory_order_relaxed);
+            }
+            return task;
+        }
+
+        Task* Steal() {
+            Sint64 t = top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const Sint64 b = bottom.load(std::memory_order_acquire);
+            if (t >= b) { return nullptr; }
+            Task* task = buffer[t & MASK].load(std::memory_order_relaxed);
+            if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                return nullptr;
+            }
+            return task;
+        }
+
+    private:
+        static constexpr Sint64 MASK = TaskScheduler::DEQUE_CAPACITY - 1;
+        static_assert((TaskScheduler::DEQUE_CAPACITY & MASK) == 0, "Deque capacity must be a power of two");
+
+        atomic<Sint64> top { 0 };
+        atomic<Sint64> bottom { 0 };
+        atomic<Task*> buffer[TaskScheduler::DEQUE_CAPACITY] {};
+    };
+
+    // Everything a thread needs to create, queue and find tasks. Only the owner thread allocates from the pool.
+    struct ThreadSlot {
+        WorkStealingDeque deque;
+        unique_ptr<Task[]> taskPool { new Task[TaskScheduler::TASK_POOL_SIZE] };
+        Uint32 nextTask { 0 };
+        Uint32 randomState { 1 };
+    };
+
+    static_assert((TaskScheduler::TASK_POOL_SIZE & (TaskScheduler::TASK_POOL_SIZE - 1)) == 0,
+                  "Task pool size must be a power of two");
+
+    // Idle workers spin this many times before they sleep
+    constexpr Uint32 IDLE_SPIN_COUNT = 256;
+
+    // Workers first, then the slots of external threads
+    vector<unique_ptr<ThreadSlot>> slots;
+    vector<SDL_Thread*> workers;
+    atomic<Uint32> externalThreadCount { 0 };
+    atomic<Uint32> sleepingWorkerCount { 0 };
+    atomic<bool> isRunning { false };
+    SDL_Semaphore* wakeSemaphore { nullptr };
+    // Bumped by Close, so that threads do not keep a slot of a previous Init
+    atomic<Uint32> generation { 1 };
+
+    thread_local ThreadSlot* currentSlot { nullptr };
+    thread_local Uint32 currentGeneration { 0 };
+
+    ThreadSlot* GetCurrentSlot() {
+        const Uint32 currentSchedulerGeneration = generation.load(std::memory_order_acquire);
+        if (currentGeneration == currentSchedulerGeneration) { return currentSlot; }
+
+        // First use from a thread that is not a worker
+        currentGeneration = currentSchedulerGeneration;
+        currentSlot = nullptr;
+        if (!isRunning.load(std::memory_order_acquire)) { return nullptr; }
+        const Uint32 index = externalThreadCount.fetch_add(1, std::memory_order_relaxed);
+        if (index >= TaskScheduler::MAX_EXTERNAL_THREADS) {
+            SDL_Log("TaskScheduler: too many external threads, tasks of this thread run inline");
+            return nullptr;
+        }
+        currentSlot = slots[workers.size() + index].get();
+        return currentSlot;
+    }
+
+    void Execute(Task* task);
+
+    void Schedule(Task* task) {
+        ThreadSlot* slot = GetCurrentSlot();
+        if (slot == nullptr || !slot->deque.Push(task)) {
+            Execute(task);
+            return;
+        }
+        // Pairs with the fence of sleeping workers: either they see this task, or this sees them sleeping
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleepingWorkerCount.load(std::memory_order_relaxed) > 0) {
+            SDL_SignalSemaphore(wakeSemaphore);
+        }
+    }
+
+    void Finish(Task* task) {
+        // Read before the count reaches zero: from then on, the owner thread may reuse the task
+        Task* parent = task->parent;
+        const Uint32 dependentCount = task->dependentCount;
+        Task* dependents[Task::MAX_DEPENDENTS];
+        for (Uint32 i = 0; i < dependentCount; ++i) {
+            dependents[i] = task->dependents[i];
+        }
+        if (task->unfinishedCount.fetch_sub(1, std::memory_order_acq_rel) != 1) { return; }
+
+        for (Uint32 i = 0; i < dependentCount; ++i) {
+            if (dependents[i]->pendingDependencyCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                Schedule(dependents[i]);
+            }
+        }
+        if (parent != nullptr) {
+            Finish(parent);
+        }
+    }
+
+    void Execute(Task* task) {
+        if (task->function != nullptr) {
+            task->function(task->data, task->begin, task->end);
+        }
+        Finish(task);
+    }
+
+    Task* FindTask(ThreadSlot* slot) {
+        if (slot != nullptr) {
+            if (Task* task = slot->deque.Pop()) { return task; }
+        }
+        const auto slotCount = static_cast<Uint32>(slots.size());
+        if (slotCount == 0) { return nullptr; }
+
+        // Start from a random victim, so that thieves spread over the deques
+        Uint32 start = 0;
+        if (slot != nullptr) {
+            slot->randomState ^= slot->randomState << 13;
+            slot->randomState ^= slot->randomState >> 17;
+            slot->randomState ^= slot->randomState << 5;
+            start = slot->randomState % slotCount;
+        }
+        for (Uint32 i = 0; i < slotCount; ++i) {
+            ThreadSlot* victim = slots[(start + i) % slotCount].get();
+            if (victim == slot) { continue; }
+            if (Task* task = victim->deque.Steal()) { return task; }
+        }
+        return nullptr;
+    }
+
+    int SDLCALL WorkerThread(void* userData) {
+        currentSlot = static_cast<ThreadSlot*>(userData);
+        currentGeneration = generation.load(std::memory_order_acquire);
+
+        Uint32 idleSpins = 0;
+        while (isRunning.load(std::memory_order_acquire)) {
+            if (Task* task = FindTask(currentSlot)) {
+                Execute(task);
+                idleSpins = 0;
+                continue;
+            }
+            if (++idleSpins < IDLE_SPIN_COUNT) {
+                SDL_CPUPauseInstruction();
+                continue;
+            }
+
+            sleepingWorkerCount.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            // Check again: a task may have been queued before this worker was counted as sleeping
+            Task* task = FindTask(currentSlot);
+            if (task == nullptr && isRunning.load(std::memory_order_acquire)) {
+                SDL_WaitSemaphore(wakeSemaphore);
+            }
+            sleepingWorkerCount.fetch_sub(1, std::memory_order_relaxed);
+            if (task != nullptr) {
+                Execute(task);
+            }
+            idleSpins = 0;
+        }
+        return 0;
+    }
+
+    // Next finished task of the ring pool. A thread that waits keeps creating tasks for the work it steals, so
+    // a slot can still be in flight when the ring wraps: it is skipped. When the whole pool is in flight, run
+    // queued tasks until one finishes.
+    Task* AllocateTask(Task* pool, Uint32& nextTask, ThreadSlot* slot) {
+        while (true) {
+            for (Uint32 i = 0; i < TaskScheduler::TASK_POOL_SIZE; ++i) {
+                Task* task = &pool[nextTask++ & (TaskScheduler::TASK_POOL_SIZE - 1)];
+                if (task->unfinishedCount.load(std::memory_order_acquire) == 0) { return task; }
+            }
+            if (Task* other = FindTask(slot)) {
+                Execute(other);
+            }
+        }
+    }
+
+    struct ParallelForData {
+        const function<void(Uint32, Uint32)>* body;
+        Uint32 grainSize;
+        Task* root;
+    };
+
+    // Split off the upper half as a task until the range fits the grain, then run the lower part here
+    void ParallelForRange(void* data, Uint32 begin, Uint32 end) {
+        auto parallelFor = static_cast<ParallelForData*>(data);
+        while (end - begin > parallelFor->grainSize) {
+            const Uint32 middle = begin + (end - begin) / 2;
+            TaskScheduler::Run(TaskScheduler::CreateTask(ParallelForRange, data, middle, end, parallelFor->root));
+            end = middle;
+        }
+        (*parallelFor->body)(begin, end);
+    }
+}
+
+void TaskScheduler::Init(Uint32 workerCount) {
+    if (isRunning.load()) { Close(); }
+    if (workerCount == DEFAULT_WORKER_COUNT) {
+        workerCount = static_cast<Uint32>(SDL_max(SDL_GetNumLogicalCPUCores() - 1, 0));
+    }
+
+    for (Uint32 i = 0; i < workerCount + MAX_EXTERNAL_THREADS; ++i) {
+        slots.emplace_back(new ThreadSlot);
+        slots.back()->randomState = 0x9E3779B9u * (i + 1);
+    }
+    externalThreadCount.store(0);
+    wakeSemaphore = SDL_CreateSemaphore(0);
+    isRunning.store(true, std::memory_order_release);
+
+    for (Uint32 i = 0; i < workerCount; ++i) {
+        SDL_Thread* thread = SDL_CreateThread(WorkerThread, "Task Worker", slots[i].get());
+        if (thread == nullptr) {
+            SDL_Log("Could not create a task worker: %s", SDL_GetError());
+            break;
+        }
+        workers.push_back(thread);
+    }
+    // Slots of workers that failed to start become extra external slots, still stolen from
+}
+
+void TaskScheduler::Close() {
+    if (!isRunning.load()) { return; }
+    isRunning.store(false, std::memory_order_release);
+    for (size_t i = 0; i < workers.size(); ++i) {
+        SDL_SignalSemaphore(wakeSemaphore);
+    }
+    for (SDL_Thread* thread : workers) {
+        SDL_WaitThread(thread, nullptr);
+    }
+    workers.clear();
+    slots.clear();
+    SDL_DestroySemaphore(wakeSemaphore);
+    wakeSemaphore = nullptr;
+    generation.fetch_add(1, std::memory_order_release);
+}
+
+Uint32 TaskScheduler::GetThreadCount() {
+    return static_cast<Uint32>(workers.size()) + 1;
+}
+
+Task* TaskScheduler::CreateTask(TaskFunction function, void* data, Uint32 begin, Uint32 end, Task* parent) {
+    // Threads without a slot use a pool of their own, their tasks run inline
+    thread_local unique_ptr<Task[]> inlinePool;
+    thread_local Uint32 inlineNextTask { 0 };
+
+    ThreadSlot* slot = GetCurrentSlot();
+    Task* task;
+    if (slot != nullptr) {
+        task = AllocateTask(slot->taskPool.get(), slot->nextTask, slot);
+    } else {
+        if (!inlinePool) { inlinePool.reset(new Task[TASK_POOL_SIZE]); }
+        task = AllocateTask(inlinePool.get(), inlineNextTask, nullptr);
+    }
+
+    task->function = function;
+    task->data = data;
+    task->begin = begin;
+    task->end = end;
+    task->parent = parent;
+    task->unfinishedCount.store(1, std::memory_order_relaxed);
+    task->pendingDependencyCount.store(1, std::memory_order_relaxed);
+    task->dependentCount = 0;
+    if (parent != nullptr) {
+        parent->unfinishedCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    return task;
+}
+
+bool TaskScheduler::AddDependency(Task* dependent, Task* dependency) {
+    if (dependency->dependentCount >= Task::MAX_DEPENDENTS) { return false; }
+    dependency->dependents[dependency->dependentCount++] = dependent;
+    dependent->pendingDependencyCount.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void TaskScheduler::Run(Task* task) {
+    // The extra count of CreateTask is the Run itself
+    if (task->pendingDependencyCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        Schedule(task);
+    }
+}
+
+void TaskScheduler::Wait(const Task* task) {
+    ThreadSlot* slot = GetCurrentSlot();
+    Uint32 idleSpins = 0;
+    while (!IsFinished(task)) {
+        if (Task* other = FindTask(slot)) {
+            Execute(other);
+            idleSpins = 0;
+        } else if (++idleSpins < IDLE_SPIN_COUNT) {
+            SDL_CPUPauseInstruction();
+        } else {
+            // The last tasks run on other threads: let them have the core
+            std::this_thread::yield();
+        }
+    }
+}
+
+void TaskScheduler::ParallelFor(Uint32 count, Uint32 grainSize,
+                                const function<void(Uint32 begin, Uint32 end)>& body) {
+    if (count == 0) { return; }
+    // Bound the leaf count, so that a parallel for does not fill the task pools
+    grainSize = SDL_max(SDL_max(grainSize, 1u), (count + TASK_POOL_SIZE / 2 - 1) / (TASK_POOL_SIZE / 2));
+    if (count <= grainSize || workers.empty()) {
+        body(0, count);
+        return;
+    }
+
+    ParallelForData data { &body, grainSize, nullptr };
+    Task* root = CreateTask(ParallelForRange, &data, 0, count);
+    data.root = root;
+    Run(root);
+    Wait(root);
+}
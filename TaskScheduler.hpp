@@ -0,0 +1,88 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef TASKSCHEDULER_HPP
+#define TASKSCHEDULER_HPP
+
+#include <SDL3/SDL_stdinc.h>
+#include <atomic>
+#include <functional>
+
+using std::atomic;
+using std::function;
+
+// Work of a task, on the range given at creation
+using TaskFunction = void (*)(void* data, Uint32 begin, Uint32 end);
+
+/*
+ * A unit of work. Tasks come from per thread ring pools of TASK_POOL_SIZE, a slot is reused once its task has
+ * finished: do not keep task pointers after waiting for them.
+ */
+struct Task {
+    static constexpr Uint32 MAX_DEPENDENTS = 8;
+
+    TaskFunction function { nullptr };
+    void* data { nullptr };
+    Uint32 begin { 0 };
+    Uint32 end { 0 };
+    Task* parent { nullptr };
+    // The task itself and its unfinished children
+    atomic<Uint32> unfinishedCount { 0 };
+    // Unfinished dependencies, plus one until Run is called
+    atomic<Uint32> pendingDependencyCount { 0 };
+    Task* dependents[MAX_DEPENDENTS] {};
+    Uint32 dependentCount { 0 };
+};
+
+/*
+ * Work stealing task scheduler for CPU frame work.
+ *
+ * Each worker thread owns a Chase-Lev deque: it pushes and pops at the bottom, idle workers steal from the top of
+ * the others. Threads that are not workers, like the main or the simulation thread, get their own deque the first
+ * time they use the scheduler, up to MAX_EXTERNAL_THREADS. A thread that waits executes tasks meanwhile, so waiting
+ * from inside a task cannot deadlock.
+ *
+ * Calls are static, like the other utilities: Init once, then use from any thread.
+ */
+class TaskScheduler {
+public:
+    static constexpr Uint32 TASK_POOL_SIZE = 4096;
+    static constexpr Uint32 DEQUE_CAPACITY = 4096;
+    static constexpr Uint32 MAX_EXTERNAL_THREADS = 4;
+    // Init worker count for one worker per logical core but one
+    static constexpr Uint32 DEFAULT_WORKER_COUNT = 0xFFFFFFFF;
+
+    // Start workerCount threads, none for 0: tasks then run on the threads that use the scheduler.
+    // The calling thread also runs tasks.
+    static void Init(Uint32 workerCount = DEFAULT_WORKER_COUNT);
+
+    // Wait for the workers to stop. Tasks still queued are dropped.
+    static void Close();
+
+    // Worker threads plus the calling thread
+    static Uint32 GetThreadCount();
+
+    // The task does not start before Run. With a parent, waiting for the parent also waits for this task.
+    static Task* CreateTask(TaskFunction function, void* data, Uint32 begin = 0, Uint32 end = 0,
+                            Task* parent = nullptr);
+
+    // dependent starts once dependency has finished. Declare it before running either task.
+    // Returns false when dependency has MAX_DEPENDENTS already.
+    static bool AddDependency(Task* dependent, Task* dependency);
+
+    // Queue the task on the calling thread deque, or run it now if the deque is full
+    static void Run(Task* task);
+
+    // Execute tasks until this one and its children have finished
+    static void Wait(const Task* task);
+
+    static bool IsFinished(const Task* task) { return task->unfinishedCount.load(std::memory_order_acquire) == 0; }
+
+    // Call body on sub ranges of [0, count) of at most grainSize items, in parallel, and wait for all of them.
+    // Ranges are split in halves on demand, so idle threads steal large ranges first.
+    static void ParallelFor(Uint32 count, Uint32 grainSize, const function<void(Uint32 begin, Uint32 end)>& body);
+};
+
+
+#endif //TASKSCHEDULER_HPP
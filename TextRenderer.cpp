@@ -0,0 +1,361 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#include "TextRenderer.hpp"
+#include "GlyphAtlas.hpp"
+#include "Renderer.hpp"
+#include "Mat4.hpp"
+#include <SDL3/SDL.h>
+
+namespace {
+    // Down to 8 x 16 pixel cells, for small bitmap text
+    constexpr Uint32 ATLAS_MIP_LEVELS = 3;
+    // Font modes of GlyphBatch.comp and Text.frag
+    constexpr float BITMAP_MODE = 0.0f;
+    constexpr float SDF_MODE = 1.0f;
+    constexpr float SOLID_MODE = 2.0f;
+    constexpr Uint32 VERTICES_PER_GLYPH = 4;
+    constexpr Uint32 INDICES_PER_GLYPH = 6;
+}
+
+void TextRenderer::Load(Renderer& renderer, const char* basePath, Uint32 maxGlyphs_,
+                        SDL_GPUTextureFormat colorFormat, SDL_GPUTextureFormat depthStencilFormat) {
+    maxGlyphs = maxGlyphs_;
+    instances.reserve(maxGlyphs);
+    uploadedInstances.reserve(maxGlyphs);
+
+    // Pipelines
+    SDL_GPUShader* vertexShader = renderer.LoadShader(basePath, "Text.vert", 0, 1, 0, 0);
+    SDL_GPUShader* fragmentShader = renderer.LoadShader(basePath, "Text.frag", 1, 0, 0, 0);
+    SDL_GPUVertexBufferDescription vertexBufferDescription {
+        .slot = 0,
+        .pitch = sizeof(PositionTextureColorVertex),
+        .input_rate = SDL_GPU_VERTEXINPUTRATE_VERTEX,
+        .instance_step_rate = 0,
+    };
+    // The texture coordinates carry the font mode in the vertex padding
+    SDL_GPUVertexAttribute vertexAttributes[3] {{
+        .location = 0,
+        .buffer_slot = 0,
+        .format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT4,
+        .offset = 0
+    }, {
+        .location = 1,
+        .buffer_slot = 0,
+        .format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT4,
+        .offset = 16
+    }, {
+        .location = 2,
+        .buffer_slot = 0,
+        .format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT4,
+        .offset = 32
+    }};
+    SDL_GPUColorTargetDescription colorTarget {
+        .format = colorFormat,
+        .blend_state = {
+            .src_color_blendfactor = SDL_GPU_BLENDFACTOR_SRC_ALPHA,
+            .dst_color_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+            .color_blend_op = SDL_GPU_BLENDOP_ADD,
+            .src_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ONE,
+            .dst_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+            .alpha_blend_op = SDL_GPU_BLENDOP_ADD,
+            .enable_blend = true,
+        }
+    };
+    SDL_GPUGraphicsPipelineCreateInfo pipelineCreateInfo = {
+        .vertex_shader = vertexShader,
+        .fragment_shader = fragmentShader,
+        .vertex_input_state = {
+            .vertex_buffer_descriptions = &vertexBufferDescription,
+            .num_vertex_buffers = 1,
+            .vertex_attributes = vertexAttributes,
+            .num_vertex_attributes = 3,
+        },
+        .primitive_type = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST,
+        .target_info = {
+            .color_target_descriptions = &colorTarget,
+            .num_color_targets = 1,
+            .depth_stencil_format = depthStencilFormat,
+            .has_depth_stencil_target = depthStencilFormat != SDL_GPU_TEXTUREFORMAT_INVALID,
+        },
+    };
+    pipeline = renderer.CreateGPUGraphicsPipeline(pipelineCreateInfo);
+    renderer.ReleaseShader(vertexShader);
+    renderer.ReleaseShader(fragmentShader);
+
+    SDL_GPUComputePipelineCreateInfo computePipelineCreateInfo = {
+        .num_readonly_storage_buffers = 1,
+        .num_readwrite_storage_buffers = 1,
+        .num_uniform_buffers = 1,
+        .threadcount_x = 64,
+        .threadcount_y = 1,
+        .threadcount_z = 1,
+    };
+    computePipeline = renderer.CreateComputePipelineFromShader(basePath, "GlyphBatch.comp",
+                                                               &computePipelineCreateInfo);
+
+    // Buffers
+    instanceBuffer = renderer.CreateBuffer(SDL_GPUBufferCreateInfo {
+        .usage = SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_READ,
+        .size = maxGlyphs * static_cast<Uint32>(sizeof(ComputeSpriteInstance))
+    });
+    renderer.SetBufferName(instanceBuffer, "Glyph Instances");
+    vertexBuffer = renderer.CreateBuffer(SDL_GPUBufferCreateInfo {
+        .usage = SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_WRITE | SDL_GPU_BUFFERUSAGE_VERTEX,
+        .size = maxGlyphs * VERTICES_PER_GLYPH * static_cast<Uint32>(sizeof(PositionTextureColorVertex))
+    });
+    renderer.SetBufferName(vertexBuffer, "Glyph Vertices");
+    const Uint32 indexBufferSize = maxGlyphs * INDICES_PER_GLYPH * static_cast<Uint32>(sizeof(Uint32));
+    indexBuffer = renderer.CreateBuffer(SDL_GPUBufferCreateInfo {
+        .usage = SDL_GPU_BUFFERUSAGE_INDEX,
+        .size = indexBufferSize
+    });
+    renderer.SetBufferName(indexBuffer, "Glyph Indices");
+    instanceTransferBuffer = renderer.CreateTransferBuffer(SDL_GPUTransferBufferCreateInfo {
+        .usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+        .size = maxGlyphs * static_cast<Uint32>(sizeof(ComputeSpriteInstance))
+    });
+
+    // Atlas, with its distance field built from the coverage
+    SDL_Surface* imageData = renderer.LoadBMPImage(basePath, "font_mono.bmp", 4);
+    if (imageData == nullptr) {
+        SDL_Log("Could not load the font atlas!");
+        return;
+    }
+    if (imageData->w != GlyphAtlas::WIDTH || imageData->h != GlyphAtlas::HEIGHT) {
+        SDL_Log("Font atlas is %dx%d, expected %ux%u", imageData->w, imageData->h, GlyphAtlas::WIDTH,
+                GlyphAtlas::HEIGHT);
+        renderer.ReleaseSurface(imageData);
+        return;
+    }
+    GlyphAtlas::BuildDistanceField(static_cast<Uint8*>(imageData->pixels), imageData->pitch);
+
+    // Color target usage for the mipmap generation
+    atlasTexture = renderer.CreateTexture(SDL_GPUTextureCreateInfo {
+        .type = SDL_GPU_TEXTURETYPE_2D,
+        .format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM,
+        .usage = SDL_GPU_TEXTUREUSAGE_SAMPLER | SDL_GPU_TEXTUREUSAGE_COLOR_TARGET,
+        .width = GlyphAtlas::WIDTH,
+        .height = GlyphAtlas::HEIGHT,
+        .layer_count_or_depth = 1,
+        .num_levels = ATLAS_MIP_LEVELS,
+    });
+    renderer.SetTextureName(atlasTexture, "Glyph Atlas");
+    sampler = renderer.CreateSampler(SDL_GPUSamplerCreateInfo {
+        .min_filter = SDL_GPU_FILTER_LINEAR,
+        .mag_filter = SDL_GPU_FILTER_LINEAR,
+        .mipmap_mode = SDL_GPU_SAMPLERMIPMAPMODE_LINEAR,
+        .address_mode_u = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
+        .address_mode_v = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
+        .address_mode_w = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
+    });
+
+    const Uint32 rowSize = GlyphAtlas::WIDTH * 4;
+    SDL_GPUTransferBuffer* transferBuffer = renderer.CreateTransferBuffer(SDL_GPUTransferBufferCreateInfo {
+        .usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+        .size = rowSize * GlyphAtlas::HEIGHT + indexBufferSize
+    });
+    auto transferData = static_cast<Uint8*>(renderer.MapTransferBuffer(transferBuffer, false));
+    for (Uint32 y = 0; y < GlyphAtlas::HEIGHT; ++y) {
+        SDL_memcpy(transferData + y * rowSize, static_cast<Uint8*>(imageData->pixels) + y * imageData->pitch,
+                   rowSize);
+    }
+    auto indices = reinterpret_cast<Uint32*>(transferData + rowSize * GlyphAtlas::HEIGHT);
+    for (Uint32 i = 0, j = 0; i < maxGlyphs * INDICES_PER_GLYPH; i += INDICES_PER_GLYPH, j += VERTICES_PER_GLYPH) {
+        indices[i]     = j;
+        indices[i + 1] = j + 1;
+        indices[i + 2] = j + 2;
+        indices[i + 3] = j + 3;
+        indices[i + 4] = j + 2;
+        indices[i + 5] = j + 1;
+    }
+    renderer.UnmapTransferBuffer(transferBuffer);
+    renderer.ReleaseSurface(imageData);
+
+    renderer.BeginUploadToBuffer();
+    SDL_GPUTextureTransferInfo textureSource {
+        .transfer_buffer = transferBuffer,
+        .offset = 0
+    };
+    SDL_GPUTextureRegion textureDestination {
+        .texture = atlasTexture,
+        .w = GlyphAtlas::WIDTH,
+        .h = GlyphAtlas::HEIGHT,
+        .d = 1
+    };
+    renderer.UploadToTexture(textureSource, textureDestination, false);
+    SDL_GPUTransferBufferLocation indexSource {
+        .transfer_buffer = transferBuffer,
+        .offset = rowSize * GlyphAtlas::HEIGHT
+    };
+    SDL_GPUBufferRegion indexDestination {
+        .buffer = indexBuffer,
+        .offset = 0,
+        .size = indexBufferSize
+    };
+    renderer.UploadToBuffer(indexSource, indexDestination, false);
+    renderer.EndUploadToBuffer(transferBuffer);
+    renderer.GenerateMipmaps(atlasTexture);
+}
+
+void TextRenderer::Unload(Renderer& renderer) {
+    renderer.ReleaseGraphicsPipeline(pipeline);
+    renderer.ReleaseComputePipeline(computePipeline);
+    renderer.ReleaseTexture(atlasTexture);
+    renderer.ReleaseSampler(sampler);
+    renderer.ReleaseBuffer(instanceBuffer);
+    renderer.ReleaseBuffer(vertexBuffer);
+    renderer.ReleaseBuffer(indexBuffer);
+    renderer.ReleaseTransferBuffer(instanceTransferBuffer);
+    layouts.clear();
+}
+
+void TextRenderer::Begin() {
+    ++frame;
+    instances.clear();
+    if (frame % LAYOUT_LIFETIME == 0) {
+        std::erase_if(layouts, [this](const auto& entry) {
+            return frame - entry.second.lastUsedFrame > LAYOUT_LIFETIME;
+        });
+    }
+}
+
+void TextRenderer::AddText(string_view text, float x, float y, float scale, const SDL_FColor& color,
+                           FontMode mode) {
+    const TextLayout& layout = GetLayout(text);
+    const Uint32 glyphCount = static_cast<Uint32>(layout.glyphs.size());
+    const Uint32 count = HasRoom(glyphCount) ? glyphCount : maxGlyphs - static_cast<Uint32>(instances.size());
+
+    const float width = static_cast<float>(GlyphAtlas::CELL_WIDTH) * scale;
+    const float height = static_cast<float>(GlyphAtlas::CELL_HEIGHT) * scale;
+    const float fontMode = mode == FontMode::Sdf ? SDF_MODE : BITMAP_MODE;
+    for (Uint32 i = 0; i < count; ++i) {
+        const GlyphPlacement& placement = layout.glyphs[i];
+        instances.push_back(ComputeSpriteInstance {
+            .x = x + placement.x * scale,
+            .y = y + placement.y * scale,
+            .z = 0,
+            .rotation = 0,
+            .w = width,
+            .h = height,
+            .padding_a = static_cast<float>(placement.glyph),
+            .padding_b = fontMode,
+            .r = color.r,
+            .g = color.g,
+            .b = color.b,
+            .a = color.a
+        });
+    }
+}
+
+void TextRenderer::AddRect(float x, float y, float width, float height, const SDL_FColor& color) {
+    if (!HasRoom(1)) { return; }
+    instances.push_back(ComputeSpriteInstance {
+        .x = x,
+        .y = y,
+        .z = 0,
+        .rotation = 0,
+        .w = width,
+        .h = height,
+        .padding_a = 0,
+        .padding_b = SOLID_MODE,
+        .r = color.r,
+        .g = color.g,
+        .b = color.b,
+        .a = color.a
+    });
+}
+
+void TextRenderer::MeasureText(string_view text, float scale, float& outWidth, float& outHeight) {
+    const TextLayout& layout = GetLayout(text);
+    outWidth = layout.width * scale;
+    outHeight = layout.height * scale;
+}
+
+void TextRenderer::Upload(Renderer& renderer) {
+    const Uint32 count = static_cast<Uint32>(instances.size());
+    const Uint32 size = count * static_cast<Uint32>(sizeof(ComputeSpriteInstance));
+    if (count == uploadedInstances.size() && SDL_memcmp(instances.data(), uploadedInstances.data(), size) == 0) {
+        return;
+    }
+    // Within the reserved capacity, no allocation
+    uploadedInstances.assign(instances.begin(), instances.end());
+    if (count == 0) { return; }
+    ++uploadCount;
+
+    SDL_memcpy(renderer.MapTransferBuffer(instanceTransferBuffer, true), instances.data(), size);
+    renderer.UnmapTransferBuffer(instanceTransferBuffer);
+    renderer.BeginUploadToBuffer();
+    SDL_GPUTransferBufferLocation source {
+        .transfer_buffer = instanceTransferBuffer,
+        .offset = 0
+    };
+    SDL_GPUBufferRegion destination {
+        .buffer = instanceBuffer,
+        .offset = 0,
+        .size = size
+    };
+    renderer.UploadToBuffer(source, destination, true);
+    renderer.EndUploadToBuffer(instanceTransferBuffer, false);
+
+    // Previous frames may still draw the old vertices
+    SDL_GPUStorageBufferReadWriteBinding bufferBinding {
+        .buffer = vertexBuffer,
+        .cycle = true
+    };
+    renderer.BeginCompute(nullptr, 0, &bufferBinding, 1);
+    renderer.BindComputePipeline(computePipeline);
+    renderer.BindComputeStorageBuffers(0, instanceBuffer, 1);
+    renderer.DispatchComputeForSize(count, 1, 1, 0);
+    renderer.EndCompute();
+}
+
+void TextRenderer::Draw(Renderer& renderer, const Mat4& viewProjection) const {
+    if (uploadedInstances.empty()) { return; }
+
+    renderer.BindGraphicsPipeline(pipeline);
+    SDL_GPUBufferBinding vertexBinding { .buffer = vertexBuffer, .offset = 0 };
+    renderer.BindVertexBuffers(0, vertexBinding, 1);
+    SDL_GPUBufferBinding indexBinding { .buffer = indexBuffer, .offset = 0 };
+    renderer.BindIndexBuffer(indexBinding, SDL_GPU_INDEXELEMENTSIZE_32BIT);
+    renderer.BindFragmentSamplers(0, SDL_GPUTextureSamplerBinding { .texture = atlasTexture, .sampler = sampler }, 1);
+    renderer.PushVertexUniformData(0, &viewProjection, sizeof(Mat4));
+    renderer.DrawIndexedPrimitives(static_cast<int>(uploadedInstances.size() * INDICES_PER_GLYPH), 1, 0, 0, 0);
+}
+
+bool TextRenderer::HasRoom(Uint32 count) {
+    if (instances.size() + count <= maxGlyphs) { return true; }
+    if (!hasDroppedGlyphs) {
+        SDL_Log("TextRenderer: more than %u glyphs in a frame, the glyphs past it are dropped", maxGlyphs);
+        hasDroppedGlyphs = true;
+    }
+    return false;
+}
+
+const TextRenderer::TextLayout& TextRenderer::GetLayout(string_view text) {
+    auto found = layouts.find(text);
+    if (found == layouts.end()) {
+        // Spaces and line breaks only move the pen
+        TextLayout layout { .width = 0, .height = 0, .lastUsedFrame = frame };
+        layout.glyphs.reserve(text.size());
+        float x = 0;
+        float y = 0;
+        for (const char character : text) {
+            if (character == '\n') {
+                x = 0;
+                y += GlyphAtlas::LINE_HEIGHT;
+                continue;
+            }
+            if (character != ' ') {
+                layout.glyphs.push_back(GlyphPlacement { x, y, GlyphAtlas::GetGlyph(character) });
+            }
+            x += GlyphAtlas::ADVANCE;
+            layout.width = SDL_max(layout.width, x);
+        }
+        layout.height = text.empty() ? 0 : y + GlyphAtlas::LINE_HEIGHT;
+        found = layouts.emplace(string(text), std::move(layout)).first;
+    }
+    found->second.lastUsedFrame = frame;
+    return found->second;
+}
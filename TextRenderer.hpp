@@ -0,0 +1,116 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef TEXTRENDERER_HPP
+#define TEXTRENDERER_HPP
+
+#include <SDL3/SDL_gpu.h>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "PositionTextureVertex.hpp"
+
+using std::vector;
+using std::string;
+using std::string_view;
+using std::unordered_map;
+
+class Renderer;
+class Mat4;
+
+enum class FontMode : Uint8 {
+    Bitmap, // Atlas coverage, sharpest at scale 1 and its power of two fractions
+    Sdf, // Signed distance field, sharp edges at any scale
+};
+
+/*
+ * Text drawn from the GlyphAtlas font, batched like the sprites of Scene11: each glyph is a ComputeSpriteInstance,
+ * expanded to a quad by GlyphBatch.comp, and every glyph of the frame, bitmap or SDF, is drawn with a single
+ * indexed draw, along with solid rectangles.
+ * Glyph placements are cached per string, so a string that was already laid out is only copied into the instances.
+ * Instance storage is reserved at load: static text allocates nothing per frame, and when the glyphs are the same
+ * as in the previous frame, neither the upload nor the expansion run again.
+ */
+class TextRenderer {
+public:
+    // Frames a layout stays cached after its last use, e.g. for the strings of a counter
+    static constexpr Uint64 LAYOUT_LIFETIME = 120;
+
+    // The pipeline draws into colorFormat targets, in passes with a depthStencilFormat target when it is valid
+    void Load(Renderer& renderer, const char* basePath, Uint32 maxGlyphs, SDL_GPUTextureFormat colorFormat,
+              SDL_GPUTextureFormat depthStencilFormat = SDL_GPU_TEXTUREFORMAT_INVALID);
+
+    void Unload(Renderer& renderer);
+
+    // Start the text of a frame
+    void Begin();
+
+    // (x, y) is the top left of the first line. At scale 1, glyphs advance GlyphAtlas::ADVANCE and lines
+    // GlyphAtlas::LINE_HEIGHT. Glyphs past maxGlyphs are dropped.
+    void AddText(string_view text, float x, float y, float scale, const SDL_FColor& color,
+                 FontMode mode = FontMode::Sdf);
+
+    // Solid rectangle in the same batch as the glyphs, e.g. a panel behind text or the bar of a graph
+    void AddRect(float x, float y, float width, float height, const SDL_FColor& color);
+
+    // Size of the text box at this scale
+    void MeasureText(string_view text, float scale, float& outWidth, float& outHeight);
+
+    // Upload and expand the glyphs of the frame, unless they did not change. Call outside of a render pass.
+    void Upload(Renderer& renderer);
+
+    // Draw every glyph, with the view projection at vertex uniform slot 0
+    void Draw(Renderer& renderer, const Mat4& viewProjection) const;
+
+    Uint32 GetGlyphCount() const { return static_cast<Uint32>(instances.size()); }
+    Uint32 GetCachedLayoutCount() const { return static_cast<Uint32>(layouts.size()); }
+    // Frames whose glyphs were uploaded, the others reused the previous vertices
+    Uint64 GetUploadCount() const { return uploadCount; }
+
+private:
+    struct GlyphPlacement {
+        float x, y; // At scale 1, from the top left of the text
+        Uint32 glyph;
+    };
+
+    struct TextLayout {
+        vector<GlyphPlacement> glyphs;
+        float width;
+        float height;
+        Uint64 lastUsedFrame;
+    };
+
+    // Lets string_view find string keys without building a string
+    struct StringHash {
+        using is_transparent = void;
+        size_t operator()(string_view text) const { return std::hash<string_view> {}(text); }
+    };
+
+    const TextLayout& GetLayout(string_view text);
+
+    // False, and logged once, when the frame already has maxGlyphs instances
+    bool HasRoom(Uint32 count);
+
+    SDL_GPUGraphicsPipeline* pipeline { nullptr };
+    SDL_GPUComputePipeline* computePipeline { nullptr };
+    SDL_GPUTexture* atlasTexture { nullptr };
+    SDL_GPUSampler* sampler { nullptr };
+    SDL_GPUBuffer* instanceBuffer { nullptr };
+    SDL_GPUBuffer* vertexBuffer { nullptr };
+    SDL_GPUBuffer* indexBuffer { nullptr };
+    SDL_GPUTransferBuffer* instanceTransferBuffer { nullptr };
+
+    unordered_map<string, TextLayout, StringHash, std::equal_to<>> layouts;
+    vector<ComputeSpriteInstance> instances;
+    // Glyphs in the vertex buffer
+    vector<ComputeSpriteInstance> uploadedInstances;
+    Uint32 maxGlyphs { 0 };
+    Uint64 frame { 0 };
+    Uint64 uploadCount { 0 };
+    // Logged once
+    bool hasDroppedGlyphs { false };
+};
+
+#endif //TEXTRENDERER_HPP
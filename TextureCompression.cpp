@@ -0,0 +1,1107 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#include "TextureCompression.hpp"
+
+#include <SDL3/SDL_log.h>
+#include <SDL3/SDL_iostream.h>
+#include <cstring>
+
+namespace {
+
+    // -- File helpers
+
+    Uint32 ReadUint32LE(const Uint8* data) {
+        return static_cast<Uint32>(data[0]) | (static_cast<Uint32>(data[1]) << 8) |
+               (static_cast<Uint32>(data[2]) << 16) | (static_cast<Uint32>(data[3]) << 24);
+    }
+
+    Uint32 ReadUint24LE(const Uint8* data) {
+        return static_cast<Uint32>(data[0]) | (static_cast<Uint32>(data[1]) << 8) |
+               (static_cast<Uint32>(data[2]) << 16);
+    }
+
+    bool LoadWholeFile(const char* path, vector<Uint8>& outData) {
+        size_t fileSize;
+        void* fileData = SDL_LoadFile(path, &fileSize);
+        if (fileData == nullptr) {
+            SDL_Log("Failed to load file %s: %s", path, SDL_GetError());
+            return false;
+        }
+        outData.resize(fileSize);
+        std::memcpy(outData.data(), fileData, fileSize);
+        SDL_free(fileData);
+        return true;
+    }
+
+    // -- ASTC
+
+    const Uint8 ASTC_ERROR_COLOR[4] { 255, 0, 255, 255 };
+
+    struct ASTCBlockFormat {
+        Uint32 blockWidth;
+        Uint32 blockHeight;
+        SDL_GPUTextureFormat format;
+    };
+
+    const ASTCBlockFormat ASTC_FORMATS[] {
+        { 4, 4, SDL_GPU_TEXTUREFORMAT_ASTC_4x4_UNORM },
+        { 5, 4, SDL_GPU_TEXTUREFORMAT_ASTC_5x4_UNORM },
+        { 5, 5, SDL_GPU_TEXTUREFORMAT_ASTC_5x5_UNORM },
+        { 6, 5, SDL_GPU_TEXTUREFORMAT_ASTC_6x5_UNORM },
+        { 6, 6, SDL_GPU_TEXTUREFORMAT_ASTC_6x6_UNORM },
+        { 8, 5, SDL_GPU_TEXTUREFORMAT_ASTC_8x5_UNORM },
+        { 8, 6, SDL_GPU_TEXTUREFORMAT_ASTC_8x6_UNORM },
+        { 8, 8, SDL_GPU_TEXTUREFORMAT_ASTC_8x8_UNORM },
+        { 10, 5, SDL_GPU_TEXTUREFORMAT_ASTC_10x5_UNORM },
+        { 10, 6, SDL_GPU_TEXTUREFORMAT_ASTC_10x6_UNORM },
+        { 10, 8, SDL_GPU_TEXTUREFORMAT_ASTC_10x8_UNORM },
+        { 10, 10, SDL_GPU_TEXTUREFORMAT_ASTC_10x10_UNORM },
+        { 12, 10, SDL_GPU_TEXTUREFORMAT_ASTC_12x10_UNORM },
+        { 12, 12, SDL_GPU_TEXTUREFORMAT_ASTC_12x12_UNORM },
+    };
+
+    // Integer sequence encoding ranges: number of levels, trits, quints, bits
+    struct ISERange {
+        Uint32 levels;
+        Uint32 trits;
+        Uint32 quints;
+        Uint32 bits;
+    };
+
+    const ISERange ISE_RANGES[] {
+        { 2, 0, 0, 1 }, { 3, 1, 0, 0 }, { 4, 0, 0, 2 }, { 5, 0, 1, 0 }, { 6, 1, 0, 1 },
+        { 8, 0, 0, 3 }, { 10, 0, 1, 1 }, { 12, 1, 0, 2 }, { 16, 0, 0, 4 }, { 20, 0, 1, 2 },
+        { 24, 1, 0, 3 }, { 32, 0, 0, 5 }, { 40, 0, 1, 3 }, { 48, 1, 0, 4 }, { 64, 0, 0, 6 },
+        { 80, 0, 1, 4 }, { 96, 1, 0, 5 }, { 128, 0, 0, 7 }, { 160, 0, 1, 5 }, { 192, 1, 0, 6 },
+        { 256, 0, 0, 8 },
+    };
+    const int ISE_RANGE_COUNT = sizeof(ISE_RANGES) / sizeof(ISERange);
+    // Smallest range usable for color endpoints (6 levels)
+    const int ISE_MIN_COLOR_RANGE = 4;
+
+    Uint32 ISEBitCount(int rangeIndex, Uint32 count) {
+        const ISERange& range = ISE_RANGES[rangeIndex];
+        return count * range.bits
+               + (range.trits ? (8 * count + 4) / 5 : 0)
+               + (range.quints ? (7 * count + 2) / 3 : 0);
+    }
+
+    // Reads bits from a 128 bits block, LSB first. Bits at or after limit read as zero.
+    class BlockBitReader {
+    public:
+        BlockBitReader(const Uint8* data_, Uint32 start, Uint32 limit_) : data { data_ }, position { start },
+                                                                            limit { limit_ } {}
+
+        Uint32 Read(Uint32 count) {
+            Uint32 result = 0;
+            for (Uint32 i = 0; i < count; ++i, ++position) {
+                if (position < limit && position < 128) {
+                    result |= ((data[position >> 3] >> (position & 7)) & 1u) << i;
+                }
+            }
+            return result;
+        }
+
+    private:
+        const Uint8* data;
+        Uint32 position;
+        Uint32 limit;
+    };
+
+    Uint32 ReadBlockBits(const Uint8* block, Uint32 start, Uint32 count) {
+        BlockBitReader reader { block, start, 128 };
+        return reader.Read(count);
+    }
+
+    void DecodeTrits(Uint32 T, Uint32* t) {
+        Uint32 C;
+        if (((T >> 2) & 7) == 7) {
+            C = (((T >> 5) & 7) << 2) | (T & 3);
+            t[4] = 2;
+            t[3] = 2;
+        } else {
+            C = T & 0x1F;
+            if (((T >> 5) & 3) == 3) {
+                t[4] = 2;
+                t[3] = (T >> 7) & 1;
+            } else {
+                t[4] = (T >> 7) & 1;
+                t[3] = (T >> 5) & 3;
+            }
+        }
+
+        if ((C & 3) == 3) {
+            t[2] = 2;
+            t[1] = (C >> 4) & 1;
+            t[0] = (((C >> 3) & 1) << 1) | (((C >> 2) & 1) & (((C >> 3) & 1) ^ 1));
+        } else if (((C >> 2) & 3) == 3) {
+            t[2] = 2;
+            t[1] = 2;
+            t[0] = C & 3;
+        } else {
+            t[2] = (C >> 4) & 1;
+            t[1] = (C >> 2) & 3;
+            t[0] = (((C >> 1) & 1) << 1) | ((C & 1) & (((C >> 1) & 1) ^ 1));
+        }
+    }
+
+    void DecodeQuints(Uint32 Q, Uint32* q) {
+        if (((Q >> 1) & 3) == 3 && ((Q >> 5) & 3) == 0) {
+            const Uint32 notQ0 = (Q & 1) ^ 1;
+            q[2] = ((Q & 1) << 2) | ((((Q >> 4) & 1) & notQ0) << 1) | (((Q >> 3) & 1) & notQ0);
+            q[1] = 4;
+            q[0] = 4;
+            return;
+        }
+
+        Uint32 C;
+        if (((Q >> 1) & 3) == 3) {
+            q[2] = 4;
+            C = (((Q >> 3) & 3) << 3) | (((~Q >> 5) & 3) << 1) | (Q & 1);
+        } else {
+            q[2] = (Q >> 5) & 3;
+            C = Q & 0x1F;
+        }
+
+        if ((C & 7) == 5) {
+            q[1] = 4;
+            q[0] = (C >> 3) & 3;
+        } else {
+            q[1] = (C >> 3) & 3;
+            q[0] = C & 7;
+        }
+    }
+
+    // Decode count integer sequence encoded values
+    void DecodeISE(BlockBitReader& reader, int rangeIndex, Uint32 count, Uint32* outValues) {
+        const ISERange& range = ISE_RANGES[rangeIndex];
+        const Uint32 bits = range.bits;
+        Uint32 decoded = 0;
+
+        if (range.trits) {
+            while (decoded < count) {
+                Uint32 m[5];
+                Uint32 T = 0;
+                m[0] = reader.Read(bits);
+                T |= reader.Read(2);
+                m[1] = reader.Read(bits);
+                T |= reader.Read(2) << 2;
+                m[2] = reader.Read(bits);
+                T |= reader.Read(1) << 4;
+                m[3] = reader.Read(bits);
+                T |= reader.Read(2) << 5;
+                m[4] = reader.Read(bits);
+                T |= reader.Read(1) << 7;
+
+                Uint32 t[5];
+                DecodeTrits(T, t);
+                for (int i = 0; i < 5 && decoded < count; ++i) {
+                    outValues[decoded++] = (t[i] << bits) | m[i];
+                }
+            }
+        } else if (range.quints) {
+            while (decoded < count) {
+                Uint32 m[3];
+                Uint32 Q = 0;
+                m[0] = reader.Read(bits);
+                Q |= reader.Read(3);
+                m[1] = reader.Read(bits);
+                Q |= reader.Read(2) << 3;
+                m[2] = reader.Read(bits);
+                Q |= reader.Read(2) << 5;
+
+                Uint32 q[3];
+                DecodeQuints(Q, q);
+                for (int i = 0; i < 3 && decoded < count; ++i) {
+                    outValues[decoded++] = (q[i] << bits) | m[i];
+                }
+            }
+        } else {
+            while (decoded < count) {
+                outValues[decoded++] = reader.Read(bits);
+            }
+        }
+    }
+
+    Uint32 ReplicateBits(Uint32 value, Uint32 bits, Uint32 targetBits) {
+        Uint32 result = 0;
+        int position = static_cast<int>(targetBits);
+        while (position > 0) {
+            position -= static_cast<int>(bits);
+            result |= position >= 0 ? value << position : value >> -position;
+        }
+        return result & ((1u << targetBits) - 1);
+    }
+
+    Uint32 UnquantizeColor(Uint32 value, int rangeIndex) {
+        const ISERange& range = ISE_RANGES[rangeIndex];
+        if (!range.trits && !range.quints) {
+            return ReplicateBits(value, range.bits, 8);
+        }
+
+        const Uint32 a = value & 1;
+        const Uint32 b = (value >> 1) & 1;
+        const Uint32 c = (value >> 2) & 1;
+        const Uint32 d = (value >> 3) & 1;
+        const Uint32 e = (value >> 4) & 1;
+        const Uint32 f = (value >> 5) & 1;
+        const Uint32 A = a ? 0x1FF : 0;
+        const Uint32 D = value >> range.bits;
+        Uint32 B = 0;
+        Uint32 C = 0;
+
+        if (range.trits) {
+            switch (range.bits) {
+                case 1: C = 204; break;
+                case 2: B = (b << 8) | (b << 4) | (b << 2) | (b << 1); C = 93; break;
+                case 3: B = (c << 8) | (b << 7) | (c << 3) | (b << 2) | (c << 1) | b; C = 44; break;
+                case 4: B = (d << 8) | (c << 7) | (b << 6) | (d << 2) | (c << 1) | b; C = 22; break;
+                case 5: B = (e << 8) | (d << 7) | (c << 6) | (b << 5) | (e << 1) | d; C = 11; break;
+                case 6: B = (f << 8) | (e << 7) | (d << 6) | (c << 5) | (b << 4) | f; C = 5; break;
+                default: break;
+            }
+        } else {
+            switch (range.bits) {
+                case 1: C = 113; break;
+                case 2: B = (b << 8) | (b << 3) | (b << 2); C = 54; break;
+                case 3: B = (c << 8) | (b << 7) | (c << 2) | (b << 1) | c; C = 26; break;
+                case 4: B = (d << 8) | (c << 7) | (b << 6) | (d << 1) | c; C = 13; break;
+                case 5: B = (e << 8) | (d << 7) | (c << 6) | (b << 5) | e; C = 6; break;
+                default: break;
+            }
+        }
+
+        Uint32 T = D * C + B;
+        T ^= A;
+        return (A & 0x80) | (T >> 2);
+    }
+
+    Uint32 UnquantizeWeight(Uint32 value, int rangeIndex) {
+        const ISERange& range = ISE_RANGES[rangeIndex];
+        Uint32 result;
+        if (!range.trits && !range.quints) {
+            result = ReplicateBits(value, range.bits, 6);
+        } else if (range.bits == 0) {
+            static constexpr Uint32 TRIT_WEIGHTS[3] { 0, 32, 63 };
+            static constexpr Uint32 QUINT_WEIGHTS[5] { 0, 16, 32, 47, 63 };
+            result = range.trits ? TRIT_WEIGHTS[value] : QUINT_WEIGHTS[value];
+        } else {
+            const Uint32 a = value & 1;
+            const Uint32 b = (value >> 1) & 1;
+            const Uint32 c = (value >> 2) & 1;
+            const Uint32 A = a ? 0x7F : 0;
+            const Uint32 D = value >> range.bits;
+            Uint32 B = 0;
+            Uint32 C = 0;
+            if (range.trits) {
+                switch (range.bits) {
+                    case 1: C = 50; break;
+                    case 2: B = (b << 6) | (b << 2) | b; C = 23; break;
+                    case 3: B = (c << 6) | (b << 5) | (c << 1) | b; C = 11; break;
+                    default: break;
+                }
+            } else {
+                switch (range.bits) {
+                    case 1: C = 28; break;
+                    case 2: B = (b << 6) | (b << 1); C = 13; break;
+                    default: break;
+                }
+            }
+            Uint32 T = D * C + B;
+            T ^= A;
+            result = (A & 0x20) | (T >> 2);
+        }
+        // Map 0..63 to 0..64
+        if (result > 32) { result += 1; }
+        return result;
+    }
+
+    struct ASTCBlockMode {
+        Uint32 gridWidth;
+        Uint32 gridHeight;
+        bool isDualPlane;
+        int weightRangeIndex;
+    };
+
+    bool DecodeBlockMode(Uint32 mode, ASTCBlockMode& out) {
+        Uint32 R;
+        Uint32 highPrecision = (mode >> 9) & 1;
+        Uint32 dualPlane = (mode >> 10) & 1;
+        const Uint32 A = (mode >> 5) & 3;
+        Uint32 B;
+
+        if ((mode & 3) != 0) {
+            R = ((mode >> 4) & 1) | ((mode & 3) << 1);
+            B = (mode >> 7) & 3;
+            switch ((mode >> 2) & 3) {
+                case 0: out.gridWidth = B + 4; out.gridHeight = A + 2; break;
+                case 1: out.gridWidth = B + 8; out.gridHeight = A + 2; break;
+                case 2: out.gridWidth = A + 2; out.gridHeight = B + 8; break;
+                default:
+                    B &= 1;
+                    if ((mode >> 8) & 1) {
+                        out.gridWidth = B + 2;
+                        out.gridHeight = A + 2;
+                    } else {
+                        out.gridWidth = A + 2;
+                        out.gridHeight = B + 6;
+                    }
+                    break;
+            }
+        } else {
+            R = ((mode >> 4) & 1) | (((mode >> 2) & 3) << 1);
+            if (R < 2) { return false; }
+            switch ((mode >> 7) & 3) {
+                case 0: out.gridWidth = 12; out.gridHeight = A + 2; break;
+                case 1: out.gridWidth = A + 2; out.gridHeight = 12; break;
+                case 2:
+                    B = (mode >> 9) & 3;
+                    out.gridWidth = A + 6;
+                    out.gridHeight = B + 6;
+                    highPrecision = 0;
+                    dualPlane = 0;
+                    break;
+                default:
+                    if (A == 0) {
+                        out.gridWidth = 6;
+                        out.gridHeight = 10;
+                    } else if (A == 1) {
+                        out.gridWidth = 10;
+                        out.gridHeight = 6;
+                    } else {
+                        return false;
+                    }
+                    break;
+            }
+        }
+
+        if (R < 2) { return false; }
+        out.isDualPlane = dualPlane != 0;
+        out.weightRangeIndex = static_cast<int>(R - 2) + (highPrecision ? 6 : 0);
+        return true;
+    }
+
+    Uint32 Hash52(Uint32 p) {
+        p ^= p >> 15;
+        p -= p << 17;
+        p += p << 7;
+        p += p << 4;
+        p ^= p >> 5;
+        p += p << 16;
+        p ^= p >> 7;
+        p ^= p >> 3;
+        p ^= p << 6;
+        p ^= p >> 17;
+        return p;
+    }
+
+    Uint32 SelectPartition(Uint32 seed, Uint32 x, Uint32 y, Uint32 z, Uint32 partitionCount, bool isSmallBlock) {
+        if (isSmallBlock) {
+            x <<= 1;
+            y <<= 1;
+            z <<= 1;
+        }
+        seed += (partitionCount - 1) * 1024;
+        const Uint32 rnum = Hash52(seed);
+
+        Uint32 seeds[12];
+        seeds[0] = rnum & 0xF;
+        seeds[1] = (rnum >> 4) & 0xF;
+        seeds[2] = (rnum >> 8) & 0xF;
+        seeds[3] = (rnum >> 12) & 0xF;
+        seeds[4] = (rnum >> 16) & 0xF;
+        seeds[5] = (rnum >> 20) & 0xF;
+        seeds[6] = (rnum >> 24) & 0xF;
+        seeds[7] = (rnum >> 28) & 0xF;
+        seeds[8] = (rnum >> 18) & 0xF;
+        seeds[9] = (rnum >> 22) & 0xF;
+        seeds[10] = (rnum >> 26) & 0xF;
+        seeds[11] = ((rnum >> 30) | (rnum << 2)) & 0xF;
+        for (Uint32& s : seeds) { s *= s; }
+
+        Uint32 sh1, sh2;
+        if (seed & 1) {
+            sh1 = (seed & 2) ? 4 : 5;
+            sh2 = (partitionCount == 3) ? 6 : 5;
+        } else {
+            sh1 = (partitionCount == 3) ? 6 : 5;
+            sh2 = (seed & 2) ? 4 : 5;
+        }
+        const Uint32 sh3 = (seed & 0x10) ? sh1 : sh2;
+
+        for (int i = 0; i < 8; ++i) { seeds[i] >>= (i & 1) ? sh2 : sh1; }
+        for (int i = 8; i < 12; ++i) { seeds[i] >>= sh3; }
+
+        Uint32 a = (seeds[0] * x + seeds[1] * y + seeds[10] * z + (rnum >> 14)) & 0x3F;
+        Uint32 b = (seeds[2] * x + seeds[3] * y + seeds[11] * z + (rnum >> 10)) & 0x3F;
+        Uint32 c = (seeds[4] * x + seeds[5] * y + seeds[8] * z + (rnum >> 6)) & 0x3F;
+        Uint32 d = (seeds[6] * x + seeds[7] * y + seeds[9] * z + (rnum >> 2)) & 0x3F;
+
+        if (partitionCount < 4) { d = 0; }
+        if (partitionCount < 3) { c = 0; }
+
+        if (a >= b && a >= c && a >= d) { return 0; }
+        if (b >= c && b >= d) { return 1; }
+        if (c >= d) { return 2; }
+        return 3;
+    }
+
+    int ClampColor(int value) {
+        return value < 0 ? 0 : (value > 255 ? 255 : value);
+    }
+
+    void BitTransferSigned(int& a, int& b) {
+        b >>= 1;
+        b |= a & 0x80;
+        a >>= 1;
+        a &= 0x3F;
+        if (a & 0x20) { a -= 0x40; }
+    }
+
+    void BlueContract(int* color) {
+        color[0] = (color[0] + color[2]) >> 1;
+        color[1] = (color[1] + color[2]) >> 1;
+    }
+
+    void SetColor(int* color, int r, int g, int b, int a) {
+        color[0] = r;
+        color[1] = g;
+        color[2] = b;
+        color[3] = a;
+    }
+
+    // Decode LDR color endpoints. Returns false for HDR modes, which are not supported by the RGBA8 decoder.
+    bool DecodeEndpoints(Uint32 mode, const Uint32* values, int* e0, int* e1) {
+        int v[8] {};
+        const Uint32 valueCount = ((mode >> 2) + 1) * 2;
+        for (Uint32 i = 0; i < valueCount; ++i) { v[i] = static_cast<int>(values[i]); }
+
+        switch (mode) {
+            case 0:
+                SetColor(e0, v[0], v[0], v[0], 255);
+                SetColor(e1, v[1], v[1], v[1], 255);
+                break;
+            case 1: {
+                const int l0 = (v[0] >> 2) | (v[1] & 0xC0);
+                const int l1 = SDL_min(l0 + (v[1] & 0x3F), 255);
+                SetColor(e0, l0, l0, l0, 255);
+                SetColor(e1, l1, l1, l1, 255);
+                break;
+            }
+            case 4:
+                SetColor(e0, v[0], v[0], v[0], v[2]);
+                SetColor(e1, v[1], v[1], v[1], v[3]);
+                break;
+            case 5:
+                BitTransferSigned(v[1], v[0]);
+                BitTransferSigned(v[3], v[2]);
+                SetColor(e0, v[0], v[0], v[0], v[2]);
+                SetColor(e1, v[0] + v[1], v[0] + v[1], v[0] + v[1], v[2] + v[3]);
+                break;
+            case 6:
+                SetColor(e0, (v[0] * v[3]) >> 8, (v[1] * v[3]) >> 8, (v[2] * v[3]) >> 8, 255);
+                SetColor(e1, v[0], v[1], v[2], 255);
+                break;
+            case 8:
+                if (v[1] + v[3] + v[5] >= v[0] + v[2] + v[4]) {
+                    SetColor(e0, v[0], v[2], v[4], 255);
+                    SetColor(e1, v[1], v[3], v[5], 255);
+                } else {
+                    SetColor(e0, v[1], v[3], v[5], 255);
+                    SetColor(e1, v[0], v[2], v[4], 255);
+                    BlueContract(e0);
+                    BlueContract(e1);
+                }
+                break;
+            case 9:
+                BitTransferSigned(v[1], v[0]);
+                BitTransferSigned(v[3], v[2]);
+                BitTransferSigned(v[5], v[4]);
+                if (v[1] + v[3] + v[5] >= 0) {
+                    SetColor(e0, v[0], v[2], v[4], 255);
+                    SetColor(e1, v[0] + v[1], v[2] + v[3], v[4] + v[5], 255);
+                } else {
+                    SetColor(e0, v[0] + v[1], v[2] + v[3], v[4] + v[5], 255);
+                    SetColor(e1, v[0], v[2], v[4], 255);
+                    BlueContract(e0);
+                    BlueContract(e1);
+                }
+                break;
+            case 10:
+                SetColor(e0, (v[0] * v[3]) >> 8, (v[1] * v[3]) >> 8, (v[2] * v[3]) >> 8, v[4]);
+                SetColor(e1, v[0], v[1], v[2], v[5]);
+                break;
+            case 12:
+                if (v[1] + v[3] + v[5] >= v[0] + v[2] + v[4]) {
+                    SetColor(e0, v[0], v[2], v[4], v[6]);
+                    SetColor(e1, v[1], v[3], v[5], v[7]);
+                } else {
+                    SetColor(e0, v[1], v[3], v[5], v[7]);
+                    SetColor(e1, v[0], v[2], v[4], v[6]);
+                    BlueContract(e0);
+                    BlueContract(e1);
+                }
+                break;
+            case 13:
+                BitTransferSigned(v[1], v[0]);
+                BitTransferSigned(v[3], v[2]);
+                BitTransferSigned(v[5], v[4]);
+                BitTransferSigned(v[7], v[6]);
+                if (v[1] + v[3] + v[5] >= 0) {
+                    SetColor(e0, v[0], v[2], v[4], v[6]);
+                    SetColor(e1, v[0] + v[1], v[2] + v[3], v[4] + v[5], v[6] + v[7]);
+                } else {
+                    SetColor(e0, v[0] + v[1], v[2] + v[3], v[4] + v[5], v[6] + v[7]);
+                    SetColor(e1, v[0], v[2], v[4], v[6]);
+                    BlueContract(e0);
+                    BlueContract(e1);
+                }
+                break;
+            default:
+                // 2, 3, 7, 11, 14, 15 are HDR modes
+                return false;
+        }
+
+        for (int i = 0; i < 4; ++i) {
+            e0[i] = ClampColor(e0[i]);
+            e1[i] = ClampColor(e1[i]);
+        }
+        return true;
+    }
+
+    void FillErrorColor(Uint8* outTexels, Uint32 texelCount) {
+        for (Uint32 i = 0; i < texelCount; ++i) {
+            std::memcpy(outTexels + i * 4, ASTC_ERROR_COLOR, 4);
+        }
+    }
+
+    // -- BCn
+
+    void Decode565(Uint16 color, Uint8* out) {
+        const Uint32 r = (color >> 11) & 0x1F;
+        const Uint32 g = (color >> 5) & 0x3F;
+        const Uint32 b = color & 0x1F;
+        out[0] = static_cast<Uint8>((r << 3) | (r >> 2));
+        out[1] = static_cast<Uint8>((g << 2) | (g >> 4));
+        out[2] = static_cast<Uint8>((b << 3) | (b >> 2));
+        out[3] = 255;
+    }
+
+    void DecodeBC1Colors(const Uint8* block, bool allowPunchThrough, Uint8* outTexels) {
+        const Uint16 c0 = static_cast<Uint16>(block[0] | (block[1] << 8));
+        const Uint16 c1 = static_cast<Uint16>(block[2] | (block[3] << 8));
+        Uint8 palette[4][4];
+        Decode565(c0, palette[0]);
+        Decode565(c1, palette[1]);
+        if (c0 > c1 || !allowPunchThrough) {
+            for (int i = 0; i < 3; ++i) {
+                palette[2][i] = static_cast<Uint8>((2 * palette[0][i] + palette[1][i]) / 3);
+                palette[3][i] = static_cast<Uint8>((palette[0][i] + 2 * palette[1][i]) / 3);
+            }
+            palette[2][3] = 255;
+            palette[3][3] = 255;
+        } else {
+            for (int i = 0; i < 3; ++i) {
+                palette[2][i] = static_cast<Uint8>((palette[0][i] + palette[1][i]) / 2);
+                palette[3][i] = 0;
+            }
+            palette[2][3] = 255;
+            palette[3][3] = 0;
+        }
+
+        const Uint32 indices = ReadUint32LE(block + 4);
+        for (int i = 0; i < 16; ++i) {
+            std::memcpy(outTexels + i * 4, palette[(indices >> (i * 2)) & 3], 4);
+        }
+    }
+
+    // Decode a BC3/BC4/BC5 interpolated single channel block into one component of the output texels
+    void DecodeBCChannel(const Uint8* block, Uint8* outTexels, int component) {
+        const Uint32 a0 = block[0];
+        const Uint32 a1 = block[1];
+        Uint8 palette[8];
+        palette[0] = static_cast<Uint8>(a0);
+        palette[1] = static_cast<Uint8>(a1);
+        if (a0 > a1) {
+            for (Uint32 i = 1; i < 7; ++i) {
+                palette[i + 1] = static_cast<Uint8>(((7 - i) * a0 + i * a1) / 7);
+            }
+        } else {
+            for (Uint32 i = 1; i < 5; ++i) {
+                palette[i + 1] = static_cast<Uint8>(((5 - i) * a0 + i * a1) / 5);
+            }
+            palette[6] = 0;
+            palette[7] = 255;
+        }
+
+        Uint64 indices = 0;
+        for (int i = 0; i < 6; ++i) {
+            indices |= static_cast<Uint64>(block[2 + i]) << (8 * i);
+        }
+        for (int i = 0; i < 16; ++i) {
+            outTexels[i * 4 + component] = palette[(indices >> (i * 3)) & 7];
+        }
+    }
+
+    bool BCBlockInfo(SDL_GPUTextureFormat format, Uint32& outBlockSize) {
+        switch (format) {
+            case SDL_GPU_TEXTUREFORMAT_BC1_RGBA_UNORM:
+            case SDL_GPU_TEXTUREFORMAT_BC1_RGBA_UNORM_SRGB:
+            case SDL_GPU_TEXTUREFORMAT_BC4_R_UNORM:
+                outBlockSize = 8;
+                return true;
+            case SDL_GPU_TEXTUREFORMAT_BC2_RGBA_UNORM:
+            case SDL_GPU_TEXTUREFORMAT_BC2_RGBA_UNORM_SRGB:
+            case SDL_GPU_TEXTUREFORMAT_BC3_RGBA_UNORM:
+            case SDL_GPU_TEXTUREFORMAT_BC3_RGBA_UNORM_SRGB:
+            case SDL_GPU_TEXTUREFORMAT_BC5_RG_UNORM:
+            case SDL_GPU_TEXTUREFORMAT_BC6H_RGB_FLOAT:
+            case SDL_GPU_TEXTUREFORMAT_BC6H_RGB_UFLOAT:
+            case SDL_GPU_TEXTUREFORMAT_BC7_RGBA_UNORM:
+            case SDL_GPU_TEXTUREFORMAT_BC7_RGBA_UNORM_SRGB:
+                outBlockSize = 16;
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    Uint32 MakeFourCC(char a, char b, char c, char d) {
+        return static_cast<Uint32>(a) | (static_cast<Uint32>(b) << 8) |
+               (static_cast<Uint32>(c) << 16) | (static_cast<Uint32>(d) << 24);
+    }
+
+    SDL_GPUTextureFormat FormatFromDXGI(Uint32 dxgiFormat) {
+        switch (dxgiFormat) {
+            case 71: return SDL_GPU_TEXTUREFORMAT_BC1_RGBA_UNORM;
+            case 72: return SDL_GPU_TEXTUREFORMAT_BC1_RGBA_UNORM_SRGB;
+            case 74: return SDL_GPU_TEXTUREFORMAT_BC2_RGBA_UNORM;
+            case 75: return SDL_GPU_TEXTUREFORMAT_BC2_RGBA_UNORM_SRGB;
+            case 77: return SDL_GPU_TEXTUREFORMAT_BC3_RGBA_UNORM;
+            case 78: return SDL_GPU_TEXTUREFORMAT_BC3_RGBA_UNORM_SRGB;
+            case 80: return SDL_GPU_TEXTUREFORMAT_BC4_R_UNORM;
+            case 83: return SDL_GPU_TEXTUREFORMAT_BC5_RG_UNORM;
+            case 95: return SDL_GPU_TEXTUREFORMAT_BC6H_RGB_UFLOAT;
+            case 96: return SDL_GPU_TEXTUREFORMAT_BC6H_RGB_FLOAT;
+            case 98: return SDL_GPU_TEXTUREFORMAT_BC7_RGBA_UNORM;
+            case 99: return SDL_GPU_TEXTUREFORMAT_BC7_RGBA_UNORM_SRGB;
+            default: return SDL_GPU_TEXTUREFORMAT_INVALID;
+        }
+    }
+}
+
+bool TextureCompression::LoadASTC(const char* path, CompressedImage& outImage) {
+    vector<Uint8> fileData;
+    if (!LoadWholeFile(path, fileData)) { return false; }
+    if (!ParseASTC(fileData.data(), fileData.size(), outImage)) {
+        SDL_Log("Invalid ASTC file: %s", path);
+        return false;
+    }
+    return true;
+}
+
+bool TextureCompression::ParseASTC(const Uint8* fileData, size_t fileSize, CompressedImage& outImage) {
+    const size_t headerSize = 16;
+    if (fileSize < headerSize || ReadUint32LE(fileData) != 0x5CA1AB13) { return false; }
+
+    const Uint32 blockWidth = fileData[4];
+    const Uint32 blockHeight = fileData[5];
+    const Uint32 blockDepth = fileData[6];
+    const Uint32 width = ReadUint24LE(fileData + 7);
+    const Uint32 height = ReadUint24LE(fileData + 10);
+    const Uint32 depth = ReadUint24LE(fileData + 13);
+    if (blockDepth != 1 || depth != 1 || width == 0 || height == 0) { return false; }
+
+    SDL_GPUTextureFormat format = SDL_GPU_TEXTUREFORMAT_INVALID;
+    for (const ASTCBlockFormat& blockFormat : ASTC_FORMATS) {
+        if (blockFormat.blockWidth == blockWidth && blockFormat.blockHeight == blockHeight) {
+            format = blockFormat.format;
+        }
+    }
+    if (format == SDL_GPU_TEXTUREFORMAT_INVALID) { return false; }
+
+    outImage.format = format;
+    outImage.width = width;
+    outImage.height = height;
+    outImage.blockWidth = blockWidth;
+    outImage.blockHeight = blockHeight;
+    outImage.blockSize = 16;
+
+    const size_t dataSize = static_cast<size_t>(outImage.BlockCountX()) * outImage.BlockCountY() * 16;
+    if (fileSize < headerSize + dataSize) { return false; }
+    outImage.data.assign(fileData + headerSize, fileData + headerSize + dataSize);
+    return true;
+}
+
+bool TextureCompression::LoadDDS(const char* path, CompressedImage& outImage) {
+    vector<Uint8> fileData;
+    if (!LoadWholeFile(path, fileData)) { return false; }
+    if (!ParseDDS(fileData.data(), fileData.size(), outImage)) {
+        SDL_Log("Invalid or unsupported DDS file: %s", path);
+        return false;
+    }
+    return true;
+}
+
+bool TextureCompression::ParseDDS(const Uint8* fileData, size_t fileSize, CompressedImage& outImage) {
+    const size_t headerSize = 128;
+    const size_t dx10HeaderSize = 20;
+    if (fileSize < headerSize || ReadUint32LE(fileData) != MakeFourCC('D', 'D', 'S', ' ')) { return false; }
+
+    const Uint32 height = ReadUint32LE(fileData + 12);
+    const Uint32 width = ReadUint32LE(fileData + 16);
+    const Uint32 fourCC = ReadUint32LE(fileData + 84);
+    size_t dataOffset = headerSize;
+
+    SDL_GPUTextureFormat format = SDL_GPU_TEXTUREFORMAT_INVALID;
+    if (fourCC == MakeFourCC('D', 'X', '1', '0')) {
+        if (fileSize < headerSize + dx10HeaderSize) { return false; }
+        format = FormatFromDXGI(ReadUint32LE(fileData + headerSize));
+        dataOffset += dx10HeaderSize;
+    } else if (fourCC == MakeFourCC('D', 'X', 'T', '1')) {
+        format = SDL_GPU_TEXTUREFORMAT_BC1_RGBA_UNORM;
+    } else if (fourCC == MakeFourCC('D', 'X', 'T', '3')) {
+        format = SDL_GPU_TEXTUREFORMAT_BC2_RGBA_UNORM;
+    } else if (fourCC == MakeFourCC('D', 'X', 'T', '5')) {
+        format = SDL_GPU_TEXTUREFORMAT_BC3_RGBA_UNORM;
+    } else if (fourCC == MakeFourCC('A', 'T', 'I', '1') || fourCC == MakeFourCC('B', 'C', '4', 'U')) {
+        format = SDL_GPU_TEXTUREFORMAT_BC4_R_UNORM;
+    } else if (fourCC == MakeFourCC('A', 'T', 'I', '2') || fourCC == MakeFourCC('B', 'C', '5', 'U')) {
+        format = SDL_GPU_TEXTUREFORMAT_BC5_RG_UNORM;
+    }
+
+    Uint32 blockSize;
+    if (format == SDL_GPU_TEXTUREFORMAT_INVALID || !BCBlockInfo(format, blockSize) || width == 0 || height == 0) {
+        return false;
+    }
+
+    outImage.format = format;
+    outImage.width = width;
+    outImage.height = height;
+    outImage.blockWidth = 4;
+    outImage.blockHeight = 4;
+    outImage.blockSize = blockSize;
+
+    const size_t dataSize = static_cast<size_t>(outImage.BlockCountX()) * outImage.BlockCountY() * blockSize;
+    if (fileSize < dataOffset + dataSize) { return false; }
+    outImage.data.assign(fileData + dataOffset, fileData + dataOffset + dataSize);
+    return true;
+}
+
+bool TextureCompression::SetBlockFormat(SDL_GPUTextureFormat format, CompressedImage& outImage) {
+    for (const ASTCBlockFormat& blockFormat : ASTC_FORMATS) {
+        if (blockFormat.format == format) {
+            outImage.format = format;
+            outImage.blockWidth = blockFormat.blockWidth;
+            outImage.blockHeight = blockFormat.blockHeight;
+            outImage.blockSize = 16;
+            return true;
+        }
+    }
+    Uint32 blockSize;
+    if (!BCBlockInfo(format, blockSize)) { return false; }
+    outImage.format = format;
+    outImage.blockWidth = 4;
+    outImage.blockHeight = 4;
+    outImage.blockSize = blockSize;
+    return true;
+}
+
+bool TextureCompression::IsASTCFormat(SDL_GPUTextureFormat format) {
+    for (const ASTCBlockFormat& blockFormat : ASTC_FORMATS) {
+        if (blockFormat.format == format) { return true; }
+    }
+    return false;
+}
+
+bool TextureCompression::IsBCFormat(SDL_GPUTextureFormat format) {
+    Uint32 blockSize;
+    return BCBlockInfo(format, blockSize);
+}
+
+bool TextureCompression::CanDecode(SDL_GPUTextureFormat format) {
+    if (IsASTCFormat(format)) { return true; }
+    switch (format) {
+        case SDL_GPU_TEXTUREFORMAT_BC1_RGBA_UNORM:
+        case SDL_GPU_TEXTUREFORMAT_BC1_RGBA_UNORM_SRGB:
+        case SDL_GPU_TEXTUREFORMAT_BC2_RGBA_UNORM:
+        case SDL_GPU_TEXTUREFORMAT_BC2_RGBA_UNORM_SRGB:
+        case SDL_GPU_TEXTUREFORMAT_BC3_RGBA_UNORM:
+        case SDL_GPU_TEXTUREFORMAT_BC3_RGBA_UNORM_SRGB:
+        case SDL_GPU_TEXTUREFORMAT_BC4_R_UNORM:
+        case SDL_GPU_TEXTUREFORMAT_BC5_RG_UNORM:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool TextureCompression::DecodeToRGBA8(const CompressedImage& image, vector<Uint8>& outPixels) {
+    if (!CanDecode(image.format)) {
+        SDL_Log("No CPU decoder for texture format %d", image.format);
+        return false;
+    }
+
+    const bool isASTC = IsASTCFormat(image.format);
+    const Uint32 blockCountX = image.BlockCountX();
+    const Uint32 blockCountY = image.BlockCountY();
+    const Uint32 blockTexelCount = image.blockWidth * image.blockHeight;
+    vector<Uint8> blockTexels(blockTexelCount * 4);
+    outPixels.resize(static_cast<size_t>(image.width) * image.height * 4);
+    bool allBlocksValid = true;
+
+    for (Uint32 by = 0; by < blockCountY; ++by) {
+        for (Uint32 bx = 0; bx < blockCountX; ++bx) {
+            const Uint8* block = image.data.data() + (static_cast<size_t>(by) * blockCountX + bx) * image.blockSize;
+            const bool isValid = isASTC
+                                 ? DecodeASTCBlock(block, image.blockWidth, image.blockHeight, blockTexels.data())
+                                 : DecodeBCBlock(image.format, block, blockTexels.data());
+            allBlocksValid = allBlocksValid && isValid;
+
+            // Copy the block to the image, cropping the texels outside of the image
+            const Uint32 x0 = bx * image.blockWidth;
+            const Uint32 y0 = by * image.blockHeight;
+            const Uint32 copyWidth = SDL_min(image.blockWidth, image.width - x0);
+            const Uint32 copyHeight = SDL_min(image.blockHeight, image.height - y0);
+            for (Uint32 y = 0; y < copyHeight; ++y) {
+                std::memcpy(&outPixels[(static_cast<size_t>(y0 + y) * image.width + x0) * 4],
+                            &blockTexels[y * image.blockWidth * 4],
+                            copyWidth * 4);
+            }
+        }
+    }
+
+    if (!allBlocksValid) {
+        SDL_Log("Some blocks could not be decoded and were replaced by the error color");
+    }
+    return true;
+}
+
+bool TextureCompression::DecodeASTCBlock(const Uint8* block, Uint32 blockWidth, Uint32 blockHeight,
+                                         Uint8* outTexels) {
+    const Uint32 texelCount = blockWidth * blockHeight;
+    const Uint32 mode = ReadBlockBits(block, 0, 11);
+
+    // Void extent block: a single constant color
+    if ((mode & 0x1FF) == 0x1FC) {
+        const bool isHDR = (mode >> 9) & 1;
+        if (isHDR) {
+            FillErrorColor(outTexels, texelCount);
+            return false;
+        }
+        for (Uint32 i = 0; i < texelCount; ++i) {
+            // Colors are stored as UNORM16, keep the most significant byte
+            outTexels[i * 4] = block[9];
+            outTexels[i * 4 + 1] = block[11];
+            outTexels[i * 4 + 2] = block[13];
+            outTexels[i * 4 + 3] = block[15];
+        }
+        return true;
+    }
+
+    ASTCBlockMode blockMode {};
+    if (!DecodeBlockMode(mode, blockMode)) {
+        FillErrorColor(outTexels, texelCount);
+        return false;
+    }
+
+    const Uint32 planeCount = blockMode.isDualPlane ? 2 : 1;
+    const Uint32 gridTexelCount = blockMode.gridWidth * blockMode.gridHeight;
+    const Uint32 weightCount = gridTexelCount * planeCount;
+    const Uint32 partitionCount = ((block[1] >> 3) & 3) + 1;
+    if (blockMode.gridWidth > blockWidth || blockMode.gridHeight > blockHeight || weightCount > 64
+        || (blockMode.isDualPlane && partitionCount == 4)) {
+        FillErrorColor(outTexels, texelCount);
+        return false;
+    }
+
+    const Uint32 weightBits = ISEBitCount(blockMode.weightRangeIndex, weightCount);
+    if (weightBits < 24 || weightBits > 96) {
+        FillErrorColor(outTexels, texelCount);
+        return false;
+    }
+
+    // Color endpoint modes
+    Uint32 endpointModes[4];
+    Uint32 partitionIndex = 0;
+    Uint32 colorStart;
+    Uint32 extraModeBits = 0;
+    const Uint32 weightStart = 128 - weightBits;
+    const Uint32 dualPlaneBits = blockMode.isDualPlane ? 2 : 0;
+
+    if (partitionCount == 1) {
+        endpointModes[0] = ReadBlockBits(block, 13, 4);
+        colorStart = 17;
+    } else {
+        partitionIndex = ReadBlockBits(block, 13, 10);
+        colorStart = 29;
+        const Uint32 modeField = ReadBlockBits(block, 23, 6);
+        const Uint32 selector = modeField & 3;
+        if (selector == 0) {
+            for (Uint32 p = 0; p < partitionCount; ++p) {
+                endpointModes[p] = modeField >> 2;
+            }
+        } else {
+            extraModeBits = 3 * partitionCount - 4;
+            const Uint32 extra = ReadBlockBits(block, weightStart - extraModeBits, extraModeBits);
+            const Uint32 modeBits = (modeField >> 2) | (extra << 4);
+            const Uint32 baseClass = selector - 1;
+            for (Uint32 p = 0; p < partitionCount; ++p) {
+                const Uint32 classOffset = (modeBits >> p) & 1;
+                const Uint32 modeLow = (modeBits >> (partitionCount + 2 * p)) & 3;
+                endpointModes[p] = ((baseClass + classOffset) << 2) | modeLow;
+            }
+        }
+    }
+
+    Uint32 colorValueCount = 0;
+    for (Uint32 p = 0; p < partitionCount; ++p) {
+        colorValueCount += ((endpointModes[p] >> 2) + 1) * 2;
+    }
+    const Uint32 colorEnd = weightStart - dualPlaneBits - extraModeBits;
+    if (colorValueCount > 18 || colorEnd <= colorStart) {
+        FillErrorColor(outTexels, texelCount);
+        return false;
+    }
+
+    const Uint32 colorBits = colorEnd - colorStart;
+    int colorRangeIndex = -1;
+    for (int range = ISE_RANGE_COUNT - 1; range >= ISE_MIN_COLOR_RANGE; --range) {
+        if (ISEBitCount(range, colorValueCount) <= colorBits) {
+            colorRangeIndex = range;
+            break;
+        }
+    }
+    if (colorRangeIndex < 0) {
+        FillErrorColor(outTexels, texelCount);
+        return false;
+    }
+
+    // Color endpoints
+    Uint32 colorValues[18];
+    BlockBitReader colorReader { block, colorStart, colorEnd };
+    DecodeISE(colorReader, colorRangeIndex, colorValueCount, colorValues);
+    for (Uint32 i = 0; i < colorValueCount; ++i) {
+        colorValues[i] = UnquantizeColor(colorValues[i], colorRangeIndex);
+    }
+
+    int endpoints[4][2][4];
+    Uint32 valueIndex = 0;
+    for (Uint32 p = 0; p < partitionCount; ++p) {
+        if (!DecodeEndpoints(endpointModes[p], colorValues + valueIndex, endpoints[p][0], endpoints[p][1])) {
+            FillErrorColor(outTexels, texelCount);
+            return false;
+        }
+        valueIndex += ((endpointModes[p] >> 2) + 1) * 2;
+    }
+
+    // Weights are stored bit reversed from the end of the block
+    Uint8 reversedBlock[16];
+    for (int i = 0; i < 16; ++i) {
+        Uint8 byte = block[15 - i];
+        byte = static_cast<Uint8>(((byte & 0xF0) >> 4) | ((byte & 0x0F) << 4));
+        byte = static_cast<Uint8>(((byte & 0xCC) >> 2) | ((byte & 0x33) << 2));
+        byte = static_cast<Uint8>(((byte & 0xAA) >> 1) | ((byte & 0x55) << 1));
+        reversedBlock[i] = byte;
+    }
+    Uint32 weightValues[64];
+    BlockBitReader weightReader { reversedBlock, 0, weightBits };
+    DecodeISE(weightReader, blockMode.weightRangeIndex, weightCount, weightValues);
+
+    Uint32 gridWeights[2][64];
+    for (Uint32 i = 0; i < gridTexelCount; ++i) {
+        for (Uint32 plane = 0; plane < planeCount; ++plane) {
+            gridWeights[plane][i] = UnquantizeWeight(weightValues[i * planeCount + plane],
+                                                     blockMode.weightRangeIndex);
+        }
+    }
+    const Uint32 secondPlaneComponent = blockMode.isDualPlane
+                                        ? ReadBlockBits(block, weightStart - extraModeBits - 2, 2) : 4;
+
+    // Infill the weight grid to the block texels and interpolate endpoints
+    const Uint32 ds = (1024 + blockWidth / 2) / (blockWidth - 1);
+    const Uint32 dt = (1024 + blockHeight / 2) / (blockHeight - 1);
+    const bool isSmallBlock = texelCount < 31;
+
+    for (Uint32 t = 0; t < blockHeight; ++t) {
+        for (Uint32 s = 0; s < blockWidth; ++s) {
+            const Uint32 gs = (ds * s * (blockMode.gridWidth - 1) + 32) >> 6;
+            const Uint32 gt = (dt * t * (blockMode.gridHeight - 1) + 32) >> 6;
+            const Uint32 js = gs >> 4;
+            const Uint32 fs = gs & 0xF;
+            const Uint32 jt = gt >> 4;
+            const Uint32 ft = gt & 0xF;
+            const Uint32 w11 = (fs * ft + 8) >> 4;
+            const Uint32 w10 = ft - w11;
+            const Uint32 w01 = fs - w11;
+            const Uint32 w00 = 16 - fs - ft + w11;
+            const Uint32 v0 = js + jt * blockMode.gridWidth;
+
+            Uint32 texelWeights[2];
+            for (Uint32 plane = 0; plane < planeCount; ++plane) {
+                const Uint32* grid = gridWeights[plane];
+                const Uint32 p00 = grid[v0];
+                const Uint32 p01 = w01 ? grid[v0 + 1] : 0;
+                const Uint32 p10 = w10 ? grid[v0 + blockMode.gridWidth] : 0;
+                const Uint32 p11 = w11 ? grid[v0 + blockMode.gridWidth + 1] : 0;
+                texelWeights[plane] = (p00 * w00 + p01 * w01 + p10 * w10 + p11 * w11 + 8) >> 4;
+            }
+
+            const Uint32 partition = partitionCount > 1
+                                     ? SelectPartition(partitionIndex, s, t, 0, partitionCount, isSmallBlock) : 0;
+            const int* e0 = endpoints[partition][0];
+            const int* e1 = endpoints[partition][1];
+            Uint8* texel = outTexels + (t * blockWidth + s) * 4;
+            for (Uint32 component = 0; component < 4; ++component) {
+                const Uint32 weight = texelWeights[component == secondPlaneComponent ? 1 : 0];
+                const Uint32 c0 = static_cast<Uint32>(e0[component]) * 257;
+                const Uint32 c1 = static_cast<Uint32>(e1[component]) * 257;
+                const Uint32 c = (c0 * (64 - weight) + c1 * weight + 32) >> 6;
+                texel[component] = static_cast<Uint8>(c >> 8);
+            }
+        }
+    }
+    return true;
+}
+
+bool TextureCompression::DecodeBCBlock(SDL_GPUTextureFormat format, const Uint8* block, Uint8* outTexels) {
+    switch (format) {
+        case SDL_GPU_TEXTUREFORMAT_BC1_RGBA_UNORM:
+        case SDL_GPU_TEXTUREFORMAT_BC1_RGBA_UNORM_SRGB:
+            DecodeBC1Colors(block, true, outTexels);
+            return true;
+        case SDL_GPU_TEXTUREFORMAT_BC2_RGBA_UNORM:
+        case SDL_GPU_TEXTUREFORMAT_BC2_RGBA_UNORM_SRGB:
+            DecodeBC1Colors(block + 8, false, outTexels);
+            for (int i = 0; i < 16; ++i) {
+                const Uint32 alpha = (block[i / 2] >> ((i & 1) * 4)) & 0xF;
+                outTexels[i * 4 + 3] = static_cast<Uint8>(alpha * 17);
+            }
+            return true;
+        case SDL_GPU_TEXTUREFORMAT_BC3_RGBA_UNORM:
+        case SDL_GPU_TEXTUREFORMAT_BC3_RGBA_UNORM_SRGB:
+            DecodeBC1Colors(block + 8, false, outTexels);
+            DecodeBCChannel(block, outTexels, 3);
+            return true;
+        case SDL_GPU_TEXTUREFORMAT_BC4_R_UNORM:
+            for (int i = 0; i < 16; ++i) {
+                outTexels[i * 4 + 1] = 0;
+                outTexels[i * 4 + 2] = 0;
+                outTexels[i * 4 + 3] = 255;
+            }
+            DecodeBCChannel(block, outTexels, 0);
+            return true;
+        case SDL_GPU_TEXTUREFORMAT_BC5_RG_UNORM:
+            for (int i = 0; i < 16; ++i) {
+                outTexels[i * 4 + 2] = 0;
+                outTexels[i * 4 + 3] = 255;
+            }
+            DecodeBCChannel(block, outTexels, 0);
+            DecodeBCChannel(block + 8, outTexels, 1);
+            return true;
+        default:
+            return false;
+    }
+}
@@ -0,0 +1,67 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef TEXTURECOMPRESSION_HPP
+#define TEXTURECOMPRESSION_HPP
+
+#include <SDL3/SDL_gpu.h>
+#include <vector>
+
+using std::vector;
+
+/*
+ * Block compressed image, as stored on disk.
+ * Data is kept compressed so that it can be uploaded as is when the GPU supports the format.
+ */
+struct CompressedImage {
+    SDL_GPUTextureFormat format { SDL_GPU_TEXTUREFORMAT_INVALID };
+    Uint32 width { 0 };
+    Uint32 height { 0 };
+    Uint32 blockWidth { 0 };
+    Uint32 blockHeight { 0 };
+    Uint32 blockSize { 0 }; // In bytes
+    vector<Uint8> data;
+
+    Uint32 BlockCountX() const { return (width + blockWidth - 1) / blockWidth; }
+    Uint32 BlockCountY() const { return (height + blockHeight - 1) / blockHeight; }
+};
+
+/*
+ * Loading and CPU decoding of block compressed textures (ASTC and BCn).
+ * This does not depend on a GPU device, so decoders can run headless.
+ */
+class TextureCompression {
+public:
+    // Load a .astc file (ARM astcenc container). Only 2D LDR blocks are supported.
+    static bool LoadASTC(const char* path, CompressedImage& outImage);
+
+    // Load a .dds file containing BC1 to BC7 data (legacy or DX10 header). Only the top mip level is read.
+    static bool LoadDDS(const char* path, CompressedImage& outImage);
+
+    // Parse an in-memory .astc / .dds file
+    static bool ParseASTC(const Uint8* fileData, size_t fileSize, CompressedImage& outImage);
+    static bool ParseDDS(const Uint8* fileData, size_t fileSize, CompressedImage& outImage);
+
+    // Set the format and the matching block dimensions. Returns false if the format is not block compressed.
+    static bool SetBlockFormat(SDL_GPUTextureFormat format, CompressedImage& outImage);
+
+    static bool IsASTCFormat(SDL_GPUTextureFormat format);
+    static bool IsBCFormat(SDL_GPUTextureFormat format);
+
+    // Returns true if a CPU decoder exists for this format
+    static bool CanDecode(SDL_GPUTextureFormat format);
+
+    // Decode the whole image into tightly packed RGBA8 texels (width * height * 4 bytes)
+    static bool DecodeToRGBA8(const CompressedImage& image, vector<Uint8>& outPixels);
+
+    // Decode a single 16 bytes ASTC block into blockWidth * blockHeight RGBA8 texels.
+    // Returns false and writes the error color (magenta) for illegal or HDR blocks.
+    static bool DecodeASTCBlock(const Uint8* block, Uint32 blockWidth, Uint32 blockHeight, Uint8* outTexels);
+
+    // Decode a single 4x4 BC1 to BC5 block into 16 RGBA8 texels
+    static bool DecodeBCBlock(SDL_GPUTextureFormat format, const Uint8* block, Uint8* outTexels);
+};
+
+
+#endif //TEXTURECOMPRESSION_HPP
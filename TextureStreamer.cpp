@@ -0,0 +1,105 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#include "TextureStreamer.hpp"
+#include "Renderer.hpp"
+#include <cstring>
+
+void TextureStreamer::Load(Renderer& renderer, vector<MipLevel>&& levels_, const string& name,
+                           Uint32 initialBudget) {
+    levels = std::move(levels_);
+    const Uint32 levelCount = static_cast<Uint32>(levels.size());
+
+    SDL_GPUTextureCreateInfo textureInfo {
+        .type = SDL_GPU_TEXTURETYPE_2D,
+        .format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM,
+        .usage = SDL_GPU_TEXTUREUSAGE_SAMPLER,
+        .width = levels[0].width,
+        .height = levels[0].height,
+        .layer_count_or_depth = 1,
+        .num_levels = levelCount,
+    };
+    texture = renderer.CreateTextureHandle(textureInfo, name);
+
+    // One sampler per level, so that sampling is clamped to the levels already uploaded
+    samplers.resize(levelCount);
+    for (Uint32 level = 0; level < levelCount; ++level) {
+        samplers[level] = renderer.CreateSampler(SDL_GPUSamplerCreateInfo {
+            .min_filter = SDL_GPU_FILTER_LINEAR,
+            .mag_filter = SDL_GPU_FILTER_LINEAR,
+            .mipmap_mode = SDL_GPU_SAMPLERMIPMAPMODE_LINEAR,
+            .address_mode_u = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
+            .address_mode_v = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
+            .address_mode_w = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
+            .min_lod = static_cast<float>(level),
+            .max_lod = static_cast<float>(levelCount - 1),
+        });
+    }
+
+    finestResidentLevel = levelCount;
+    Update(renderer, initialBudget);
+}
+
+void TextureStreamer::Update(Renderer& renderer, Uint32 bytesBudget) {
+    if (finestResidentLevel == 0) { return; }
+
+    // Select the levels to upload, from coarse to fine
+    Uint32 firstLevel = finestResidentLevel - 1;
+    Uint32 uploadSize = static_cast<Uint32>(levels[firstLevel].pixels.size());
+    while (firstLevel > 0) {
+        const auto levelSize = static_cast<Uint32>(levels[firstLevel - 1].pixels.size());
+        if (uploadSize + levelSize > bytesBudget) { break; }
+        uploadSize += levelSize;
+        --firstLevel;
+    }
+
+    // All selected levels go through the same transfer buffer and copy pass
+    SDL_GPUTransferBufferCreateInfo transferBufferCreateInfo {
+        .usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+        .size = uploadSize
+    };
+    SDL_GPUTransferBuffer* transferBuffer = renderer.CreateTransferBuffer(transferBufferCreateInfo);
+    auto transferData = static_cast<Uint8*>(renderer.MapTransferBuffer(transferBuffer, false));
+    Uint32 offset = 0;
+    for (Uint32 level = firstLevel; level < finestResidentLevel; ++level) {
+        std::memcpy(transferData + offset, levels[level].pixels.data(), levels[level].pixels.size());
+        offset += static_cast<Uint32>(levels[level].pixels.size());
+    }
+    renderer.UnmapTransferBuffer(transferBuffer);
+
+    renderer.BeginUploadToBuffer();
+    offset = 0;
+    for (Uint32 level = firstLevel; level < finestResidentLevel; ++level) {
+        MipLevel& mipLevel = levels[level];
+        SDL_GPUTextureTransferInfo textureBufferLocation {
+            .transfer_buffer = transferBuffer,
+            .offset = offset
+        };
+        SDL_GPUTextureRegion textureBufferRegion {
+            .texture = renderer.GetTexture(texture),
+            .mip_level = level,
+            .w = mipLevel.width,
+            .h = mipLevel.height,
+            .d = 1
+        };
+        renderer.UploadToTexture(textureBufferLocation, textureBufferRegion, false);
+        offset += static_cast<Uint32>(mipLevel.pixels.size());
+
+        // The CPU copy is not needed anymore
+        vector<Uint8>().swap(mipLevel.pixels);
+    }
+    renderer.EndUploadToBuffer(transferBuffer);
+
+    finestResidentLevel = firstLevel;
+}
+
+void TextureStreamer::Unload(Renderer& renderer) {
+    for (SDL_GPUSampler* sampler : samplers) {
+        renderer.ReleaseSampler(sampler);
+    }
+    samplers.clear();
+    renderer.Release(texture);
+    levels.clear();
+    finestResidentLevel = 0;
+}
@@ -0,0 +1,50 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef TEXTURESTREAMER_HPP
+#define TEXTURESTREAMER_HPP
+
+#include <SDL3/SDL_gpu.h>
+#include <string>
+#include <vector>
+#include "MipChain.hpp"
+#include "Handle.hpp"
+
+using std::string;
+using std::vector;
+
+class Renderer;
+
+/*
+ * Progressive upload of a RGBA8 mip chain.
+ * The coarsest levels are uploaded first so the texture can be drawn at once,
+ * then finer levels are added over the following frames within an upload budget.
+ * Levels not yet uploaded are never sampled: each resident level has its own sampler
+ * whose min_lod starts at the finest uploaded level.
+ */
+class TextureStreamer {
+public:
+    // Create the texture and upload the coarse levels that fit in initialBudget (at least the 1x1 level)
+    void Load(Renderer& renderer, vector<MipLevel>&& levels, const string& name, Uint32 initialBudget);
+
+    // Upload finer levels until bytesBudget is spent. At least one level is uploaded per call.
+    // Call it outside of a render pass.
+    void Update(Renderer& renderer, Uint32 bytesBudget);
+
+    void Unload(Renderer& renderer);
+
+    bool IsComplete() const { return finestResidentLevel == 0; }
+    Uint32 GetFinestResidentLevel() const { return finestResidentLevel; }
+    TextureHandle GetTexture() const { return texture; }
+    SDL_GPUSampler* GetSampler() const { return samplers[finestResidentLevel]; }
+
+private:
+    vector<MipLevel> levels;
+    vector<SDL_GPUSampler*> samplers;
+    TextureHandle texture;
+    Uint32 finestResidentLevel { 0 };
+};
+
+
+#endif //TEXTURESTREAMER_HPP
@@ -0,0 +1,47 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef THREADEDSCENE_HPP
+#define THREADEDSCENE_HPP
+
+#include <SDL3/SDL_stdinc.h>
+#include "Scene.hpp"
+
+/*
+ * Scene whose simulation can run on its own thread, see FrameLoop::RunThreaded.
+ *
+ * The render data lives in PACKET_COUNT packets owned by the scene. Simulate fills one packet on the simulation
+ * thread while Render draws the other on the main thread, then the packets swap. Simulate must not call the
+ * Renderer, and Render must not touch the simulation state.
+ *
+ * Update and Draw keep the scene usable in the serial loop: both use packet 0.
+ */
+class ThreadedScene : public Scene {
+public:
+    static constexpr Uint32 PACKET_COUNT = 2;
+
+    // Simulation thread: advance by dt and write the render data into the packet
+    virtual void Simulate(float dt, const InputState& input, Uint32 packet) = 0;
+
+    // Main thread: draw from a packet the simulation has finished
+    virtual void Render(Renderer& renderer, Uint32 packet) = 0;
+
+    // Main thread: SDL events must be pumped from the thread that created the window
+    bool GatherInput() { return ManageInput(inputState); }
+
+    const InputState& GetInput() const { return inputState; }
+
+    bool Update(float dt) override {
+        const bool isRunning = GatherInput();
+        Simulate(dt, inputState, 0);
+        return isRunning;
+    }
+
+    void Draw(Renderer& renderer) override { Render(renderer, 0); }
+
+protected:
+    InputState inputState;
+};
+
+#endif //THREADEDSCENE_HPP
@@ -6,6 +6,14 @@
 #include <SDL3/SDL.h>
 
 float Time::ComputeDeltaTime() {
+    // The previous frame ends here
+    const Uint64 counter = SDL_GetPerformanceCounter();
+    if (frameStartCounter != 0) {
+        frameTimes[historyIndex] = ToMilliseconds(counter - frameStartCounter);
+        historyIndex = (historyIndex + 1) % HISTORY_SIZE;
+    }
+    frameStartCounter = counter;
+
     frameStart = SDL_GetTicks();
     unsigned int dt = frameStart - lastFrame;
     lastFrame = frameStart;
@@ -13,8 +21,15 @@ float Time::ComputeDeltaTime() {
 }
 
 void Time::DelayTime() {
+    // Written ahead of the frame time, in the slot of the frame being timed
+    workTimes[historyIndex] = ToMilliseconds(SDL_GetPerformanceCounter() - frameStartCounter);
     frameTime = SDL_GetTicks() - frameStart;
     if (frameTime < frameDelay) {
         SDL_Delay(frameDelay - frameTime);
     }
+}
+
+float Time::ToMilliseconds(Uint64 counterTicks) {
+    return static_cast<float>(static_cast<double>(counterTicks) * 1000.0
+                              / static_cast<double>(SDL_GetPerformanceFrequency()));
 }
\ No newline at end of file
@@ -5,6 +5,8 @@
 #ifndef TIME_HPP
 #define TIME_HPP
 
+#include <SDL3/SDL_stdinc.h>
+
 /*
  * Hold time related functions.
  * In charge of computing the delta time and ensure smooth game ticking.
@@ -17,7 +19,19 @@ public:
     // Wait if the game run faster than the decided FPS
     void DelayTime();
 
+    static constexpr Uint32 HISTORY_SIZE = 128;
+
+    // Milliseconds between the starts of the last HISTORY_SIZE frames, 0 is the oldest. Precise to the performance
+    // counter, while the delta time is in whole milliseconds.
+    float GetFrameTime(Uint32 index) const { return frameTimes[(historyIndex + index) % HISTORY_SIZE]; }
+
+    // Milliseconds the same frames spent before DelayTime, i.e. updating and drawing
+    float GetWorkTime(Uint32 index) const { return workTimes[(historyIndex + index) % HISTORY_SIZE]; }
+
 private:
+    // Performance counter ticks to milliseconds
+    static float ToMilliseconds(Uint64 counterTicks);
+
     const static int FPS = 60;
     const static int frameDelay = 1000 / FPS;
 
@@ -29,6 +43,12 @@ private:
 
     // Time it tooks to run the loop. Used to cap framerate.
     unsigned int frameTime { 0 };
+
+    // Ring buffers, historyIndex is the oldest frame
+    float frameTimes[HISTORY_SIZE] {};
+    float workTimes[HISTORY_SIZE] {};
+    Uint32 historyIndex { 0 };
+    Uint64 frameStartCounter { 0 };
 };
 
 
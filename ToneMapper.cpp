@@ -0,0 +1,155 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#include "ToneMapper.hpp"
+#include "Renderer.hpp"
+
+void ToneMapper::Load(Renderer& renderer, const char* basePath) {
+    // All shaders read one storage texture and write one
+    SDL_GPUComputePipelineCreateInfo createInfo = {
+        .num_readonly_storage_textures = 1,
+        .num_readwrite_storage_textures = 1,
+        .threadcount_x = THREAD_GROUP_SIZE,
+        .threadcount_y = THREAD_GROUP_SIZE,
+        .threadcount_z = 1,
+    };
+    const char* operatorShaders[] = {
+        "ToneMapReinhard.comp",
+        "ToneMapExtendedReinhardLuminance.comp",
+        "ToneMapHable.comp",
+        "ToneMapACES.comp"
+    };
+    for (int i = 0; i < static_cast<int>(ToneMapOperator::Count); ++i) {
+        operatorPipelines[i] = renderer.CreateComputePipelineFromShader(basePath, operatorShaders[i], &createInfo);
+    }
+    const char* transferShaders[] = { "LinearToSRGB.comp", "LinearToST2084.comp" };
+    for (int i = 0; i < static_cast<int>(TransferFunction::Count); ++i) {
+        transferPipelines[i] = renderer.CreateComputePipelineFromShader(basePath, transferShaders[i], &createInfo);
+    }
+
+    SDL_GPUComputePipelineCreateInfo fusedCreateInfo = {
+        .num_readonly_storage_textures = 1,
+        .num_readwrite_storage_textures = 1,
+        .num_uniform_buffers = 1,
+        .threadcount_x = FUSED_THREAD_GROUP_SIZE,
+        .threadcount_y = FUSED_THREAD_GROUP_SIZE,
+        .threadcount_z = 1,
+    };
+    fusedPipeline = renderer.CreateComputePipelineFromShader(basePath, "ToneMapFused.comp", &fusedCreateInfo);
+
+    hdrTarget = renderer.CreateSizedTarget(SizedTargetDescription {
+        .name = "HDR Target",
+        .format = HDR_FORMAT,
+        .usage = SDL_GPU_TEXTUREUSAGE_COLOR_TARGET | SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_READ,
+    });
+    toneMappedTarget = renderer.CreateSizedTarget(SizedTargetDescription {
+        .name = "Tone Mapped Target",
+        .format = HDR_FORMAT,
+        .usage = SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_WRITE | SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_READ,
+    });
+
+    // Output textures are blit sources. HDR10 prefers 10 bits, and falls back to float16.
+    const SDL_GPUTextureUsageFlags outputUsage =
+            SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_WRITE | SDL_GPU_TEXTUREUSAGE_SAMPLER;
+    outputTargets[static_cast<int>(TransferFunction::SRGB)] = renderer.CreateSizedTarget(SizedTargetDescription {
+        .name = "SRGB Output Target",
+        .format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM,
+        .usage = outputUsage,
+    });
+    const SDL_GPUTextureFormat hdr10Format =
+            renderer.DoesTextureSupportFormat(SDL_GPU_TEXTUREFORMAT_R10G10B10A2_UNORM, SDL_GPU_TEXTURETYPE_2D,
+                                              outputUsage)
+            ? SDL_GPU_TEXTUREFORMAT_R10G10B10A2_UNORM : HDR_FORMAT;
+    outputTargets[static_cast<int>(TransferFunction::ST2084)] = renderer.CreateSizedTarget(SizedTargetDescription {
+        .name = "ST2084 Output Target",
+        .format = hdr10Format,
+        .usage = outputUsage,
+    });
+}
+
+void ToneMapper::SetSize(Uint32 width_, Uint32 height_) {
+    width = width_;
+    height = height_;
+}
+
+SDL_GPUTexture* ToneMapper::GetHDRTarget(const Renderer& renderer) const {
+    return renderer.GetTexture(hdrTarget);
+}
+
+SDL_GPUTexture* ToneMapper::Apply(Renderer& renderer, ToneMapOperator toneMapOperator,
+                                  TransferFunction transferFunction) {
+    SDL_GPUTexture* hdrTexture = renderer.GetTexture(hdrTarget);
+    SDL_GPUTexture* toneMappedTexture = renderer.GetTexture(toneMappedTarget);
+
+    // Tone map: HDR target to float16 display referred values
+    SDL_GPUStorageTextureReadWriteBinding toneMappedBinding {
+        .texture = toneMappedTexture,
+        .cycle = true
+    };
+    renderer.BeginComputeInFrame(&toneMappedBinding, 1, nullptr, 0);
+    renderer.BindComputePipeline(operatorPipelines[static_cast<int>(toneMapOperator)]);
+    renderer.BindComputeStorageTextures(0, &hdrTexture, 1);
+    // Whole groups only: the compiled shaders do not check the texture bounds. Right and bottom pixels past the last
+    // whole group keep their previous values.
+    renderer.DispatchCompute(width / THREAD_GROUP_SIZE, height / THREAD_GROUP_SIZE, 1);
+    renderer.EndCompute();
+
+    // Transfer: encode for the swapchain composition
+    SDL_GPUTexture* output = renderer.GetTexture(outputTargets[static_cast<int>(transferFunction)]);
+    SDL_GPUStorageTextureReadWriteBinding outputBinding {
+        .texture = output,
+        .cycle = true
+    };
+    renderer.BeginComputeInFrame(&outputBinding, 1, nullptr, 0);
+    renderer.BindComputePipeline(transferPipelines[static_cast<int>(transferFunction)]);
+    renderer.BindComputeStorageTextures(0, &toneMappedTexture, 1);
+    renderer.DispatchCompute(width / THREAD_GROUP_SIZE, height / THREAD_GROUP_SIZE, 1);
+    renderer.EndCompute();
+
+    return output;
+}
+
+SDL_GPUTexture* ToneMapper::ApplyFused(Renderer& renderer, ToneMapOperator toneMapOperator,
+                                       TransferFunction transferFunction, float exposure) {
+    ToneMapFusedUniforms uniforms {
+        .exposure = exposure,
+        .toneMapOperator = static_cast<Uint32>(toneMapOperator),
+        .transferFunction = static_cast<Uint32>(transferFunction),
+        .paperWhiteNits = ToneMapping::ST2084_PAPER_WHITE_NITS
+    };
+
+    SDL_GPUTexture* output = renderer.GetTexture(outputTargets[static_cast<int>(transferFunction)]);
+    SDL_GPUStorageTextureReadWriteBinding outputBinding {
+        .texture = output,
+        .cycle = true
+    };
+    renderer.BeginComputeInFrame(&outputBinding, 1, nullptr, 0);
+    renderer.BindComputePipeline(fusedPipeline);
+    SDL_GPUTexture* hdrTexture = renderer.GetTexture(hdrTarget);
+    renderer.BindComputeStorageTextures(0, &hdrTexture, 1);
+    renderer.PushComputeUniformData(0, &uniforms, sizeof(uniforms));
+    renderer.DispatchCompute(width / FUSED_THREAD_GROUP_SIZE, height / FUSED_THREAD_GROUP_SIZE, 1);
+    renderer.EndCompute();
+
+    return output;
+}
+
+void ToneMapper::Unload(Renderer& renderer) {
+    // Releases are deferred, so the textures of in flight frames stay valid
+    renderer.Release(hdrTarget);
+    renderer.Release(toneMappedTarget);
+    for (TextureHandle& output : outputTargets) {
+        renderer.Release(output);
+    }
+    renderer.ReleaseComputePipeline(fusedPipeline);
+    fusedPipeline = nullptr;
+    for (SDL_GPUComputePipeline*& pipeline : operatorPipelines) {
+        renderer.ReleaseComputePipeline(pipeline);
+        pipeline = nullptr;
+    }
+    for (SDL_GPUComputePipeline*& pipeline : transferPipelines) {
+        renderer.ReleaseComputePipeline(pipeline);
+        pipeline = nullptr;
+    }
+}
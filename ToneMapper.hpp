@@ -0,0 +1,70 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef TONEMAPPER_HPP
+#define TONEMAPPER_HPP
+
+#include <SDL3/SDL_gpu.h>
+#include "ToneMapping.hpp"
+#include "Handle.hpp"
+
+class Renderer;
+
+// Matches the UBO of ToneMapFused.comp
+struct ToneMapFusedUniforms {
+    float exposure;
+    Uint32 toneMapOperator;
+    Uint32 transferFunction;
+    float paperWhiteNits;
+};
+
+/*
+ * HDR post-process stage.
+ * The scene renders into a float16 target, then compute dispatches produce a texture ready to be blitted
+ * to the swapchain: either one fused dispatch, or a tone map dispatch followed by a transfer dispatch.
+ * Intermediate textures are renderer sized targets, recreated by the renderer when the window size changes.
+ */
+class ToneMapper {
+public:
+    void Load(Renderer& renderer, const char* basePath);
+
+    // Size of the processed region, usually the swapchain size. Targets may be larger while the window is resized.
+    void SetSize(Uint32 width, Uint32 height);
+
+    // Render the scene into this R16G16B16A16_FLOAT target. Resolve it every frame, it changes on resize.
+    SDL_GPUTexture* GetHDRTarget(const Renderer& renderer) const;
+
+    // Record both dispatches in the frame command buffer, after the HDR render pass.
+    // Returns the display encoded texture to blit to the swapchain.
+    SDL_GPUTexture* Apply(Renderer& renderer, ToneMapOperator toneMapOperator, TransferFunction transferFunction);
+
+    // Same result with exposure applied, in a single dispatch that skips the float16 intermediate image.
+    SDL_GPUTexture* ApplyFused(Renderer& renderer, ToneMapOperator toneMapOperator,
+                               TransferFunction transferFunction, float exposure);
+
+    void Unload(Renderer& renderer);
+
+    Uint32 GetWidth() const { return width; }
+    Uint32 GetHeight() const { return height; }
+
+    static constexpr SDL_GPUTextureFormat HDR_FORMAT = SDL_GPU_TEXTUREFORMAT_R16G16B16A16_FLOAT;
+
+private:
+    // Must match the numthreads of the shaders
+    static constexpr Uint32 THREAD_GROUP_SIZE = 8;
+    static constexpr Uint32 FUSED_THREAD_GROUP_SIZE = 16;
+
+    SDL_GPUComputePipeline* operatorPipelines[static_cast<int>(ToneMapOperator::Count)] {};
+    SDL_GPUComputePipeline* transferPipelines[static_cast<int>(TransferFunction::Count)] {};
+    SDL_GPUComputePipeline* fusedPipeline { nullptr };
+
+    TextureHandle hdrTarget;
+    TextureHandle toneMappedTarget;
+    TextureHandle outputTargets[static_cast<int>(TransferFunction::Count)] {};
+    Uint32 width { 0 };
+    Uint32 height { 0 };
+};
+
+
+#endif //TONEMAPPER_HPP
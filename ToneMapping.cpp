@@ -0,0 +1,286 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#include "ToneMapping.hpp"
+#include <SDL3/SDL_intrin.h>
+#include <cmath>
+
+namespace {
+    // ACES fitted matrices, row major like the float3x3 of ToneMapACES.comp
+    constexpr float ACES_INPUT[9] = {
+        0.59719f, 0.35458f, 0.04823f,
+        0.07600f, 0.90834f, 0.01566f,
+        0.02840f, 0.13383f, 0.83777f
+    };
+    constexpr float ACES_OUTPUT[9] = {
+        1.60475f, -0.53108f, -0.07367f,
+        -0.10208f, 1.10813f, -0.00605f,
+        -0.00327f, -0.07276f, 1.07602f
+    };
+    constexpr float REC709_TO_REC2020[9] = {
+        0.6274039745330810546875f, 0.329281985759735107421875f, 0.043313600122928619384765625f,
+        0.06909699738025665283203125f, 0.919539988040924072265625f, 0.0113612003624439239501953125f,
+        0.01639159955084323883056640625f, 0.0880132019519805908203125f, 0.895595014095306396484375f
+    };
+    constexpr float LUMINANCE_WEIGHTS[3] = { 0.2126f, 0.7152f, 0.0722f };
+
+    constexpr float HABLE_A = 0.15f;
+    constexpr float HABLE_B = 0.50f;
+    constexpr float HABLE_C = 0.10f;
+    constexpr float HABLE_D = 0.20f;
+    constexpr float HABLE_E = 0.02f;
+    constexpr float HABLE_F = 0.30f;
+
+    void MultiplyMatrix(const float* matrix, const float* v, float* outV) {
+        const float x = v[0], y = v[1], z = v[2];
+        outV[0] = matrix[0] * x + matrix[1] * y + matrix[2] * z;
+        outV[1] = matrix[3] * x + matrix[4] * y + matrix[5] * z;
+        outV[2] = matrix[6] * x + matrix[7] * y + matrix[8] * z;
+    }
+
+    float HablePartial(float x) {
+        return ((x * (x * HABLE_A + HABLE_C * HABLE_B) + HABLE_D * HABLE_E)
+                / (x * (x * HABLE_A + HABLE_B) + HABLE_D * HABLE_F)) - HABLE_E / HABLE_F;
+    }
+
+    float ACESFit(float v) {
+        const float a = v * (v + 0.0245786f) - 0.000090537f;
+        const float b = v * (v * 0.983729f + 0.4329510f) + 0.238081f;
+        return a / b;
+    }
+
+    float Saturate(float v) { return v < 0.0f ? 0.0f : (v > 1.0f ? 1.0f : v); }
+
+#ifdef SDL_SSE2_INTRINSICS
+    // Per channel operators work on one RGBA pixel per register. Alpha goes through the math and is overwritten.
+    inline __m128 SetAlphaOne(__m128 v) {
+        const __m128 alphaMask = _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0));
+        return _mm_or_ps(_mm_andnot_ps(alphaMask, v), _mm_and_ps(alphaMask, _mm_set1_ps(1.0f)));
+    }
+
+    inline __m128 HablePartialSSE2(__m128 x) {
+        const __m128 numerator = _mm_add_ps(
+            _mm_mul_ps(x, _mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(HABLE_A)), _mm_set1_ps(HABLE_C * HABLE_B))),
+            _mm_set1_ps(HABLE_D * HABLE_E));
+        const __m128 denominator = _mm_add_ps(
+            _mm_mul_ps(x, _mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(HABLE_A)), _mm_set1_ps(HABLE_B))),
+            _mm_set1_ps(HABLE_D * HABLE_F));
+        return _mm_sub_ps(_mm_div_ps(numerator, denominator), _mm_set1_ps(HABLE_E / HABLE_F));
+    }
+
+    inline __m128 ACESFitSSE2(__m128 v) {
+        const __m128 a = _mm_sub_ps(_mm_mul_ps(v, _mm_add_ps(v, _mm_set1_ps(0.0245786f))),
+                                    _mm_set1_ps(0.000090537f));
+        const __m128 b = _mm_add_ps(
+            _mm_mul_ps(v, _mm_add_ps(_mm_mul_ps(v, _mm_set1_ps(0.983729f)), _mm_set1_ps(0.4329510f))),
+            _mm_set1_ps(0.238081f));
+        return _mm_div_ps(a, b);
+    }
+
+    // r, g, b = M * (r, g, b) for four pixels in SoA layout
+    inline void MultiplyMatrixSSE2(const float* m, __m128& r, __m128& g, __m128& b) {
+        const __m128 x = r, y = g, z = b;
+        r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[0]), x), _mm_mul_ps(_mm_set1_ps(m[1]), y)),
+                       _mm_mul_ps(_mm_set1_ps(m[2]), z));
+        g = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[3]), x), _mm_mul_ps(_mm_set1_ps(m[4]), y)),
+                       _mm_mul_ps(_mm_set1_ps(m[5]), z));
+        b = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[6]), x), _mm_mul_ps(_mm_set1_ps(m[7]), y)),
+                       _mm_mul_ps(_mm_set1_ps(m[8]), z));
+    }
+
+    // Returns the number of pixels processed, the caller finishes the tail with the scalar path
+    size_t ApplyOperatorSSE2(ToneMapOperator toneMapOperator, const float* pixels, size_t pixelCount,
+                             float* outPixels) {
+        const __m128 one = _mm_set1_ps(1.0f);
+        size_t i = 0;
+        switch (toneMapOperator) {
+            case ToneMapOperator::Reinhard:
+                for (; i < pixelCount; ++i) {
+                    const __m128 v = _mm_loadu_ps(pixels + i * 4);
+                    _mm_storeu_ps(outPixels + i * 4, SetAlphaOne(_mm_div_ps(v, _mm_add_ps(one, v))));
+                }
+                break;
+            case ToneMapOperator::Hable: {
+                const __m128 exposureBias = _mm_set1_ps(ToneMapping::HABLE_EXPOSURE_BIAS);
+                const __m128 whiteScale = _mm_set1_ps(1.0f / HablePartial(ToneMapping::HABLE_WHITE_POINT));
+                for (; i < pixelCount; ++i) {
+                    const __m128 v = _mm_loadu_ps(pixels + i * 4);
+                    const __m128 current = HablePartialSSE2(_mm_mul_ps(v, exposureBias));
+                    _mm_storeu_ps(outPixels + i * 4, SetAlphaOne(_mm_mul_ps(current, whiteScale)));
+                }
+                break;
+            }
+            // Operators mixing channels transpose four pixels to SoA, so no lane is wasted on horizontal math
+            case ToneMapOperator::ExtendedReinhardLuminance: {
+                const __m128 inverseWhiteSquared = _mm_set1_ps(
+                    1.0f / (ToneMapping::EXTENDED_REINHARD_MAX_WHITE * ToneMapping::EXTENDED_REINHARD_MAX_WHITE));
+                for (; i + 4 <= pixelCount; i += 4) {
+                    __m128 r = _mm_loadu_ps(pixels + i * 4);
+                    __m128 g = _mm_loadu_ps(pixels + i * 4 + 4);
+                    __m128 b = _mm_loadu_ps(pixels + i * 4 + 8);
+                    __m128 a = _mm_loadu_ps(pixels + i * 4 + 12);
+                    _MM_TRANSPOSE4_PS(r, g, b, a);
+                    const __m128 luminance = _mm_add_ps(
+                        _mm_add_ps(_mm_mul_ps(r, _mm_set1_ps(LUMINANCE_WEIGHTS[0])),
+                                   _mm_mul_ps(g, _mm_set1_ps(LUMINANCE_WEIGHTS[1]))),
+                        _mm_mul_ps(b, _mm_set1_ps(LUMINANCE_WEIGHTS[2])));
+                    // l_new / l_old simplifies to (1 + l / w^2) / (1 + l), which also keeps black at 0
+                    const __m128 scale = _mm_div_ps(_mm_add_ps(one, _mm_mul_ps(luminance, inverseWhiteSquared)),
+                                                    _mm_add_ps(one, luminance));
+                    r = _mm_mul_ps(r, scale);
+                    g = _mm_mul_ps(g, scale);
+                    b = _mm_mul_ps(b, scale);
+                    a = one;
+                    _MM_TRANSPOSE4_PS(r, g, b, a);
+                    _mm_storeu_ps(outPixels + i * 4, r);
+                    _mm_storeu_ps(outPixels + i * 4 + 4, g);
+                    _mm_storeu_ps(outPixels + i * 4 + 8, b);
+                    _mm_storeu_ps(outPixels + i * 4 + 12, a);
+                }
+                break;
+            }
+            case ToneMapOperator::ACES:
+                for (; i + 4 <= pixelCount; i += 4) {
+                    __m128 r = _mm_loadu_ps(pixels + i * 4);
+                    __m128 g = _mm_loadu_ps(pixels + i * 4 + 4);
+                    __m128 b = _mm_loadu_ps(pixels + i * 4 + 8);
+                    __m128 a = _mm_loadu_ps(pixels + i * 4 + 12);
+                    _MM_TRANSPOSE4_PS(r, g, b, a);
+                    MultiplyMatrixSSE2(ACES_INPUT, r, g, b);
+                    r = ACESFitSSE2(r);
+                    g = ACESFitSSE2(g);
+                    b = ACESFitSSE2(b);
+                    MultiplyMatrixSSE2(ACES_OUTPUT, r, g, b);
+                    a = one;
+                    _MM_TRANSPOSE4_PS(r, g, b, a);
+                    _mm_storeu_ps(outPixels + i * 4, r);
+                    _mm_storeu_ps(outPixels + i * 4 + 4, g);
+                    _mm_storeu_ps(outPixels + i * 4 + 8, b);
+                    _mm_storeu_ps(outPixels + i * 4 + 12, a);
+                }
+                break;
+            case ToneMapOperator::Count:
+                break;
+        }
+        return i;
+    }
+#endif
+}
+
+const char* ToneMapping::GetOperatorName(ToneMapOperator toneMapOperator) {
+    switch (toneMapOperator) {
+        case ToneMapOperator::Reinhard: return "Reinhard";
+        case ToneMapOperator::ExtendedReinhardLuminance: return "Extended Reinhard (Luminance)";
+        case ToneMapOperator::Hable: return "Hable";
+        case ToneMapOperator::ACES: return "ACES";
+        case ToneMapOperator::Count: break;
+    }
+    return "Unknown";
+}
+
+const char* ToneMapping::GetTransferFunctionName(TransferFunction transferFunction) {
+    switch (transferFunction) {
+        case TransferFunction::SRGB: return "sRGB";
+        case TransferFunction::ST2084: return "HDR10 ST.2084";
+        case TransferFunction::Count: break;
+    }
+    return "Unknown";
+}
+
+void ToneMapping::ApplyOperator(ToneMapOperator toneMapOperator, const float* pixels, size_t pixelCount,
+                                float* outPixels) {
+    size_t first = 0;
+#ifdef SDL_SSE2_INTRINSICS
+    first = ApplyOperatorSSE2(toneMapOperator, pixels, pixelCount, outPixels);
+#endif
+    ApplyOperatorScalar(toneMapOperator, pixels + first * 4, pixelCount - first, outPixels + first * 4);
+}
+
+void ToneMapping::ApplyOperatorScalar(ToneMapOperator toneMapOperator, const float* pixels, size_t pixelCount,
+                                      float* outPixels) {
+    const float hableWhiteScale = 1.0f / HablePartial(HABLE_WHITE_POINT);
+    for (size_t i = 0; i < pixelCount; ++i) {
+        const float* v = pixels + i * 4;
+        float* out = outPixels + i * 4;
+        switch (toneMapOperator) {
+            case ToneMapOperator::Reinhard:
+                for (int c = 0; c < 3; ++c) { out[c] = v[c] / (1.0f + v[c]); }
+                break;
+            case ToneMapOperator::ExtendedReinhardLuminance: {
+                const float luminance = v[0] * LUMINANCE_WEIGHTS[0] + v[1] * LUMINANCE_WEIGHTS[1]
+                                        + v[2] * LUMINANCE_WEIGHTS[2];
+                // l_new / l_old, simplified so that black stays black instead of 0 / 0
+                const float scale = (1.0f + luminance / (EXTENDED_REINHARD_MAX_WHITE * EXTENDED_REINHARD_MAX_WHITE))
+                                    / (1.0f + luminance);
+                for (int c = 0; c < 3; ++c) { out[c] = v[c] * scale; }
+                break;
+            }
+            case ToneMapOperator::Hable:
+                for (int c = 0; c < 3; ++c) { out[c] = HablePartial(v[c] * HABLE_EXPOSURE_BIAS) * hableWhiteScale; }
+                break;
+            case ToneMapOperator::ACES: {
+                float fitted[3];
+                MultiplyMatrix(ACES_INPUT, v, fitted);
+                for (float& channel : fitted) { channel = ACESFit(channel); }
+                MultiplyMatrix(ACES_OUTPUT, fitted, out);
+                break;
+            }
+            case ToneMapOperator::Count:
+                break;
+        }
+        out[3] = 1.0f;
+    }
+}
+
+void ToneMapping::ApplyTransfer(TransferFunction transferFunction, const float* pixels, size_t pixelCount,
+                                float* outPixels) {
+    for (size_t i = 0; i < pixelCount; ++i) {
+        const float* v = pixels + i * 4;
+        float* out = outPixels + i * 4;
+        if (transferFunction == TransferFunction::SRGB) {
+            // The shader uses a plain 2.2 gamma, not the piecewise sRGB curve
+            for (int c = 0; c < 3; ++c) { out[c] = Saturate(std::pow(std::fabs(v[c]), 1.0f / 2.2f)); }
+            out[3] = 1.0f;
+        } else {
+            float rec2020[3];
+            MultiplyMatrix(REC709_TO_REC2020, v, rec2020);
+            for (int c = 0; c < 3; ++c) {
+                const float normalized = std::pow(std::fabs(rec2020[c] * ST2084_PAPER_WHITE_NITS / 10000.0f),
+                                                  0.1593017578125f);
+                out[c] = Saturate(std::pow((0.8359375f + normalized * 18.8515625f) / (1.0f + normalized * 18.6875f),
+                                           78.84375f));
+            }
+            out[3] = Saturate(v[3]);
+        }
+    }
+}
+
+void ToneMapping::QuantizeToRGBA8(const float* pixels, size_t pixelCount, Uint8* outPixels) {
+    for (size_t i = 0; i < pixelCount * 4; ++i) {
+        outPixels[i] = static_cast<Uint8>(Saturate(pixels[i]) * 255.0f + 0.5f);
+    }
+}
+
+void ToneMapping::ApplyFused(ToneMapOperator toneMapOperator, TransferFunction transferFunction, float exposure,
+                             const float* pixels, size_t pixelCount, Uint8* outPixels) {
+    constexpr size_t BLOCK_PIXEL_COUNT = 256;
+    float exposed[BLOCK_PIXEL_COUNT * 4];
+    float toneMapped[BLOCK_PIXEL_COUNT * 4];
+    for (size_t first = 0; first < pixelCount; first += BLOCK_PIXEL_COUNT) {
+        const size_t count = SDL_min(BLOCK_PIXEL_COUNT, pixelCount - first);
+        const float* source = pixels + first * 4;
+        for (size_t i = 0; i < count * 4; ++i) { exposed[i] = source[i] * exposure; }
+        ApplyOperator(toneMapOperator, exposed, count, toneMapped);
+        ApplyTransfer(transferFunction, toneMapped, count, exposed);
+        QuantizeToRGBA8(exposed, count, outPixels + first * 4);
+    }
+}
+
+Uint64 ToneMapping::EstimateMemoryTraffic(Uint32 width, Uint32 height, bool isFused) {
+    constexpr Uint64 HDR_PIXEL_SIZE = 8;    // R16G16B16A16_FLOAT
+    constexpr Uint64 OUTPUT_PIXEL_SIZE = 4; // R8G8B8A8_UNORM
+    const Uint64 pixelCount = static_cast<Uint64>(width) * height;
+    const Uint64 intermediateTraffic = isFused ? 0 : HDR_PIXEL_SIZE * 2;
+    return pixelCount * (HDR_PIXEL_SIZE + intermediateTraffic + OUTPUT_PIXEL_SIZE);
+}
@@ -0,0 +1,65 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef TONEMAPPING_HPP
+#define TONEMAPPING_HPP
+
+#include <SDL3/SDL_stdinc.h>
+
+enum class ToneMapOperator {
+    Reinhard,
+    ExtendedReinhardLuminance,
+    Hable,
+    ACES,
+    Count
+};
+
+enum class TransferFunction {
+    SRGB,
+    ST2084,
+    Count
+};
+
+/*
+ * CPU reference of the ToneMap*.comp and LinearTo*.comp shaders, on RGBA32F pixels.
+ * It runs headless, to produce golden images and measure throughput against the GPU path.
+ */
+class ToneMapping {
+public:
+    // Constants baked in the shaders
+    static constexpr float EXTENDED_REINHARD_MAX_WHITE = 662.0f;
+    static constexpr float HABLE_EXPOSURE_BIAS = 2.0f;
+    static constexpr float HABLE_WHITE_POINT = 11.2f;
+    static constexpr float ST2084_PAPER_WHITE_NITS = 200.0f;
+
+    static const char* GetOperatorName(ToneMapOperator toneMapOperator);
+    static const char* GetTransferFunctionName(TransferFunction transferFunction);
+
+    // Tone map pixelCount pixels. Alpha is set to 1, like the shaders do. Uses SSE2 when available.
+    static void ApplyOperator(ToneMapOperator toneMapOperator, const float* pixels, size_t pixelCount,
+                              float* outPixels);
+
+    // Plain C++ version, to check the SIMD path against
+    static void ApplyOperatorScalar(ToneMapOperator toneMapOperator, const float* pixels, size_t pixelCount,
+                                    float* outPixels);
+
+    // Encode tone mapped pixels for display, then saturate to [0, 1] like a UNORM target would
+    static void ApplyTransfer(TransferFunction transferFunction, const float* pixels, size_t pixelCount,
+                              float* outPixels);
+
+    // Round [0, 1] RGBA32F pixels to RGBA8
+    static void QuantizeToRGBA8(const float* pixels, size_t pixelCount, Uint8* outPixels);
+
+    // Reference of ToneMapFused.comp: exposure, operator, transfer and quantization in a single pass.
+    // Pixels go through a small cache resident block instead of full size intermediate images.
+    static void ApplyFused(ToneMapOperator toneMapOperator, TransferFunction transferFunction, float exposure,
+                           const float* pixels, size_t pixelCount, Uint8* outPixels);
+
+    // Bytes read and written per frame by the GPU tone map stage, with a float16 source and a RGBA8 output.
+    // The two pass version also writes then reads back a float16 intermediate image.
+    static Uint64 EstimateMemoryTraffic(Uint32 width, Uint32 height, bool isFused);
+};
+
+
+#endif //TONEMAPPING_HPP
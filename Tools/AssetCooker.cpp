@@ -0,0 +1,296 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+/*
+ * Offline asset cooker.
+ * Converts Content/Images and the compiled shaders of Content/Shaders into a single AssetPackage file.
+ * Usage: asset-cooker <ContentDirectory> <OutputPackage> <CacheDirectory>
+ *
+ * Each input is hashed. When the hash is found in the cache directory, the cooked entry is reused,
+ * so only changed inputs are cooked again.
+ */
+
+#include <SDL3/SDL.h>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "AssetPackage.hpp"
+#include "MipChain.hpp"
+#include "TextureCompression.hpp"
+
+using std::string;
+using std::vector;
+
+namespace {
+    // Bump when the cooked output of an asset changes, to invalidate the cache
+    constexpr Uint64 COOKER_VERSION = 1;
+
+    struct CookedAsset {
+        AssetEntry entry {};
+        vector<Uint8> data;
+    };
+
+    struct ShaderBackend {
+        const char* directory;
+        const char* extension;
+        SDL_GPUShaderFormat format;
+    };
+
+    constexpr ShaderBackend SHADER_BACKENDS[] {
+        { "SPIRV", ".spv", SDL_GPU_SHADERFORMAT_SPIRV },
+        { "MSL", ".msl", SDL_GPU_SHADERFORMAT_MSL },
+        { "DXIL", ".dxil", SDL_GPU_SHADERFORMAT_DXIL },
+    };
+
+    // FNV-1a
+    Uint64 HashBytes(const void* data, size_t size, Uint64 hash = 0xCBF29CE484222325ull) {
+        const auto* bytes = static_cast<const Uint8*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= 0x100000001B3ull;
+        }
+        return hash;
+    }
+
+    bool LoadFile(const string& path, vector<Uint8>& outData) {
+        size_t size = 0;
+        void* data = SDL_LoadFile(path.c_str(), &size);
+        if (data == nullptr) { return false; }
+        const auto* bytes = static_cast<const Uint8*>(data);
+        outData.assign(bytes, bytes + size);
+        SDL_free(data);
+        return true;
+    }
+
+    vector<string> ListFiles(const string& directory, const char* pattern) {
+        vector<string> result;
+        int count = 0;
+        char** files = SDL_GlobDirectory(directory.c_str(), pattern, 0, &count);
+        if (files == nullptr) { return result; }
+        for (int i = 0; i < count; ++i) {
+            result.emplace_back(files[i]);
+        }
+        SDL_free(files);
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    bool SetEntryName(AssetEntry& entry, const string& name) {
+        if (name.size() >= ASSET_NAME_SIZE) {
+            SDL_Log("Asset name is too long: %s", name.c_str());
+            return false;
+        }
+        std::strncpy(entry.name, name.c_str(), ASSET_NAME_SIZE);
+        return true;
+    }
+
+    // Convert to RGBA8 once here, with the full mip chain, so the runtime only copies
+    bool CookBMP(const string& path, const string& name, CookedAsset& outAsset) {
+        SDL_Surface* surface = SDL_LoadBMP(path.c_str());
+        if (surface == nullptr) {
+            SDL_Log("Failed to load BMP %s: %s", path.c_str(), SDL_GetError());
+            return false;
+        }
+        if (surface->format != SDL_PIXELFORMAT_ABGR8888) {
+            SDL_Surface* converted = SDL_ConvertSurface(surface, SDL_PIXELFORMAT_ABGR8888);
+            SDL_DestroySurface(surface);
+            surface = converted;
+        }
+
+        const auto width = static_cast<Uint32>(surface->w);
+        const auto height = static_cast<Uint32>(surface->h);
+        vector<Uint8> pixels(static_cast<size_t>(width) * height * 4);
+        for (Uint32 y = 0; y < height; ++y) {
+            std::memcpy(pixels.data() + y * width * 4, static_cast<const Uint8*>(surface->pixels) + y * surface->pitch,
+                        width * 4);
+        }
+        SDL_DestroySurface(surface);
+
+        vector<MipLevel> levels;
+        MipChain::Build(pixels.data(), width, height, levels);
+        if (levels.size() > ASSET_MAX_LEVELS) { levels.resize(ASSET_MAX_LEVELS); }
+
+        AssetEntry& entry = outAsset.entry;
+        entry.type = AssetType::Texture;
+        entry.format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM;
+        entry.width = width;
+        entry.height = height;
+        entry.levelCount = static_cast<Uint32>(levels.size());
+        for (Uint32 level = 0; level < entry.levelCount; ++level) {
+            entry.levelOffsets[level] = static_cast<Uint32>(outAsset.data.size());
+            entry.levelSizes[level] = static_cast<Uint32>(levels[level].pixels.size());
+            outAsset.data.insert(outAsset.data.end(), levels[level].pixels.begin(), levels[level].pixels.end());
+        }
+        return SetEntryName(entry, name);
+    }
+
+    // ASTC blocks are stored as is. The runtime decodes them if the GPU does not support the format.
+    bool CookASTC(const vector<Uint8>& fileData, const string& name, CookedAsset& outAsset) {
+        CompressedImage image;
+        if (!TextureCompression::ParseASTC(fileData.data(), fileData.size(), image)) {
+            SDL_Log("Failed to parse ASTC file %s", name.c_str());
+            return false;
+        }
+        AssetEntry& entry = outAsset.entry;
+        entry.type = AssetType::Texture;
+        entry.format = image.format;
+        entry.width = image.width;
+        entry.height = image.height;
+        entry.levelCount = 1;
+        entry.levelOffsets[0] = 0;
+        entry.levelSizes[0] = static_cast<Uint32>(image.data.size());
+        outAsset.data = std::move(image.data);
+        return SetEntryName(entry, name);
+    }
+
+    bool CookShader(const vector<Uint8>& fileData, const string& name, SDL_GPUShaderFormat format,
+                    CookedAsset& outAsset) {
+        AssetEntry& entry = outAsset.entry;
+        entry.type = AssetType::Shader;
+        entry.format = format;
+        outAsset.data = fileData;
+        return SetEntryName(entry, name);
+    }
+
+    string GetCachePath(const string& cacheDirectory, Uint64 hash) {
+        char fileName[32];
+        SDL_snprintf(fileName, sizeof(fileName), "%016llx.bin", static_cast<unsigned long long>(hash));
+        return cacheDirectory + "/" + fileName;
+    }
+
+    bool LoadFromCache(const string& cachePath, CookedAsset& outAsset) {
+        vector<Uint8> cached;
+        if (!LoadFile(cachePath, cached) || cached.size() < sizeof(AssetEntry)) { return false; }
+        std::memcpy(&outAsset.entry, cached.data(), sizeof(AssetEntry));
+        outAsset.data.assign(cached.begin() + sizeof(AssetEntry), cached.end());
+        return outAsset.data.size() == outAsset.entry.size;
+    }
+
+    void SaveToCache(const string& cachePath, const CookedAsset& asset) {
+        vector<Uint8> cached(sizeof(AssetEntry) + asset.data.size());
+        std::memcpy(cached.data(), &asset.entry, sizeof(AssetEntry));
+        std::memcpy(cached.data() + sizeof(AssetEntry), asset.data.data(), asset.data.size());
+        if (!SDL_SaveFile(cachePath.c_str(), cached.data(), cached.size())) {
+            SDL_Log("Could not write cache file %s: %s", cachePath.c_str(), SDL_GetError());
+        }
+    }
+
+    enum class InputKind {
+        BMP,
+        ASTC,
+        Shader
+    };
+
+    struct Input {
+        string path;
+        string name;
+        InputKind kind;
+        SDL_GPUShaderFormat shaderFormat { SDL_GPU_SHADERFORMAT_INVALID };
+    };
+
+    vector<Input> CollectInputs(const string& contentDirectory) {
+        vector<Input> inputs;
+        const string imageDirectory = contentDirectory + "/Images";
+        for (const string& file : ListFiles(imageDirectory, "*.bmp")) {
+            inputs.push_back({ imageDirectory + "/" + file, file, InputKind::BMP });
+        }
+        for (const string& file : ListFiles(imageDirectory + "/astc", "*.astc")) {
+            inputs.push_back({ imageDirectory + "/astc/" + file, "astc/" + file, InputKind::ASTC });
+        }
+        for (const ShaderBackend& backend : SHADER_BACKENDS) {
+            const string shaderDirectory = contentDirectory + "/Shaders/Compiled/" + backend.directory;
+            for (const string& file : ListFiles(shaderDirectory, (string("*") + backend.extension).c_str())) {
+                // Shaders are looked up by their source name, without the backend extension
+                const string name = file.substr(0, file.size() - SDL_strlen(backend.extension));
+                inputs.push_back({ shaderDirectory + "/" + file, name, InputKind::Shader, backend.format });
+            }
+        }
+        return inputs;
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 4) {
+        SDL_Log("Usage: asset-cooker <ContentDirectory> <OutputPackage> <CacheDirectory>");
+        return 1;
+    }
+    const string contentDirectory = argv[1];
+    const string outputPath = argv[2];
+    const string cacheDirectory = argv[3];
+    SDL_CreateDirectory(cacheDirectory.c_str());
+    const size_t separator = outputPath.find_last_of("/\\");
+    if (separator != string::npos) {
+        SDL_CreateDirectory(outputPath.substr(0, separator).c_str());
+    }
+
+    vector<CookedAsset> assets;
+    int cookedCount = 0;
+    int reusedCount = 0;
+    for (const Input& input : CollectInputs(contentDirectory)) {
+        vector<Uint8> fileData;
+        if (!LoadFile(input.path, fileData)) {
+            SDL_Log("Could not read %s", input.path.c_str());
+            return 1;
+        }
+        Uint64 hash = HashBytes(&COOKER_VERSION, sizeof(COOKER_VERSION));
+        hash = HashBytes(input.name.data(), input.name.size(), hash);
+        hash = HashBytes(&input.shaderFormat, sizeof(input.shaderFormat), hash);
+        hash = HashBytes(fileData.data(), fileData.size(), hash);
+
+        CookedAsset asset;
+        const string cachePath = GetCachePath(cacheDirectory, hash);
+        if (LoadFromCache(cachePath, asset)) {
+            ++reusedCount;
+        } else {
+            bool isCooked = false;
+            switch (input.kind) {
+                case InputKind::BMP: isCooked = CookBMP(input.path, input.name, asset); break;
+                case InputKind::ASTC: isCooked = CookASTC(fileData, input.name, asset); break;
+                case InputKind::Shader: isCooked = CookShader(fileData, input.name, input.shaderFormat, asset); break;
+            }
+            if (!isCooked) { return 1; }
+            asset.entry.size = asset.data.size();
+            asset.entry.contentHash = hash;
+            SaveToCache(cachePath, asset);
+            ++cookedCount;
+        }
+        assets.push_back(std::move(asset));
+    }
+
+    // Sorted entries let the runtime binary search by name
+    std::sort(assets.begin(), assets.end(), [](const CookedAsset& a, const CookedAsset& b) {
+        const int order = std::strncmp(a.entry.name, b.entry.name, ASSET_NAME_SIZE);
+        return order != 0 ? order < 0 : a.entry.format < b.entry.format;
+    });
+
+    const AssetPackageHeader header {
+        .magic = ASSET_PACKAGE_MAGIC,
+        .version = ASSET_PACKAGE_VERSION,
+        .entryCount = static_cast<Uint32>(assets.size()),
+        .padding = 0
+    };
+    Uint64 offset = sizeof(AssetPackageHeader) + assets.size() * sizeof(AssetEntry);
+    for (CookedAsset& asset : assets) {
+        offset = (offset + ASSET_PACKAGE_ALIGNMENT - 1) & ~static_cast<Uint64>(ASSET_PACKAGE_ALIGNMENT - 1);
+        asset.entry.offset = offset;
+        offset += asset.entry.size;
+    }
+
+    vector<Uint8> package(offset, 0);
+    std::memcpy(package.data(), &header, sizeof(header));
+    for (size_t i = 0; i < assets.size(); ++i) {
+        std::memcpy(package.data() + sizeof(header) + i * sizeof(AssetEntry), &assets[i].entry, sizeof(AssetEntry));
+        std::memcpy(package.data() + assets[i].entry.offset, assets[i].data.data(), assets[i].data.size());
+    }
+    if (!SDL_SaveFile(outputPath.c_str(), package.data(), package.size())) {
+        SDL_Log("Could not write package %s: %s", outputPath.c_str(), SDL_GetError());
+        return 1;
+    }
+
+    SDL_Log("Cooked %s: %zu entries (%d cooked, %d from cache), %zu bytes",
+            outputPath.c_str(), assets.size(), cookedCount, reusedCount, package.size());
+    return 0;
+}
@@ -0,0 +1,105 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+/*
+ * Headless check and benchmark of the particle integration, see ParticleSimulation.
+ * Runs the same emission and frames through the scalar and the SIMD simulation, checks that both give the same
+ * particles, and times them.
+ * Usage: particle-benchmark [ParticleCount] [FrameCount]
+ */
+
+#include <SDL3/SDL.h>
+
+#include "ParticleSimulation.hpp"
+#include "Random.hpp"
+
+namespace {
+    constexpr float DT = 1.0f / 60.0f;
+
+    // Same emitter as Scene16GpuParticles, lifetimes long enough that most particles stay alive
+    ParticleEmitUniforms MakeEmitUniforms(Uint32 emitCount) {
+        return ParticleEmitUniforms {
+            .positionX = 320.0f,
+            .positionY = 440.0f,
+            .direction = -SDL_PI_F * 0.5f,
+            .spread = 0.3f,
+            .speedMin = 200.0f,
+            .speedMax = 350.0f,
+            .lifetimeMin = 2.0f,
+            .lifetimeMax = 4.0f,
+            .size = 6.0f,
+            .angularSpeedMax = 4.0f,
+            .emitCount = emitCount,
+        };
+    }
+
+    bool AreEqual(const vector<float>& a, const vector<float>& b) {
+        return a.size() == b.size() && SDL_memcmp(a.data(), b.data(), a.size() * sizeof(float)) == 0;
+    }
+
+    bool AreEqual(const ParticleArrays& a, const ParticleArrays& b) {
+        return AreEqual(a.positionX, b.positionX) && AreEqual(a.positionY, b.positionY)
+               && AreEqual(a.velocityX, b.velocityX) && AreEqual(a.velocityY, b.velocityY)
+               && AreEqual(a.rotation, b.rotation) && AreEqual(a.angularVelocity, b.angularVelocity)
+               && AreEqual(a.age, b.age) && AreEqual(a.lifetime, b.lifetime)
+               && a.deadIndices == b.deadIndices;
+    }
+}
+
+int main(int argc, char** argv) {
+    const Uint32 particleCount = argc > 1 ? static_cast<Uint32>(SDL_max(SDL_atoi(argv[1]), 4)) : 1 << 20;
+    const Uint32 frameCount = argc > 2 ? static_cast<Uint32>(SDL_max(SDL_atoi(argv[2]), 1)) : 300;
+    // Fill the pool in one second of frames
+    const Uint32 emitPerFrame = SDL_max(particleCount / 60, 1u);
+
+    ParticleArrays scalarParticles;
+    ParticleArrays simdParticles;
+    scalarParticles.Reset(particleCount);
+    simdParticles.Reset(particleCount);
+    Random scalarRandom { 0 };
+    Random simdRandom { 0 };
+    const ParticleSimulateUniforms simulateUniforms {
+        .dt = DT,
+        .gravityX = 0.0f,
+        .gravityY = 150.0f,
+        .damping = 1.0f - 0.2f * DT,
+        .capacity = scalarParticles.GetCapacity()
+    };
+
+    Uint64 scalarTicks = 0;
+    Uint64 simdTicks = 0;
+    Uint64 simulatedParticles = 0;
+    bool isValid = true;
+    for (Uint32 frame = 0; frame < frameCount; ++frame) {
+        const ParticleEmitUniforms emitUniforms = MakeEmitUniforms(emitPerFrame);
+        ParticleSimulation::Emit(scalarParticles, emitUniforms, scalarRandom);
+        ParticleSimulation::Emit(simdParticles, emitUniforms, simdRandom);
+
+        Uint64 start = SDL_GetPerformanceCounter();
+        const Uint32 scalarAlive = ParticleSimulation::SimulateScalar(scalarParticles, simulateUniforms);
+        scalarTicks += SDL_GetPerformanceCounter() - start;
+
+        start = SDL_GetPerformanceCounter();
+        const Uint32 simdAlive = ParticleSimulation::Simulate(simdParticles, simulateUniforms);
+        simdTicks += SDL_GetPerformanceCounter() - start;
+
+        simulatedParticles += simdAlive;
+        if (scalarAlive != simdAlive || !AreEqual(scalarParticles, simdParticles)) {
+            SDL_Log("Frame %u: the SIMD simulation differs from the scalar one (%u and %u alive)", frame,
+                    simdAlive, scalarAlive);
+            isValid = false;
+            break;
+        }
+    }
+
+    const double frequency = static_cast<double>(SDL_GetPerformanceFrequency());
+    const double scalarMs = 1000.0 * static_cast<double>(scalarTicks) / frequency / frameCount;
+    const double simdMs = 1000.0 * static_cast<double>(simdTicks) / frequency / frameCount;
+    SDL_Log("%u particles, %u frames, %.0f alive on average", scalarParticles.GetCapacity(), frameCount,
+            static_cast<double>(simulatedParticles) / frameCount);
+    SDL_Log("Scalar: %.3f ms per frame", scalarMs);
+    SDL_Log("SIMD:   %.3f ms per frame (x%.2f)", simdMs, scalarMs / simdMs);
+    SDL_Log(isValid ? "SIMD and scalar simulations match" : "SIMD and scalar simulations differ");
+    return isValid ? 0 : 1;
+}
@@ -0,0 +1,190 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+/*
+ * Headless check and benchmark of SpatialGrid, see Scene21SpriteGrid.
+ * Moves 10K, 100K then 1M sprites up to MaxCount for FrameCount frames each. Every frame rebuilds the grid, culls a
+ * viewport and runs range and nearest queries, which are checked against a brute force scan and timed against it.
+ * Usage: spatial-grid-benchmark [MaxCount] [FrameCount]
+ */
+
+#include <SDL3/SDL.h>
+#include <algorithm>
+
+#include "SpatialGrid.hpp"
+#include "TaskScheduler.hpp"
+#include "Random.hpp"
+
+namespace {
+    constexpr float DT = 1.0f / 60.0f;
+    constexpr float CELL_SIZE = 64.0f;
+    constexpr float VIEWPORT_WIDTH = 640.0f;
+    constexpr float VIEWPORT_HEIGHT = 480.0f;
+    constexpr float RANGE_SIZE = 128.0f;
+    constexpr float NEAREST_MAX_DISTANCE = 256.0f;
+    constexpr Uint32 QUERIES_PER_FRAME = 64;
+
+    // Same density as Scene21SpriteGrid, 65536 sprites in 4096 x 4096
+    float GetWorldSize(Uint32 count) {
+        return 16.0f * SDL_sqrtf(static_cast<float>(count));
+    }
+
+    struct Sprites {
+        vector<float> x;
+        vector<float> y;
+        vector<float> velocityX;
+        vector<float> velocityY;
+
+        void Reset(Uint32 count, float worldSize) {
+            x.resize(count);
+            y.resize(count);
+            velocityX.resize(count);
+            velocityY.resize(count);
+            Random random { 0 };
+            random.FillFloat(x.data(), count, 0, worldSize);
+            random.FillFloat(y.data(), count, 0, worldSize);
+            random.FillFloat(velocityX.data(), count, -120.0f, 120.0f);
+            random.FillFloat(velocityY.data(), count, -120.0f, 120.0f);
+        }
+
+        void Move(float worldSize) {
+            for (size_t i = 0; i < x.size(); ++i) {
+                x[i] += velocityX[i] * DT;
+                y[i] += velocityY[i] * DT;
+                if (x[i] < 0 || x[i] > worldSize) { velocityX[i] = -velocityX[i]; }
+                if (y[i] < 0 || y[i] > worldSize) { velocityY[i] = -velocityY[i]; }
+            }
+        }
+    };
+
+    void BruteForceRange(const Sprites& sprites, float minX, float minY, float maxX, float maxY,
+                         vector<Uint32>& outItems) {
+        for (Uint32 i = 0; i < sprites.x.size(); ++i) {
+            if (sprites.x[i] >= minX && sprites.x[i] <= maxX && sprites.y[i] >= minY && sprites.y[i] <= maxY) {
+                outItems.push_back(i);
+            }
+        }
+    }
+
+    Uint32 BruteForceNearest(const Sprites& sprites, float x, float y, float maxDistance) {
+        float bestDistanceSquared = maxDistance * maxDistance;
+        Uint32 bestItem = SpatialGrid::NONE;
+        for (Uint32 i = 0; i < sprites.x.size(); ++i) {
+            const float dx = sprites.x[i] - x;
+            const float dy = sprites.y[i] - y;
+            const float distanceSquared = dx * dx + dy * dy;
+            if (distanceSquared < bestDistanceSquared) {
+                bestDistanceSquared = distanceSquared;
+                bestItem = i;
+            }
+        }
+        return bestItem;
+    }
+
+    // Range results come in cell order
+    bool AreSameItems(vector<Uint32>& gridItems, const vector<Uint32>& bruteForceItems) {
+        std::sort(gridItems.begin(), gridItems.end());
+        return gridItems == bruteForceItems;
+    }
+
+    double ToMilliseconds(Uint64 ticks, Uint32 count) {
+        return 1000.0 * static_cast<double>(ticks) / static_cast<double>(SDL_GetPerformanceFrequency()) / count;
+    }
+
+    bool Benchmark(Uint32 spriteCount, Uint32 frameCount) {
+        const float worldSize = GetWorldSize(spriteCount);
+        Sprites sprites;
+        sprites.Reset(spriteCount, worldSize);
+        SpatialGrid grid;
+        grid.Init(0, 0, worldSize, worldSize, CELL_SIZE);
+        Random random { 1 };
+
+        vector<Uint32> gridItems;
+        vector<Uint32> bruteForceItems;
+        Uint64 buildTicks = 0;
+        Uint64 cullTicks = 0;
+        Uint64 bruteForceCullTicks = 0;
+        Uint64 rangeTicks = 0;
+        Uint64 nearestTicks = 0;
+        Uint64 bruteForceNearestTicks = 0;
+        Uint64 visibleCount = 0;
+        for (Uint32 frame = 0; frame < frameCount; ++frame) {
+            sprites.Move(worldSize);
+
+            Uint64 start = SDL_GetPerformanceCounter();
+            grid.Build(sprites.x.data(), sprites.y.data(), spriteCount);
+            buildTicks += SDL_GetPerformanceCounter() - start;
+
+            // Viewport culling
+            const float cameraX = random.NextFloat(0, SDL_max(worldSize - VIEWPORT_WIDTH, 1.0f));
+            const float cameraY = random.NextFloat(0, SDL_max(worldSize - VIEWPORT_HEIGHT, 1.0f));
+            gridItems.clear();
+            start = SDL_GetPerformanceCounter();
+            grid.QueryRange(cameraX, cameraY, cameraX + VIEWPORT_WIDTH, cameraY + VIEWPORT_HEIGHT, gridItems);
+            cullTicks += SDL_GetPerformanceCounter() - start;
+            bruteForceItems.clear();
+            start = SDL_GetPerformanceCounter();
+            BruteForceRange(sprites, cameraX, cameraY, cameraX + VIEWPORT_WIDTH, cameraY + VIEWPORT_HEIGHT,
+                            bruteForceItems);
+            bruteForceCullTicks += SDL_GetPerformanceCounter() - start;
+            visibleCount += bruteForceItems.size();
+            if (!AreSameItems(gridItems, bruteForceItems)) {
+                SDL_Log("%u sprites, frame %u: viewport culling differs from brute force", spriteCount, frame);
+                return false;
+            }
+
+            // Small ranges, e.g. collision candidates, and nearest queries around random points. Brute force only
+            // checks the first query of the frame, it would take most of the run at 1M sprites.
+            for (Uint32 query = 0; query < QUERIES_PER_FRAME; ++query) {
+                const float x = random.NextFloat(0, worldSize);
+                const float y = random.NextFloat(0, worldSize);
+                gridItems.clear();
+                start = SDL_GetPerformanceCounter();
+                grid.QueryRange(x, y, x + RANGE_SIZE, y + RANGE_SIZE, gridItems);
+                rangeTicks += SDL_GetPerformanceCounter() - start;
+
+                start = SDL_GetPerformanceCounter();
+                const Uint32 nearest = grid.QueryNearest(x, y, NEAREST_MAX_DISTANCE);
+                nearestTicks += SDL_GetPerformanceCounter() - start;
+                if (query > 0) { continue; }
+
+                bruteForceItems.clear();
+                BruteForceRange(sprites, x, y, x + RANGE_SIZE, y + RANGE_SIZE, bruteForceItems);
+                start = SDL_GetPerformanceCounter();
+                const Uint32 bruteForceNearest = BruteForceNearest(sprites, x, y, NEAREST_MAX_DISTANCE);
+                bruteForceNearestTicks += SDL_GetPerformanceCounter() - start;
+                if (!AreSameItems(gridItems, bruteForceItems) || nearest != bruteForceNearest) {
+                    SDL_Log("%u sprites, frame %u: queries differ from brute force", spriteCount, frame);
+                    return false;
+                }
+            }
+        }
+
+        SDL_Log("%u sprites, %u x %u cells, %.0f visible on average", spriteCount, grid.GetColumnCount(),
+                grid.GetRowCount(), static_cast<double>(visibleCount) / frameCount);
+        SDL_Log("  Build:             %.3f ms per frame", ToMilliseconds(buildTicks, frameCount));
+        SDL_Log("  Viewport culling:  %.4f ms, brute force %.3f ms", ToMilliseconds(cullTicks, frameCount),
+                ToMilliseconds(bruteForceCullTicks, frameCount));
+        SDL_Log("  Range query:       %.4f ms", ToMilliseconds(rangeTicks, frameCount * QUERIES_PER_FRAME));
+        SDL_Log("  Nearest query:     %.4f ms, brute force %.3f ms",
+                ToMilliseconds(nearestTicks, frameCount * QUERIES_PER_FRAME),
+                ToMilliseconds(bruteForceNearestTicks, frameCount));
+        return true;
+    }
+}
+
+int main(int argc, char** argv) {
+    const Uint32 maxCount = argc > 1 ? static_cast<Uint32>(SDL_max(SDL_atoi(argv[1]), 1)) : 1000000;
+    const Uint32 frameCount = argc > 2 ? static_cast<Uint32>(SDL_max(SDL_atoi(argv[2]), 1)) : 120;
+    TaskScheduler::Init();
+
+    bool isValid = true;
+    for (Uint32 spriteCount = 10000; isValid && spriteCount <= maxCount; spriteCount *= 10) {
+        isValid = Benchmark(spriteCount, frameCount);
+    }
+
+    TaskScheduler::Close();
+    SDL_Log(isValid ? "Grid queries match brute force" : "Grid queries differ from brute force");
+    return isValid ? 0 : 1;
+}
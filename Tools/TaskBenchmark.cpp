@@ -0,0 +1,126 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+/*
+ * Scaling benchmark of the TaskScheduler.
+ * Runs the CPU frame work of the scenes, sprite generation and batches of matrix products, with 1 to N threads.
+ * Usage: task-benchmark [MaxThreadCount] [IterationCount]
+ *
+ * MaxThreadCount defaults to the logical core count. Each line gives the mean time of one batch, the speedup
+ * over a single thread, and a checksum of the last sprite batch that must not change with the thread count.
+ */
+
+#include <SDL3/SDL.h>
+#include <vector>
+
+#include "Mat4.hpp"
+#include "Random.hpp"
+#include "Scene11SpriteBatchCompute.hpp"
+#include "TaskScheduler.hpp"
+
+using std::vector;
+
+namespace {
+    constexpr Uint32 SPRITE_BATCH_SIZE = SPRITE_COUNT * 8;
+    constexpr Uint32 MATRIX_BATCH_SIZE = 65536;
+    constexpr Uint32 MATRIX_GRAIN_SIZE = 256;
+
+    // Same generation as Scene11SpriteBatchCompute::Draw, with a random stream per chunk
+    void GenerateSprites(ComputeSpriteInstance* sprites, Uint64 frame) {
+        TaskScheduler::ParallelFor(SPRITE_BATCH_SIZE, SPRITE_GRAIN_SIZE, [sprites, frame](Uint32 begin, Uint32 end) {
+            float xs[SPRITE_GRAIN_SIZE];
+            float ys[SPRITE_GRAIN_SIZE];
+            float rotations[SPRITE_GRAIN_SIZE];
+            for (Uint32 chunk = begin; chunk < end; chunk += SPRITE_GRAIN_SIZE) {
+                const Uint32 count = SDL_min(SPRITE_GRAIN_SIZE, end - chunk);
+                Random random { SPRITE_SEED, (frame * SPRITE_BATCH_SIZE + chunk) / SPRITE_GRAIN_SIZE };
+                random.FillFloat(xs, count, 0, 640);
+                random.FillFloat(ys, count, 0, 480);
+                random.FillAngle(rotations, count);
+                for (Uint32 i = 0; i < count; ++i) {
+                    ComputeSpriteInstance& sprite = sprites[chunk + i];
+                    sprite.x = xs[i];
+                    sprite.y = ys[i];
+                    sprite.z = 0;
+                    sprite.rotation = rotations[i];
+                    sprite.w = 32;
+                    sprite.h = 32;
+                    sprite.r = 1.0f;
+                    sprite.g = 1.0f;
+                    sprite.b = 1.0f;
+                    sprite.a = 1.0f;
+                }
+            }
+        });
+    }
+
+    void ComputeMatrices(Mat4* matrices, const Mat4& viewProj, float time) {
+        TaskScheduler::ParallelFor(MATRIX_BATCH_SIZE, MATRIX_GRAIN_SIZE, [=](Uint32 begin, Uint32 end) {
+            for (Uint32 i = begin; i < end; ++i) {
+                const float x = static_cast<float>(i % 256);
+                const float y = static_cast<float>(i / 256);
+                matrices[i] = Mat4::CreateScale(16.0f, 16.0f, 1.0f)
+                        * Mat4::CreateRotationZ(time + (x + y) * 0.15f)
+                        * Mat4::CreateTranslation(x * 32.0f, y * 32.0f, 0.0f)
+                        * viewProj;
+            }
+        });
+    }
+
+    // Mean milliseconds per call of work
+    template<typename Work>
+    double Measure(Uint32 iterationCount, Work work) {
+        work(0);
+        const Uint64 start = SDL_GetPerformanceCounter();
+        for (Uint32 i = 1; i <= iterationCount; ++i) {
+            work(i);
+        }
+        const Uint64 elapsed = SDL_GetPerformanceCounter() - start;
+        return 1000.0 * static_cast<double>(elapsed)
+                / static_cast<double>(SDL_GetPerformanceFrequency()) / iterationCount;
+    }
+}
+
+int main(int argc, char** argv) {
+    const Uint32 maxThreadCount = argc > 1
+            ? static_cast<Uint32>(SDL_max(SDL_atoi(argv[1]), 1))
+            : static_cast<Uint32>(SDL_max(SDL_GetNumLogicalCPUCores(), 1));
+    const Uint32 iterationCount = argc > 2 ? static_cast<Uint32>(SDL_max(SDL_atoi(argv[2]), 1)) : 100;
+
+    vector<ComputeSpriteInstance> sprites(SPRITE_BATCH_SIZE);
+    vector<Mat4> matrices(MATRIX_BATCH_SIZE);
+    const Mat4 viewProj = Mat4::CreateOrthographicOffCenter(0, 640, 480, 0, 0, -1);
+
+    SDL_Log("%u sprites and %u matrices per batch, %u iterations", SPRITE_BATCH_SIZE, MATRIX_BATCH_SIZE,
+            iterationCount);
+    double spriteReference = 0;
+    double matrixReference = 0;
+    for (Uint32 threadCount = 1; threadCount <= maxThreadCount; ++threadCount) {
+        // The calling thread is one of the threads: no workers for the single thread reference
+        TaskScheduler::Init(threadCount - 1);
+        if (TaskScheduler::GetThreadCount() != threadCount) {
+            SDL_Log("Could only start %u threads", TaskScheduler::GetThreadCount());
+            TaskScheduler::Close();
+            break;
+        }
+
+        const double spriteTime = Measure(iterationCount, [&sprites](Uint32 frame) {
+            GenerateSprites(sprites.data(), frame);
+        });
+        const double matrixTime = Measure(iterationCount, [&matrices, &viewProj](Uint32 frame) {
+            ComputeMatrices(matrices.data(), viewProj, static_cast<float>(frame) * 0.016f);
+        });
+        TaskScheduler::Close();
+        const Uint32 checksum = SDL_crc32(0, sprites.data(), sprites.size() * sizeof(ComputeSpriteInstance));
+
+        if (threadCount == 1) {
+            spriteReference = spriteTime;
+            matrixReference = matrixTime;
+        }
+        SDL_Log("%2u threads: sprites %7.3f ms (x%.2f), matrices %7.3f ms (x%.2f), sprite checksum %08x",
+                threadCount, spriteTime, spriteReference / spriteTime, matrixTime, matrixReference / matrixTime,
+                checksum);
+    }
+    return 0;
+}
@@ -0,0 +1,413 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+/*
+ * Benchmark of the tone map stage at 1080p and 4K, see ToneMapper and ToneMapping.
+ * Times the CPU reference of the two dispatches and of the fused one on a random HDR image. When a GPU device and the
+ * compiled ToneMapACES.comp, LinearToSRGB.comp and ToneMapFused.comp are available, times the same dispatches as
+ * ToneMapper::Apply and ToneMapper::ApplyFused, checks their output against the CPU reference, and reports the
+ * bandwidth they reach from ToneMapping::EstimateMemoryTraffic.
+ * Usage: tone-map-benchmark [FrameCount] [BasePath]
+ */
+
+#include <SDL3/SDL.h>
+#include <vector>
+
+#include "ToneMapping.hpp"
+#include "ToneMapper.hpp"
+#include "HDRImage.hpp"
+#include "Random.hpp"
+
+using std::vector;
+
+namespace {
+    constexpr Uint32 SIZES[][2] = { { 1920, 1080 }, { 3840, 2160 } };
+    constexpr ToneMapOperator OPERATOR = ToneMapOperator::ACES;
+    constexpr TransferFunction TRANSFER = TransferFunction::SRGB;
+    // The fused pass output is the same as the two passes at this exposure
+    constexpr float EXPOSURE = 1.0f;
+    // Must match the numthreads of the shaders, like ToneMapper
+    constexpr Uint32 THREAD_GROUP_SIZE = 8;
+    constexpr Uint32 FUSED_THREAD_GROUP_SIZE = 16;
+    // Frames recorded in one command buffer, so that the submit and the fence wait are amortized
+    constexpr Uint32 FRAMES_PER_SUBMIT = 10;
+    // The GPU rounds its intermediate image to float16 and has its own pow
+    constexpr int MAX_OUTPUT_DIFFERENCE = 2;
+
+    double ToMilliseconds(Uint64 ticks, Uint32 frameCount) {
+        return 1000.0 * static_cast<double>(ticks) / static_cast<double>(SDL_GetPerformanceFrequency()) / frameCount;
+    }
+
+    // RGBA HDR pixels in [0, 16), stored as float16 like the HDR target, and widened back for the CPU
+    struct Image {
+        Uint32 width;
+        Uint32 height;
+        vector<Uint16> halves;
+        vector<float> pixels;
+
+        size_t GetPixelCount() const { return static_cast<size_t>(width) * height; }
+    };
+
+    Image MakeImage(Uint32 width, Uint32 height) {
+        Image image { width, height };
+        const size_t floatCount = image.GetPixelCount() * 4;
+        image.pixels.resize(floatCount);
+        image.halves.resize(floatCount);
+        Random random { 0 };
+        random.FillFloat(image.pixels.data(), floatCount, 0.0f, 16.0f);
+        HDRImageLoader::ToHalf(image.pixels.data(), floatCount, image.halves.data());
+        for (size_t i = 0; i < floatCount; ++i) {
+            image.pixels[i] = HDRImageLoader::HalfToFloat(image.halves[i]);
+        }
+        return image;
+    }
+
+    // Same steps as the two dispatches, with a full size intermediate image
+    void ApplyTwoPasses(const Image& image, vector<float>& toneMapped, vector<float>& encoded,
+                        vector<Uint8>& outPixels) {
+        ToneMapping::ApplyOperator(OPERATOR, image.pixels.data(), image.GetPixelCount(), toneMapped.data());
+        ToneMapping::ApplyTransfer(TRANSFER, toneMapped.data(), image.GetPixelCount(), encoded.data());
+        ToneMapping::QuantizeToRGBA8(encoded.data(), image.GetPixelCount(), outPixels.data());
+    }
+
+    double ToGigabytesPerSecond(Uint64 byteCount, double milliseconds) {
+        return static_cast<double>(byteCount) / (milliseconds * 1e6);
+    }
+
+    // Largest channel difference over the width x height top left region
+    int GetMaxDifference(const Uint8* a, const Uint8* b, Uint32 rowLength, Uint32 width, Uint32 height) {
+        int maxDifference = 0;
+        for (Uint32 y = 0; y < height; ++y) {
+            const size_t row = static_cast<size_t>(y) * rowLength * 4;
+            for (Uint32 x = 0; x < width * 4; ++x) {
+                maxDifference = SDL_max(maxDifference, SDL_abs(a[row + x] - b[row + x]));
+            }
+        }
+        return maxDifference;
+    }
+
+    // Same paths and entry points as Renderer::CreateComputePipelineFromShader
+    SDL_GPUComputePipeline* CreateComputePipeline(SDL_GPUDevice* device, const char* basePath,
+                                                  const char* shaderFilename,
+                                                  SDL_GPUComputePipelineCreateInfo createInfo) {
+        char fullPath[256];
+        const SDL_GPUShaderFormat backendFormats = SDL_GetGPUShaderFormats(device);
+        if (backendFormats & SDL_GPU_SHADERFORMAT_SPIRV) {
+            SDL_snprintf(fullPath, sizeof(fullPath), "%sContent/Shaders/Compiled/SPIRV/%s.spv", basePath,
+                         shaderFilename);
+            createInfo.format = SDL_GPU_SHADERFORMAT_SPIRV;
+            createInfo.entrypoint = "main";
+        } else if (backendFormats & SDL_GPU_SHADERFORMAT_MSL) {
+            SDL_snprintf(fullPath, sizeof(fullPath), "%sContent/Shaders/Compiled/MSL/%s.msl", basePath,
+                         shaderFilename);
+            createInfo.format = SDL_GPU_SHADERFORMAT_MSL;
+            createInfo.entrypoint = "main0";
+        } else if (backendFormats & SDL_GPU_SHADERFORMAT_DXIL) {
+            SDL_snprintf(fullPath, sizeof(fullPath), "%sContent/Shaders/Compiled/DXIL/%s.dxil", basePath,
+                         shaderFilename);
+            createInfo.format = SDL_GPU_SHADERFORMAT_DXIL;
+            createInfo.entrypoint = "main";
+        } else {
+            SDL_Log("%s", "Unrecognized backend shader format!");
+            return nullptr;
+        }
+
+        size_t codeSize;
+        void* code = SDL_LoadFile(fullPath, &codeSize);
+        if (code == nullptr) {
+            SDL_Log("Failed to load compute shader from disk! %s", fullPath);
+            return nullptr;
+        }
+        createInfo.code = static_cast<const Uint8*>(code);
+        createInfo.code_size = codeSize;
+        SDL_GPUComputePipeline* pipeline = SDL_CreateGPUComputePipeline(device, &createInfo);
+        if (pipeline == nullptr) {
+            SDL_Log("Failed to create compute pipeline for %s: %s", shaderFilename, SDL_GetError());
+        }
+        SDL_free(code);
+        return pipeline;
+    }
+
+    // The ToneMapper pipelines and targets, at one size
+    struct GpuToneMapper {
+        SDL_GPUDevice* device { nullptr };
+        SDL_GPUComputePipeline* operatorPipeline { nullptr };
+        SDL_GPUComputePipeline* transferPipeline { nullptr };
+        SDL_GPUComputePipeline* fusedPipeline { nullptr };
+        SDL_GPUTexture* hdrTexture { nullptr };
+        SDL_GPUTexture* toneMappedTexture { nullptr };
+        SDL_GPUTexture* outputTexture { nullptr };
+        Uint32 width { 0 };
+        Uint32 height { 0 };
+
+        bool Load(const char* basePath) {
+            const SDL_GPUComputePipelineCreateInfo createInfo = {
+                .num_readonly_storage_textures = 1,
+                .num_readwrite_storage_textures = 1,
+                .threadcount_x = THREAD_GROUP_SIZE,
+                .threadcount_y = THREAD_GROUP_SIZE,
+                .threadcount_z = 1,
+            };
+            operatorPipeline = CreateComputePipeline(device, basePath, "ToneMapACES.comp", createInfo);
+            transferPipeline = CreateComputePipeline(device, basePath, "LinearToSRGB.comp", createInfo);
+            const SDL_GPUComputePipelineCreateInfo fusedCreateInfo = {
+                .num_readonly_storage_textures = 1,
+                .num_readwrite_storage_textures = 1,
+                .num_uniform_buffers = 1,
+                .threadcount_x = FUSED_THREAD_GROUP_SIZE,
+                .threadcount_y = FUSED_THREAD_GROUP_SIZE,
+                .threadcount_z = 1,
+            };
+            fusedPipeline = CreateComputePipeline(device, basePath, "ToneMapFused.comp", fusedCreateInfo);
+            return operatorPipeline != nullptr && transferPipeline != nullptr && fusedPipeline != nullptr;
+        }
+
+        void CreateTextures(Uint32 width_, Uint32 height_) {
+            width = width_;
+            height = height_;
+            SDL_GPUTextureCreateInfo createInfo = {
+                .type = SDL_GPU_TEXTURETYPE_2D,
+                .format = SDL_GPU_TEXTUREFORMAT_R16G16B16A16_FLOAT,
+                .usage = SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_READ,
+                .width = width,
+                .height = height,
+                .layer_count_or_depth = 1,
+                .num_levels = 1,
+            };
+            hdrTexture = SDL_CreateGPUTexture(device, &createInfo);
+            createInfo.usage = SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_WRITE | SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_READ;
+            toneMappedTexture = SDL_CreateGPUTexture(device, &createInfo);
+            createInfo.format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM;
+            createInfo.usage = SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_WRITE;
+            outputTexture = SDL_CreateGPUTexture(device, &createInfo);
+        }
+
+        void ReleaseTextures() {
+            SDL_ReleaseGPUTexture(device, hdrTexture);
+            SDL_ReleaseGPUTexture(device, toneMappedTexture);
+            SDL_ReleaseGPUTexture(device, outputTexture);
+            hdrTexture = toneMappedTexture = outputTexture = nullptr;
+        }
+
+        void Unload() {
+            ReleaseTextures();
+            SDL_ReleaseGPUComputePipeline(device, operatorPipeline);
+            SDL_ReleaseGPUComputePipeline(device, transferPipeline);
+            SDL_ReleaseGPUComputePipeline(device, fusedPipeline);
+        }
+
+        // Submit and wait, so that the next step sees the results
+        void SubmitAndWait(SDL_GPUCommandBuffer* commandBuffer) const {
+            SDL_GPUFence* fence = SDL_SubmitGPUCommandBufferAndAcquireFence(commandBuffer);
+            SDL_WaitForGPUFences(device, true, &fence, 1);
+            SDL_ReleaseGPUFence(device, fence);
+        }
+
+        void Upload(const Image& image) const {
+            const Uint32 byteCount = static_cast<Uint32>(image.halves.size() * sizeof(Uint16));
+            const SDL_GPUTransferBufferCreateInfo transferInfo = {
+                .usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+                .size = byteCount
+            };
+            SDL_GPUTransferBuffer* transferBuffer = SDL_CreateGPUTransferBuffer(device, &transferInfo);
+            void* data = SDL_MapGPUTransferBuffer(device, transferBuffer, false);
+            SDL_memcpy(data, image.halves.data(), byteCount);
+            SDL_UnmapGPUTransferBuffer(device, transferBuffer);
+
+            SDL_GPUCommandBuffer* commandBuffer = SDL_AcquireGPUCommandBuffer(device);
+            SDL_GPUCopyPass* copyPass = SDL_BeginGPUCopyPass(commandBuffer);
+            const SDL_GPUTextureTransferInfo source = {
+                .transfer_buffer = transferBuffer,
+                .pixels_per_row = width,
+                .rows_per_layer = height
+            };
+            const SDL_GPUTextureRegion destination = {
+                .texture = hdrTexture,
+                .w = width,
+                .h = height,
+                .d = 1
+            };
+            SDL_UploadToGPUTexture(copyPass, &source, &destination, false);
+            SDL_EndGPUCopyPass(copyPass);
+            SubmitAndWait(commandBuffer);
+            SDL_ReleaseGPUTransferBuffer(device, transferBuffer);
+        }
+
+        void Download(vector<Uint8>& outPixels) const {
+            const Uint32 byteCount = width * height * 4;
+            const SDL_GPUTransferBufferCreateInfo transferInfo = {
+                .usage = SDL_GPU_TRANSFERBUFFERUSAGE_DOWNLOAD,
+                .size = byteCount
+            };
+            SDL_GPUTransferBuffer* transferBuffer = SDL_CreateGPUTransferBuffer(device, &transferInfo);
+
+            SDL_GPUCommandBuffer* commandBuffer = SDL_AcquireGPUCommandBuffer(device);
+            SDL_GPUCopyPass* copyPass = SDL_BeginGPUCopyPass(commandBuffer);
+            const SDL_GPUTextureRegion source = {
+                .texture = outputTexture,
+                .w = width,
+                .h = height,
+                .d = 1
+            };
+            const SDL_GPUTextureTransferInfo destination = {
+                .transfer_buffer = transferBuffer,
+                .pixels_per_row = width,
+                .rows_per_layer = height
+            };
+            SDL_DownloadFromGPUTexture(copyPass, &source, &destination);
+            SDL_EndGPUCopyPass(copyPass);
+            SubmitAndWait(commandBuffer);
+
+            outPixels.resize(byteCount);
+            const void* data = SDL_MapGPUTransferBuffer(device, transferBuffer, false);
+            SDL_memcpy(outPixels.data(), data, byteCount);
+            SDL_UnmapGPUTransferBuffer(device, transferBuffer);
+            SDL_ReleaseGPUTransferBuffer(device, transferBuffer);
+        }
+
+        // The dispatches of ToneMapper::Apply, whole groups only
+        void RecordTwoPasses(SDL_GPUCommandBuffer* commandBuffer) const {
+            SDL_GPUStorageTextureReadWriteBinding toneMappedBinding { .texture = toneMappedTexture };
+            SDL_GPUComputePass* computePass = SDL_BeginGPUComputePass(commandBuffer, &toneMappedBinding, 1,
+                                                                      nullptr, 0);
+            SDL_BindGPUComputePipeline(computePass, operatorPipeline);
+            SDL_BindGPUComputeStorageTextures(computePass, 0, &hdrTexture, 1);
+            SDL_DispatchGPUCompute(computePass, width / THREAD_GROUP_SIZE, height / THREAD_GROUP_SIZE, 1);
+            SDL_EndGPUComputePass(computePass);
+
+            SDL_GPUStorageTextureReadWriteBinding outputBinding { .texture = outputTexture };
+            computePass = SDL_BeginGPUComputePass(commandBuffer, &outputBinding, 1, nullptr, 0);
+            SDL_BindGPUComputePipeline(computePass, transferPipeline);
+            SDL_BindGPUComputeStorageTextures(computePass, 0, &toneMappedTexture, 1);
+            SDL_DispatchGPUCompute(computePass, width / THREAD_GROUP_SIZE, height / THREAD_GROUP_SIZE, 1);
+            SDL_EndGPUComputePass(computePass);
+        }
+
+        // The dispatch of ToneMapper::ApplyFused, whole groups only
+        void RecordFused(SDL_GPUCommandBuffer* commandBuffer) const {
+            const ToneMapFusedUniforms uniforms {
+                .exposure = EXPOSURE,
+                .toneMapOperator = static_cast<Uint32>(OPERATOR),
+                .transferFunction = static_cast<Uint32>(TRANSFER),
+                .paperWhiteNits = ToneMapping::ST2084_PAPER_WHITE_NITS
+            };
+            SDL_GPUStorageTextureReadWriteBinding outputBinding { .texture = outputTexture };
+            SDL_GPUComputePass* computePass = SDL_BeginGPUComputePass(commandBuffer, &outputBinding, 1, nullptr, 0);
+            SDL_BindGPUComputePipeline(computePass, fusedPipeline);
+            SDL_BindGPUComputeStorageTextures(computePass, 0, &hdrTexture, 1);
+            SDL_PushGPUComputeUniformData(commandBuffer, 0, &uniforms, sizeof(uniforms));
+            SDL_DispatchGPUCompute(computePass, width / FUSED_THREAD_GROUP_SIZE, height / FUSED_THREAD_GROUP_SIZE, 1);
+            SDL_EndGPUComputePass(computePass);
+        }
+
+        // Rounded up to whole submits. Includes the submit and wait costs, amortized over FRAMES_PER_SUBMIT.
+        Uint64 Time(Uint32 frameCount, bool isFused) const {
+            const Uint64 start = SDL_GetPerformanceCounter();
+            for (Uint32 frame = 0; frame < frameCount; frame += FRAMES_PER_SUBMIT) {
+                SDL_GPUCommandBuffer* commandBuffer = SDL_AcquireGPUCommandBuffer(device);
+                for (Uint32 i = 0; i < FRAMES_PER_SUBMIT; ++i) {
+                    if (isFused) {
+                        RecordFused(commandBuffer);
+                    } else {
+                        RecordTwoPasses(commandBuffer);
+                    }
+                }
+                SubmitAndWait(commandBuffer);
+            }
+            return SDL_GetPerformanceCounter() - start;
+        }
+    };
+
+    // Downloads the last GPU output, and compares the region of whole groups with the CPU reference
+    bool IsGpuOutputValid(const GpuToneMapper& gpu, const vector<Uint8>& cpuPixels, Uint32 groupSize) {
+        vector<Uint8> gpuPixels;
+        gpu.Download(gpuPixels);
+        const int difference = GetMaxDifference(gpuPixels.data(), cpuPixels.data(), gpu.width,
+                                                gpu.width / groupSize * groupSize,
+                                                gpu.height / groupSize * groupSize);
+        if (difference > MAX_OUTPUT_DIFFERENCE) {
+            SDL_Log("%ux%u: the GPU output of %ux%u groups differs from the CPU reference by %d", gpu.width,
+                    gpu.height, groupSize, groupSize, difference);
+            return false;
+        }
+        return true;
+    }
+}
+
+int main(int argc, char** argv) {
+    const Uint32 frameCount = argc > 1 ? static_cast<Uint32>(SDL_max(SDL_atoi(argv[1]), 1)) : 100;
+    const char* basePath = argc > 2 ? argv[2] : SDL_GetBasePath();
+    // The CPU reference is two orders of magnitude slower
+    const Uint32 cpuFrameCount = SDL_max(frameCount / 20, 1u);
+
+    GpuToneMapper gpu;
+    if (SDL_Init(SDL_INIT_VIDEO)) {
+        gpu.device = SDL_CreateGPUDevice(SDL_GPU_SHADERFORMAT_SPIRV | SDL_GPU_SHADERFORMAT_DXIL
+                                         | SDL_GPU_SHADERFORMAT_MSL, false, nullptr);
+    }
+    const bool isGpuAvailable = gpu.device != nullptr && gpu.Load(basePath);
+    if (!isGpuAvailable) {
+        SDL_Log("No GPU device or no compiled tone map shaders, only the CPU reference runs: %s", SDL_GetError());
+    }
+
+    bool isValid = true;
+    SDL_Log("%s then %s, %u frames", ToneMapping::GetOperatorName(OPERATOR),
+            ToneMapping::GetTransferFunctionName(TRANSFER), frameCount);
+    for (const auto& size : SIZES) {
+        const Image image = MakeImage(size[0], size[1]);
+        vector<float> toneMapped(image.pixels.size());
+        vector<float> encoded(image.pixels.size());
+        vector<Uint8> cpuPixels(image.GetPixelCount() * 4);
+        vector<Uint8> cpuFusedPixels(image.GetPixelCount() * 4);
+
+        Uint64 start = SDL_GetPerformanceCounter();
+        for (Uint32 frame = 0; frame < cpuFrameCount; ++frame) {
+            ApplyTwoPasses(image, toneMapped, encoded, cpuPixels);
+        }
+        const double cpuMs = ToMilliseconds(SDL_GetPerformanceCounter() - start, cpuFrameCount);
+        start = SDL_GetPerformanceCounter();
+        for (Uint32 frame = 0; frame < cpuFrameCount; ++frame) {
+            ToneMapping::ApplyFused(OPERATOR, TRANSFER, EXPOSURE, image.pixels.data(), image.GetPixelCount(),
+                                    cpuFusedPixels.data());
+        }
+        const double cpuFusedMs = ToMilliseconds(SDL_GetPerformanceCounter() - start, cpuFrameCount);
+        SDL_Log("%ux%u CPU: %.3f ms in two passes, %.3f ms fused (x%.2f)", image.width, image.height, cpuMs,
+                cpuFusedMs, cpuMs / cpuFusedMs);
+        if (cpuFusedPixels != cpuPixels) {
+            SDL_Log("%ux%u: the CPU fused output differs from the two passes", image.width, image.height);
+            isValid = false;
+        }
+        if (!isGpuAvailable) {
+            continue;
+        }
+
+        gpu.CreateTextures(image.width, image.height);
+        gpu.Upload(image);
+        const Uint32 submittedFrameCount = (frameCount + FRAMES_PER_SUBMIT - 1) / FRAMES_PER_SUBMIT
+                                           * FRAMES_PER_SUBMIT;
+        const double gpuMs = ToMilliseconds(gpu.Time(frameCount, false), submittedFrameCount);
+        isValid = IsGpuOutputValid(gpu, cpuPixels, THREAD_GROUP_SIZE) && isValid;
+        const double gpuFusedMs = ToMilliseconds(gpu.Time(frameCount, true), submittedFrameCount);
+        isValid = IsGpuOutputValid(gpu, cpuPixels, FUSED_THREAD_GROUP_SIZE) && isValid;
+        SDL_Log("%ux%u GPU: %.3f ms in two passes, %.3f ms fused (x%.2f)", image.width, image.height, gpuMs,
+                gpuFusedMs, gpuMs / gpuFusedMs);
+        SDL_Log("%ux%u GPU bandwidth: %.1f GB/s in two passes, %.1f GB/s fused", image.width, image.height,
+                ToGigabytesPerSecond(ToneMapping::EstimateMemoryTraffic(image.width, image.height, false), gpuMs),
+                ToGigabytesPerSecond(ToneMapping::EstimateMemoryTraffic(image.width, image.height, true),
+                                     gpuFusedMs));
+        gpu.ReleaseTextures();
+    }
+
+    if (gpu.device != nullptr) {
+        gpu.Unload();
+        SDL_DestroyGPUDevice(gpu.device);
+    }
+    SDL_Quit();
+    if (isGpuAvailable) {
+        SDL_Log(isValid ? "GPU and CPU tone maps match" : "GPU and CPU tone maps differ");
+    } else {
+        SDL_Log(isValid ? "CPU fused and two pass tone maps match" : "CPU fused and two pass tone maps differ");
+    }
+    return isValid ? 0 : 1;
+}
@@ -0,0 +1,128 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#include "UniformArena.hpp"
+#include "Renderer.hpp"
+#include <cstring>
+
+static_assert(UniformArena::RING_SIZE > Renderer::MAX_FRAMES_IN_FLIGHT,
+              "A ring segment must not be rewritten while a frame in flight reads it");
+
+void UniformArena::Load(Renderer& renderer, Uint32 stride_, Uint32 capacity_, const string& name) {
+    stride = (stride_ + 15) & ~15u;
+    capacity = capacity_;
+    const Uint32 drawIdCount = capacity * RING_SIZE;
+
+    constantBuffer = renderer.CreateBuffer(SDL_GPUBufferCreateInfo {
+        .usage = SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ,
+        .size = stride * drawIdCount
+    });
+    renderer.SetBufferName(constantBuffer, name);
+    transferBuffer = renderer.CreateTransferBuffer(SDL_GPUTransferBufferCreateInfo {
+        .usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+        .size = stride * capacity
+    });
+
+    // Draw ids never change, they are uploaded once
+    const Uint32 drawIdSize = drawIdCount * static_cast<Uint32>(sizeof(Uint32));
+    drawIdBuffer = renderer.CreateBuffer(SDL_GPUBufferCreateInfo {
+        .usage = SDL_GPU_BUFFERUSAGE_VERTEX,
+        .size = drawIdSize
+    });
+    renderer.SetBufferName(drawIdBuffer, name + " Draw Ids");
+    SDL_GPUTransferBuffer* drawIdTransferBuffer = renderer.CreateTransferBuffer(SDL_GPUTransferBufferCreateInfo {
+        .usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+        .size = drawIdSize
+    });
+    auto drawIds = static_cast<Uint32*>(renderer.MapTransferBuffer(drawIdTransferBuffer, false));
+    for (Uint32 i = 0; i < drawIdCount; ++i) {
+        drawIds[i] = i;
+    }
+    renderer.UnmapTransferBuffer(drawIdTransferBuffer);
+
+    renderer.BeginUploadToBuffer();
+    SDL_GPUTransferBufferLocation source {
+        .transfer_buffer = drawIdTransferBuffer,
+        .offset = 0
+    };
+    SDL_GPUBufferRegion destination {
+        .buffer = drawIdBuffer,
+        .offset = 0,
+        .size = drawIdSize
+    };
+    renderer.UploadToBuffer(source, destination, false);
+    renderer.EndUploadToBuffer(drawIdTransferBuffer);
+}
+
+void UniformArena::Begin(Renderer& renderer) {
+    segment = static_cast<Uint32>(renderer.GetFrameIndex() % RING_SIZE);
+    drawCount = 0;
+    // The staging memory can cycle, only the GPU buffer has to keep the previous frames constants
+    mappedData = static_cast<Uint8*>(renderer.MapTransferBuffer(transferBuffer, true));
+}
+
+Uint32 UniformArena::Push(const void* constants, Uint32 size) {
+    if (mappedData == nullptr || drawCount >= capacity) { return INVALID_DRAW_ID; }
+    std::memcpy(mappedData + drawCount * stride, constants, SDL_min(size, stride));
+    return segment * capacity + drawCount++;
+}
+
+void UniformArena::Upload(Renderer& renderer) {
+    if (mappedData == nullptr) { return; }
+    renderer.UnmapTransferBuffer(transferBuffer);
+    mappedData = nullptr;
+    if (drawCount == 0) { return; }
+
+    renderer.BeginUploadToBuffer();
+    SDL_GPUTransferBufferLocation source {
+        .transfer_buffer = transferBuffer,
+        .offset = 0
+    };
+    SDL_GPUBufferRegion destination {
+        .buffer = constantBuffer,
+        .offset = segment * capacity * stride,
+        .size = drawCount * stride
+    };
+    // No cycling: that would drop the segments of the frames in flight
+    renderer.UploadToBuffer(source, destination, false);
+    renderer.EndUploadToBuffer(transferBuffer, false);
+}
+
+void UniformArena::Bind(Renderer& renderer, Uint32 storageSlot, Uint32 drawIdSlot) const {
+    renderer.BindVertexStorageBuffers(storageSlot, &constantBuffer, 1);
+    SDL_GPUBufferBinding drawIdBinding { .buffer = drawIdBuffer, .offset = 0 };
+    renderer.BindVertexBuffers(drawIdSlot, drawIdBinding, 1);
+}
+
+void UniformArena::Unload(Renderer& renderer) {
+    if (mappedData != nullptr) {
+        renderer.UnmapTransferBuffer(transferBuffer);
+        mappedData = nullptr;
+    }
+    renderer.ReleaseBuffer(constantBuffer);
+    renderer.ReleaseBuffer(drawIdBuffer);
+    renderer.ReleaseTransferBuffer(transferBuffer);
+    constantBuffer = nullptr;
+    drawIdBuffer = nullptr;
+    transferBuffer = nullptr;
+    drawCount = 0;
+}
+
+SDL_GPUVertexBufferDescription UniformArena::GetDrawIdBufferDescription(Uint32 slot) {
+    return SDL_GPUVertexBufferDescription {
+        .slot = slot,
+        .pitch = sizeof(Uint32),
+        .input_rate = SDL_GPU_VERTEXINPUTRATE_INSTANCE,
+        .instance_step_rate = 0,
+    };
+}
+
+SDL_GPUVertexAttribute UniformArena::GetDrawIdAttribute(Uint32 location, Uint32 slot) {
+    return SDL_GPUVertexAttribute {
+        .location = location,
+        .buffer_slot = slot,
+        .format = SDL_GPU_VERTEXELEMENTFORMAT_UINT,
+        .offset = 0
+    };
+}
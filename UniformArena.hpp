@@ -0,0 +1,69 @@
+//
+// Created by Gaëtan Blaise-Cazalet on 18/10/2026.
+//
+
+#ifndef UNIFORMARENA_HPP
+#define UNIFORMARENA_HPP
+
+#include <SDL3/SDL_gpu.h>
+#include <string>
+
+using std::string;
+
+class Renderer;
+
+/*
+ * Per draw constants of a whole frame, packed in one storage buffer instead of one uniform push per draw.
+ *
+ * The storage buffer is a ring of RING_SIZE frame segments of capacity records. A segment is rewritten once the
+ * frame that last read it has retired, so uploads never cycle and the draw ids of a frame are stable.
+ * Shaders get their draw id from an instance rate vertex attribute: the arena binds a buffer of consecutive ids,
+ * and each draw passes its id as first instance. Instance rate attributes honor first instance on every backend,
+ * unlike SV_InstanceID.
+ *
+ * Usage per frame: Begin, Push the constants of every draw, Upload before the render pass, then Bind in the pass
+ * and draw with firstInstance = draw id and one instance.
+ */
+class UniformArena {
+public:
+    // Records are padded to 16 bytes, the shader struct must match the padded stride
+    void Load(Renderer& renderer, Uint32 stride, Uint32 capacity, const string& name);
+
+    // Start a frame: map the staging memory of the frame segment
+    void Begin(Renderer& renderer);
+
+    // Copy the constants of one draw. Returns the draw id, or INVALID_DRAW_ID when the frame segment is full.
+    Uint32 Push(const void* constants, Uint32 size);
+
+    // Copy the frame constants to the GPU. Must happen outside of a render pass.
+    void Upload(Renderer& renderer);
+
+    // Bind the constants at vertex storage slot storageSlot and the draw ids at vertex buffer slot drawIdSlot
+    void Bind(Renderer& renderer, Uint32 storageSlot, Uint32 drawIdSlot) const;
+
+    void Unload(Renderer& renderer);
+
+    Uint32 GetDrawCount() const { return drawCount; }
+    Uint32 GetStride() const { return stride; }
+
+    // Pipeline vertex input for the draw ids: a Uint32 per instance
+    static SDL_GPUVertexBufferDescription GetDrawIdBufferDescription(Uint32 slot);
+    static SDL_GPUVertexAttribute GetDrawIdAttribute(Uint32 location, Uint32 slot);
+
+    static constexpr Uint32 INVALID_DRAW_ID = 0xFFFFFFFF;
+    // One segment more than the frames the GPU can have in flight while the CPU records
+    static constexpr Uint32 RING_SIZE = 4;
+
+private:
+    SDL_GPUBuffer* constantBuffer { nullptr };
+    SDL_GPUBuffer* drawIdBuffer { nullptr };
+    SDL_GPUTransferBuffer* transferBuffer { nullptr };
+    Uint8* mappedData { nullptr };
+    Uint32 stride { 0 };
+    Uint32 capacity { 0 };
+    Uint32 segment { 0 };
+    Uint32 drawCount { 0 };
+};
+
+
+#endif //UNIFORMARENA_HPP